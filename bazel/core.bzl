@@ -154,9 +154,13 @@ MLN_CORE_SOURCE = [
     "src/mbgl/gfx/render_pass.hpp",
     "src/mbgl/gfx/renderer_backend.cpp",
     "src/mbgl/gfx/rendering_stats.cpp",
+    "src/mbgl/gfx/shader_binary_cache.cpp",
+    "src/mbgl/gfx/shader_binary_cache.hpp",
     "src/mbgl/gfx/shader_registry.cpp",
     "src/mbgl/gfx/shader_group.cpp",
     "src/mbgl/gfx/uniform.hpp",
+    "src/mbgl/gfx/uniform_arena.cpp",
+    "src/mbgl/gfx/uniform_arena.hpp",
     "src/mbgl/gfx/upload_pass.hpp",
     "src/mbgl/gfx/vertex_vector.hpp",
     "src/mbgl/layermanager/background_layer_factory.cpp",
@@ -224,6 +228,8 @@ MLN_CORE_SOURCE = [
     "src/mbgl/renderer/cross_faded_property_evaluator.cpp",
     "src/mbgl/renderer/cross_faded_property_evaluator.hpp",
     "src/mbgl/renderer/data_driven_property_evaluator.hpp",
+    "src/mbgl/renderer/frame_profiler.cpp",
+    "src/mbgl/renderer/frame_profiler.hpp",
     "src/mbgl/renderer/group_by_layout.cpp",
     "src/mbgl/renderer/group_by_layout.hpp",
     "src/mbgl/renderer/image_manager.cpp",
@@ -489,6 +495,8 @@ MLN_CORE_SOURCE = [
     "src/mbgl/text/quads.hpp",
     "src/mbgl/text/shaping.cpp",
     "src/mbgl/text/shaping.hpp",
+    "src/mbgl/text/shaping_cache.cpp",
+    "src/mbgl/text/shaping_cache.hpp",
     "src/mbgl/text/tagged_string.cpp",
     "src/mbgl/text/tagged_string.hpp",
     "src/mbgl/text/harfbuzz.cpp",
@@ -523,6 +531,7 @@ MLN_CORE_SOURCE = [
     "src/mbgl/tile/tile_loader_observer.hpp",
     "src/mbgl/tile/tile_observer.hpp",
     "src/mbgl/tile/tile_operation.cpp",
+    "src/mbgl/tile/tile_worker_stats.hpp",
     "src/mbgl/tile/vector_tile.cpp",
     "src/mbgl/tile/vector_tile.hpp",
     "src/mbgl/tile/vector_mlt_tile.cpp",
@@ -540,6 +549,7 @@ MLN_CORE_SOURCE = [
     "src/mbgl/util/camera.hpp",
     "src/mbgl/util/bounding_volumes.hpp",
     "src/mbgl/util/bounding_volumes.cpp",
+    "src/mbgl/util/cancellation_token.hpp",
     "src/mbgl/util/chrono.cpp",
     "src/mbgl/util/client_options.cpp",
     "src/mbgl/util/constants.cpp",
@@ -578,12 +588,16 @@ MLN_CORE_SOURCE = [
     "src/mbgl/util/mat4.cpp",
     "src/mbgl/util/mat4.hpp",
     "src/mbgl/util/math.hpp",
+    "src/mbgl/util/monotonic_arena.cpp",
     "src/mbgl/util/padding.cpp",
+    "src/mbgl/util/parallel_for.cpp",
+    "src/mbgl/util/parallel_for.hpp",
     "src/mbgl/util/premultiply.cpp",
     "src/mbgl/util/quaternion.cpp",
     "src/mbgl/util/quaternion.hpp",
     "src/mbgl/util/rapidjson.cpp",
     "src/mbgl/util/rapidjson.hpp",
+    "src/mbgl/util/scheduler_telemetry.cpp",
     "src/mbgl/util/std.hpp",
     "src/mbgl/util/stopwatch.cpp",
     "src/mbgl/util/stopwatch.hpp",
@@ -687,6 +701,7 @@ MLN_CORE_HEADERS = [
     "include/mbgl/platform/settings.hpp",
     "include/mbgl/platform/thread.hpp",
     "include/mbgl/platform/time.hpp",
+    "include/mbgl/renderer/frame_profile.hpp",
     "include/mbgl/renderer/query.hpp",
     "include/mbgl/renderer/renderer.hpp",
     "include/mbgl/renderer/renderer_frontend.hpp",
@@ -820,12 +835,14 @@ MLN_CORE_HEADERS = [
     "include/mbgl/util/identity.hpp",
     "include/mbgl/util/ignore.hpp",
     "include/mbgl/util/image.hpp",
+    "include/mbgl/util/image_encoder.hpp",
     "include/mbgl/util/immutable.hpp",
     "include/mbgl/util/indexed_tuple.hpp",
     "include/mbgl/util/instrumentation.hpp",
     "include/mbgl/util/interpolate.hpp",
     "include/mbgl/util/logging.hpp",
     "include/mbgl/util/lru_cache.hpp",
+    "include/mbgl/util/monotonic_arena.hpp",
     "include/mbgl/util/monotonic_timer.hpp",
     "include/mbgl/util/noncopyable.hpp",
     "include/mbgl/util/padding.hpp",
@@ -835,6 +852,7 @@ MLN_CORE_HEADERS = [
     "include/mbgl/util/range.hpp",
     "include/mbgl/util/rect.hpp",
     "include/mbgl/util/run_loop.hpp",
+    "include/mbgl/util/scheduler_telemetry.hpp",
     "include/mbgl/util/scoped.hpp",
     "include/mbgl/util/size.hpp",
     "include/mbgl/util/string.hpp",
@@ -858,6 +876,8 @@ MLN_CORE_HEADERS = [
 MLN_OPENGL_SOURCE = [
     "src/mbgl/gl/attribute.cpp",
     "src/mbgl/gl/attribute.hpp",
+    "src/mbgl/gl/buffer_pool.cpp",
+    "src/mbgl/gl/buffer_pool.hpp",
     "src/mbgl/gl/command_encoder.cpp",
     "src/mbgl/gl/command_encoder.hpp",
     "src/mbgl/gl/context.cpp",
@@ -878,6 +898,8 @@ MLN_OPENGL_SOURCE = [
     "src/mbgl/gl/object.hpp",
     "src/mbgl/gl/offscreen_texture.cpp",
     "src/mbgl/gl/offscreen_texture.hpp",
+    "src/mbgl/gl/readback_queue.cpp",
+    "src/mbgl/gl/readback_queue.hpp",
     "src/mbgl/gl/render_pass.cpp",
     "src/mbgl/gl/render_pass.hpp",
     "src/mbgl/gl/renderbuffer_resource.cpp",
@@ -914,6 +936,7 @@ MLN_OPENGL_HEADERS = [
 ]
 
 MLN_DRAWABLES_SOURCE = [
+    "src/mbgl/gfx/atlas_packer.cpp",
     "src/mbgl/gfx/drawable.cpp",
     "src/mbgl/gfx/drawable_builder.cpp",
     "src/mbgl/gfx/drawable_builder_impl.hpp",
@@ -974,6 +997,7 @@ MLN_DRAWABLES_SOURCE = [
 ]
 
 MLN_DRAWABLES_HEADERS = [
+    "include/mbgl/gfx/atlas_packer.hpp",
     "include/mbgl/gfx/drawable.hpp",
     "include/mbgl/gfx/drawable_data.hpp",
     "include/mbgl/gfx/drawable_impl.hpp",
@@ -1018,13 +1042,15 @@ MLN_DRAWABLES_HEADERS = [
 ]
 
 MLN_DRAWABLES_GL_SOURCE = [
-    "src/mbgl/gl/buffer_allocator.cpp",
+    "src/mbgl/gl/draw_list.cpp",
     "src/mbgl/gl/drawable_gl.cpp",
     "src/mbgl/gl/drawable_gl_builder.cpp",
     "src/mbgl/gl/drawable_gl_impl.hpp",
     "src/mbgl/gl/dynamic_texture.cpp",
     "src/mbgl/gl/layer_group_gl.cpp",
     "src/mbgl/gl/texture2d.cpp",
+    "src/mbgl/gl/uniform_arena_gl.cpp",
+    "src/mbgl/gl/uniform_arena_gl.hpp",
     "src/mbgl/gl/uniform_buffer_gl.cpp",
     "src/mbgl/gl/vertex_attribute_gl.cpp",
     "src/mbgl/shaders/gl/shader_info.cpp",
@@ -1032,7 +1058,7 @@ MLN_DRAWABLES_GL_SOURCE = [
 ]
 
 MLN_DRAWABLES_GL_HEADERS = [
-    "include/mbgl/gl/buffer_allocator.hpp",
+    "include/mbgl/gl/draw_list.hpp",
     "include/mbgl/gl/drawable_gl.hpp",
     "include/mbgl/gl/drawable_gl_builder.hpp",
     "include/mbgl/gl/dynamic_texture.hpp",
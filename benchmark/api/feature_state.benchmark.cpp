@@ -0,0 +1,125 @@
+#include <benchmark/benchmark.h>
+
+#include <mbgl/gfx/backend_scope.hpp>
+#include <mbgl/gfx/context.hpp>
+#include <mbgl/gfx/headless_frontend.hpp>
+#include <mbgl/gfx/renderer_backend.hpp>
+#include <mbgl/gfx/rendering_stats.hpp>
+#include <mbgl/map/map.hpp>
+#include <mbgl/map/map_observer.hpp>
+#include <mbgl/map/map_options.hpp>
+#include <mbgl/renderer/renderer.hpp>
+#include <mbgl/storage/network_status.hpp>
+#include <mbgl/storage/resource_options.hpp>
+#include <mbgl/style/sources/geojson_source.hpp>
+#include <mbgl/style/style.hpp>
+#include <mbgl/util/feature.hpp>
+#include <mbgl/util/run_loop.hpp>
+#include <mbgl/util/string.hpp>
+
+#include <cmath>
+#include <string>
+
+// Toggles the feature state of a number of the 10k circles of a GeoJSON source
+// once per frame and reports the frame time along with the vertex data uploaded
+// for it. Only the vertices of the toggled features should be written and
+// uploaded again.
+
+using namespace mbgl;
+
+namespace {
+
+constexpr std::size_t featureCount{10000};
+constexpr double pixelRatio{1.0};
+constexpr Size size{1000, 1000};
+
+const std::string style = R"STYLE({
+  "version": 8,
+  "sources": {
+    "points": { "type": "geojson", "data": { "type": "FeatureCollection", "features": [] } }
+  },
+  "layers": [{
+    "id": "points",
+    "type": "circle",
+    "source": "points",
+    "paint": {
+      "circle-radius": ["case", ["boolean", ["feature-state", "selected"], false], 6, 3],
+      "circle-color": ["case", ["boolean", ["feature-state", "selected"], false], "#ff0000", "#0000ff"]
+    }
+  }]
+})STYLE";
+
+mapbox::feature::feature_collection<double> grid() {
+    const auto side = static_cast<std::size_t>(std::ceil(std::sqrt(static_cast<double>(featureCount))));
+    mapbox::feature::feature_collection<double> features;
+    features.reserve(featureCount);
+    for (std::size_t i = 0; i < featureCount; ++i) {
+        mapbox::feature::feature<double> feature{mapbox::geometry::point<double>{
+            -1.0 + 2.0 * static_cast<double>(i % side) / static_cast<double>(side),
+            -1.0 + 2.0 * static_cast<double>(i / side) / static_cast<double>(side)}};
+        feature.id = static_cast<uint64_t>(i);
+        features.push_back(std::move(feature));
+    }
+    return features;
+}
+
+void toggleFeatureState(benchmark::State& state) {
+    const auto toggled = static_cast<std::size_t>(state.range(0));
+
+    util::RunLoop loop;
+    NetworkStatus::Set(NetworkStatus::Status::Offline);
+
+    HeadlessFrontend frontend{size,
+                              pixelRatio,
+                              gfx::HeadlessBackend::SwapBehaviour::NoFlush,
+                              gfx::ContextMode::Unique,
+                              std::nullopt,
+                              /*invalidateOnUpdate=*/false};
+    Map map{frontend,
+            MapObserver::nullObserver(),
+            MapOptions().withMapMode(MapMode::Continuous).withSize(size).withPixelRatio(pixelRatio),
+            ResourceOptions().withApiKey("foobar")};
+    map.getStyle().loadJSON(style);
+    map.getStyle().getSource("points")->as<style::GeoJSONSource>()->setGeoJSON(grid());
+    map.jumpTo(CameraOptions().withCenter(LatLng{0.0, 0.0}).withZoom(7.0));
+
+    frontend.renderFrame();
+    while (!map.isFullyLoaded()) {
+        loop.runOnce();
+        frontend.renderFrame();
+    }
+
+    gfx::BackendScope guard{*frontend.getBackend()};
+    auto& context = frontend.getBackend()->getContext();
+    auto* renderer = frontend.getRenderer();
+
+    bool selected = false;
+    double frameTime = 0.0;
+    std::size_t vertexBytes = 0;
+    std::size_t frames = 0;
+    while (state.KeepRunning()) {
+        selected = !selected;
+        for (std::size_t i = 0; i < toggled; ++i) {
+            const auto featureID = util::toString(static_cast<uint64_t>(i));
+            renderer->setFeatureState("points", {}, featureID, FeatureState{{"selected", selected}});
+        }
+
+        const std::size_t vertexBytesBefore = context.renderingStats().vertexUpdateBytes;
+        frontend.renderFrame();
+        vertexBytes += context.renderingStats().vertexUpdateBytes - vertexBytesBefore;
+        frameTime += frontend.getFrameTime();
+        frames++;
+    }
+
+    const auto perFrame = [&](double value) { return frames != 0 ? value / static_cast<double>(frames) : 0.0; };
+    state.counters["frame_ms"] = perFrame(frameTime) * 1000.0;
+    state.counters["vertex_upload_bytes"] = perFrame(static_cast<double>(vertexBytes));
+}
+
+} // namespace
+
+static void API_FeatureState_Toggle(benchmark::State& state) {
+    toggleFeatureState(state);
+}
+
+BENCHMARK(API_FeatureState_Toggle)->Arg(1)->Arg(100)->Arg(featureCount)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,195 @@
+#include <benchmark/benchmark.h>
+
+#include <mbgl/benchmark/memory.hpp>
+#include <mbgl/gfx/backend_scope.hpp>
+#include <mbgl/gfx/context.hpp>
+#include <mbgl/gfx/headless_frontend.hpp>
+#include <mbgl/gfx/renderer_backend.hpp>
+#include <mbgl/gfx/rendering_stats.hpp>
+#include <mbgl/map/map.hpp>
+#include <mbgl/map/map_observer.hpp>
+#include <mbgl/map/map_options.hpp>
+#include <mbgl/storage/network_status.hpp>
+#include <mbgl/storage/resource_options.hpp>
+#include <mbgl/style/image.hpp>
+#include <mbgl/style/style.hpp>
+#include <mbgl/util/image.hpp>
+#include <mbgl/util/io.hpp>
+#include <mbgl/util/run_loop.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <vector>
+
+// Replays camera paths over the benchmark styles in continuous mode and reports
+// where each frame's CPU time goes, along with its heap allocations and the
+// process' peak RSS. Run with `--benchmark_out=<file> --benchmark_out_format=json`
+// to get results that can be compared against a baseline run, e.g. with
+// Google Benchmark's `tools/compare.py`. As peak RSS covers the whole process,
+// filter down to a single benchmark to measure it for that path alone.
+
+using namespace mbgl;
+
+namespace {
+
+const std::string cachePath{"benchmark/fixtures/api/cache.db"};
+constexpr double pixelRatio{1.0};
+constexpr Size size{1000, 1000};
+constexpr int framesPerPath{60};
+const LatLng manhattan{40.726989, -73.992857};
+
+// Camera at `t`, going from 0 at the start of the path to 1 at the end.
+using CameraPath = std::function<CameraOptions(double t)>;
+
+class FrameSamples {
+public:
+    void add(const gfx::RenderingStats& stats, double frameTime, std::size_t allocations_) {
+        frame.push_back(frameTime);
+        orchestration.push_back(stats.orchestrationTime);
+        placement.push_back(stats.placementTime);
+        upload.push_back(stats.uploadTime);
+        encoding.push_back(stats.encodingTime);
+        rendering.push_back(stats.renderingTime);
+        drawCalls.push_back(stats.numDrawCalls);
+        programBinds.push_back(stats.numProgramBinds);
+        textureBinds.push_back(stats.numTextureBinds);
+        vertexArrayBinds.push_back(stats.numVertexArrayBinds);
+        allocations += allocations_;
+    }
+
+    void report(benchmark::State& state) const {
+        constexpr double ms = 1000.0;
+        state.counters["frame_mean_ms"] = mean(frame) * ms;
+        state.counters["frame_p50_ms"] = percentile(frame, 0.5) * ms;
+        state.counters["frame_p95_ms"] = percentile(frame, 0.95) * ms;
+        state.counters["frame_max_ms"] = percentile(frame, 1.0) * ms;
+        state.counters["orchestration_ms"] = mean(orchestration) * ms;
+        state.counters["placement_ms"] = mean(placement) * ms;
+        state.counters["upload_ms"] = mean(upload) * ms;
+        state.counters["encoding_ms"] = mean(encoding) * ms;
+        state.counters["rendering_ms"] = mean(rendering) * ms;
+        state.counters["draw_calls"] = mean(drawCalls);
+        state.counters["program_binds"] = mean(programBinds);
+        state.counters["texture_binds"] = mean(textureBinds);
+        state.counters["vertex_array_binds"] = mean(vertexArrayBinds);
+        state.counters["allocations_per_frame"] = frame.empty() ? 0.0
+                                                                : static_cast<double>(allocations) /
+                                                                      static_cast<double>(frame.size());
+        state.counters["peak_rss_mb"] = static_cast<double>(peakResidentSetSize()) / (1024.0 * 1024.0);
+    }
+
+private:
+    static double mean(const std::vector<double>& values) {
+        if (values.empty()) {
+            return 0.0;
+        }
+        return std::accumulate(values.begin(), values.end(), 0.0) / static_cast<double>(values.size());
+    }
+
+    static double percentile(std::vector<double> values, double p) {
+        if (values.empty()) {
+            return 0.0;
+        }
+        const auto n = static_cast<std::size_t>(p * static_cast<double>(values.size() - 1));
+        std::nth_element(values.begin(), values.begin() + n, values.end());
+        return values[n];
+    }
+
+    std::vector<double> frame;
+    std::vector<double> orchestration;
+    std::vector<double> placement;
+    std::vector<double> upload;
+    std::vector<double> encoding;
+    std::vector<double> rendering;
+    std::vector<double> drawCalls;
+    std::vector<double> programBinds;
+    std::vector<double> textureBinds;
+    std::vector<double> vertexArrayBinds;
+    std::size_t allocations = 0;
+};
+
+void replay(benchmark::State& state, const std::string& stylePath, const CameraPath& path) {
+    util::RunLoop loop;
+    NetworkStatus::Set(NetworkStatus::Status::Offline);
+
+    // Frames are rendered explicitly instead of whenever the map changes.
+    HeadlessFrontend frontend{size,
+                              pixelRatio,
+                              gfx::HeadlessBackend::SwapBehaviour::NoFlush,
+                              gfx::ContextMode::Unique,
+                              std::nullopt,
+                              /*invalidateOnUpdate=*/false};
+    Map map{frontend,
+            MapObserver::nullObserver(),
+            MapOptions().withMapMode(MapMode::Continuous).withSize(size).withPixelRatio(pixelRatio),
+            ResourceOptions().withCachePath(cachePath).withApiKey("foobar")};
+    map.getStyle().loadJSON(util::read_file(stylePath));
+    auto image = decodeImage(util::read_file("benchmark/fixtures/api/default_marker.png"));
+    map.getStyle().addImage(std::make_unique<style::Image>("test-icon", std::move(image), 1.0f));
+
+    // Load everything along the path first, so that the frames measure
+    // rendering rather than waiting on tiles.
+    for (int i = 0; i <= framesPerPath; ++i) {
+        map.jumpTo(path(static_cast<double>(i) / framesPerPath));
+        frontend.renderFrame();
+        while (!map.isFullyLoaded()) {
+            loop.runOnce();
+            frontend.renderFrame();
+        }
+    }
+
+    gfx::BackendScope guard{*frontend.getBackend()};
+    auto& context = frontend.getBackend()->getContext();
+    FrameSamples samples;
+    while (state.KeepRunning()) {
+        for (int i = 0; i <= framesPerPath; ++i) {
+            map.jumpTo(path(static_cast<double>(i) / framesPerPath));
+            loop.runOnce();
+
+            const std::size_t allocationsBefore = processAllocationCount();
+            frontend.renderFrame();
+            samples.add(context.renderingStats(),
+                        frontend.getFrameTime(),
+                        processAllocationCount() - allocationsBefore);
+        }
+    }
+    samples.report(state);
+}
+
+CameraOptions pan(double t) {
+    return CameraOptions()
+        .withCenter(LatLng{manhattan.latitude(), manhattan.longitude() - 0.015 + 0.03 * t})
+        .withZoom(15.0);
+}
+
+CameraOptions zoom(double t) {
+    return CameraOptions().withCenter(manhattan).withZoom(13.5 + 3.0 * t);
+}
+
+CameraOptions rotateAndPitch(double t) {
+    return CameraOptions().withCenter(manhattan).withZoom(15.0).withBearing(180.0 * t).withPitch(60.0 * t);
+}
+
+} // namespace
+
+static void API_FrameTime_Pan(benchmark::State& state) {
+    replay(state, "benchmark/fixtures/api/style.json", pan);
+}
+
+static void API_FrameTime_Zoom(benchmark::State& state) {
+    replay(state, "benchmark/fixtures/api/style.json", zoom);
+}
+
+static void API_FrameTime_RotateAndPitch(benchmark::State& state) {
+    replay(state, "benchmark/fixtures/api/style.json", rotateAndPitch);
+}
+
+static void API_FrameTime_Pan_FormattedLabels(benchmark::State& state) {
+    replay(state, "benchmark/fixtures/api/style_formatted_labels.json", pan);
+}
+
+BENCHMARK(API_FrameTime_Pan)->Unit(benchmark::kMillisecond);
+BENCHMARK(API_FrameTime_Zoom)->Unit(benchmark::kMillisecond);
+BENCHMARK(API_FrameTime_RotateAndPitch)->Unit(benchmark::kMillisecond);
+BENCHMARK(API_FrameTime_Pan_FormattedLabels)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,116 @@
+#include <benchmark/benchmark.h>
+
+#include <mbgl/gfx/headless_frontend.hpp>
+#include <mbgl/map/map.hpp>
+#include <mbgl/map/map_observer.hpp>
+#include <mbgl/map/map_options.hpp>
+#include <mbgl/storage/network_status.hpp>
+#include <mbgl/storage/resource_options.hpp>
+#include <mbgl/style/style.hpp>
+#include <mbgl/util/image.hpp>
+#include <mbgl/util/image_encoder.hpp>
+#include <mbgl/util/io.hpp>
+#include <mbgl/util/run_loop.hpp>
+
+#include <thread>
+#include <vector>
+
+using namespace mbgl;
+
+namespace {
+
+static std::string cachePath{"benchmark/fixtures/api/cache.db"};
+constexpr double pixelRatio{1.0};
+constexpr Size size{1000, 1000};
+
+// Renders the benchmark style once, the benchmarks only measure encoding the result
+const PremultipliedImage& renderedImage() {
+    static const PremultipliedImage image = [] {
+        NetworkStatus::Set(NetworkStatus::Status::Offline);
+        util::RunLoop loop;
+        HeadlessFrontend frontend{size, pixelRatio};
+        Map map{frontend,
+                MapObserver::nullObserver(),
+                MapOptions().withMapMode(MapMode::Static).withSize(size).withPixelRatio(pixelRatio),
+                ResourceOptions().withCachePath(cachePath).withApiKey("foobar")};
+        map.getStyle().loadJSON(util::read_file("benchmark/fixtures/api/style.json"));
+        map.jumpTo(CameraOptions().withCenter(LatLng{40.726989, -73.992857}).withZoom(15.0)); // Manhattan
+        return frontend.render(map).image;
+    }();
+    return image;
+}
+
+void encode(::benchmark::State& state, const ImageEncoderOptions& options) {
+    const auto& image = renderedImage();
+    auto encoder = ImageEncoder::create(options);
+    if (!encoder) {
+        state.SkipWithError("image encoding not supported");
+        return;
+    }
+
+    std::size_t bytes = 0;
+    for (auto _ : state) {
+        bytes = encoder->encode(image).size();
+    }
+    state.counters["bytes"] = static_cast<double>(bytes);
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * image.bytes()));
+}
+
+} // namespace
+
+static void API_encodePNG_legacy(::benchmark::State& state) {
+    const auto& image = renderedImage();
+    for (auto _ : state) {
+        ::benchmark::DoNotOptimize(encodePNG(image));
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * image.bytes()));
+}
+
+static void API_encodePNG(::benchmark::State& state) {
+    encode(state,
+           {.encoding = ImageEncoding::PNG,
+            .compressionLevel = static_cast<int>(state.range(0)),
+            .threads = static_cast<std::size_t>(state.range(1))});
+}
+
+static void API_encodeWebP(::benchmark::State& state) {
+    encode(state, {.encoding = ImageEncoding::WebP, .quality = static_cast<int>(state.range(0))});
+}
+
+static void API_encodeJPEG(::benchmark::State& state) {
+    encode(state, {.encoding = ImageEncoding::JPEG, .quality = static_cast<int>(state.range(0))});
+}
+
+// Encodes a batch of images on worker threads with an encoder each, as a tile server does while
+// the render thread moves on to the next image
+static void API_encodePNG_workers(::benchmark::State& state) {
+    const auto& image = renderedImage();
+    const auto workerCount = static_cast<std::size_t>(state.range(0));
+    constexpr std::size_t imagesPerWorker = 4;
+
+    std::vector<std::unique_ptr<ImageEncoder>> encoders;
+    for (std::size_t i = 0; i < workerCount; i++) {
+        encoders.push_back(ImageEncoder::create({.compressionLevel = 1}));
+    }
+
+    for (auto _ : state) {
+        std::vector<std::thread> workers;
+        for (auto& encoder : encoders) {
+            workers.emplace_back([&] {
+                for (std::size_t i = 0; i < imagesPerWorker; i++) {
+                    ::benchmark::DoNotOptimize(encoder->encode(image));
+                }
+            });
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * workerCount * imagesPerWorker));
+}
+
+BENCHMARK(API_encodePNG_legacy)->Unit(benchmark::kMillisecond);
+BENCHMARK(API_encodePNG)->Unit(benchmark::kMillisecond)->ArgsProduct({{1, 6}, {1, 4}});
+BENCHMARK(API_encodeWebP)->Unit(benchmark::kMillisecond)->Arg(75)->Arg(100);
+BENCHMARK(API_encodeJPEG)->Unit(benchmark::kMillisecond)->Arg(75)->Arg(90);
+BENCHMARK(API_encodePNG_workers)->Unit(benchmark::kMillisecond)->Arg(1)->Arg(4)->UseRealTime();
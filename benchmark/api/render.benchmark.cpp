@@ -15,6 +15,10 @@
 #include <mbgl/util/io.hpp>
 #include <mbgl/util/run_loop.hpp>
 
+#if MLN_RENDER_BACKEND_VULKAN
+#include <mbgl/vulkan/renderer_backend.hpp>
+#endif
+
 #include <sstream>
 #include <optional>
 
@@ -154,9 +158,32 @@ static void API_renderStill_multiple_sources(::benchmark::State& state) {
     }
 }
 
+#if MLN_RENDER_BACKEND_VULKAN
+// Pitched, so that tile layers have enough drawables to be recorded in several batches
+static void API_renderStill_recording_threads(::benchmark::State& state) {
+    RenderBenchmark bench;
+    HeadlessFrontend frontend{size, pixelRatio};
+    static_cast<vulkan::RendererBackend*>(frontend.getBackend())
+        ->setRecordingThreads(static_cast<uint32_t>(state.range(0)));
+    Map map{frontend,
+            MapObserver::nullObserver(),
+            MapOptions().withMapMode(MapMode::Static).withSize(size).withPixelRatio(pixelRatio),
+            ResourceOptions().withCachePath(cachePath).withApiKey("foobar")};
+    prepare(map);
+    map.jumpTo(CameraOptions().withZoom(13.0).withPitch(60.0));
+
+    for (auto _ : state) {
+        frontend.render(map);
+    }
+}
+#endif
+
 BENCHMARK(API_renderStill_reuse_map)->Unit(benchmark::kMillisecond)->Iterations(50);
 BENCHMARK(API_renderStill_reuse_map_formatted_labels)->Unit(benchmark::kMillisecond)->Iterations(50);
 BENCHMARK(API_renderStill_reuse_map_switch_styles)->Unit(benchmark::kMillisecond)->Iterations(50);
 BENCHMARK(API_renderStill_recreate_map)->Unit(benchmark::kMillisecond)->Iterations(50);
 BENCHMARK(API_renderStill_recreate_map_2)->Unit(benchmark::kMillisecond)->Iterations(50);
 BENCHMARK(API_renderStill_multiple_sources)->Unit(benchmark::kMillisecond)->Iterations(50);
+#if MLN_RENDER_BACKEND_VULKAN
+BENCHMARK(API_renderStill_recording_threads)->Unit(benchmark::kMillisecond)->Iterations(50)->Arg(1)->Arg(2)->Arg(4);
+#endif
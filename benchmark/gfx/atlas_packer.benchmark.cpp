@@ -0,0 +1,124 @@
+#include <benchmark/benchmark.h>
+
+#include <mbgl/gfx/atlas_packer.hpp>
+
+#include <deque>
+#include <random>
+#include <vector>
+
+using namespace mbgl;
+using namespace mbgl::gfx;
+
+namespace {
+
+constexpr std::size_t glyphsPerTile = 150;
+constexpr std::size_t liveTiles = 24;
+// Glyphs of the tiles are drawn from a set shared by all of them, as labels repeat across tiles
+constexpr int32_t glyphSetSize = 4000;
+
+struct Glyph {
+    int32_t id;
+    Size size;
+};
+
+// Padded glyph sizes of a few fonts and font sizes
+Glyph randomGlyph(std::mt19937& random) {
+    const auto id = std::uniform_int_distribution<int32_t>(0, glyphSetSize - 1)(random);
+    return {.id = id,
+            .size = {static_cast<uint32_t>(10 + (id * 7) % 20), static_cast<uint32_t>(14 + (id * 3) % 18)}};
+}
+
+} // namespace
+
+// Loads tiles while evicting the oldest ones, as when zooming through dense labels. Reports the
+// share of the atlas covered, and the uploads and pixels per tile with dirty rectangles merged as
+// dynamic textures do, against uploading every new glyph on its own.
+static void Atlas_GlyphChurn(::benchmark::State& state) {
+    const auto atlasSize = static_cast<uint32_t>(state.range(0));
+    std::mt19937 random(42);
+
+    AtlasPacker packer({atlasSize, atlasSize});
+    std::deque<std::vector<int32_t>> tiles;
+    std::vector<Rect<uint16_t>> dirty;
+
+    std::size_t tileCount = 0;
+    std::size_t failedGlyphs = 0;
+    std::size_t glyphUploads = 0;
+    std::size_t mergedUploads = 0;
+    std::size_t glyphPixels = 0;
+    std::size_t mergedPixels = 0;
+    double occupancy = 0;
+
+    for (auto _ : state) {
+        std::vector<int32_t> tile;
+        tile.reserve(glyphsPerTile);
+        for (std::size_t i = 0; i < glyphsPerTile; i++) {
+            const auto glyph = randomGlyph(random);
+            const auto* bin = packer.pack(glyph.id, glyph.size);
+            if (!bin) {
+                failedGlyphs++;
+                continue;
+            }
+            tile.push_back(glyph.id);
+            if (bin->refcount == 1) {
+                dirty.push_back(bin->rect);
+            }
+        }
+        tiles.push_back(std::move(tile));
+        if (tiles.size() > liveTiles) {
+            for (const auto id : tiles.front()) {
+                packer.unref(id);
+            }
+            tiles.pop_front();
+        }
+
+        glyphUploads += dirty.size();
+        for (const auto& rect : dirty) {
+            glyphPixels += static_cast<std::size_t>(rect.w) * rect.h;
+        }
+        const auto regions = mergeDirtyRects(std::move(dirty));
+        dirty.clear();
+        mergedUploads += regions.size();
+        for (const auto& region : regions) {
+            mergedPixels += static_cast<std::size_t>(region.w) * region.h;
+        }
+
+        occupancy += packer.getOccupancy();
+        tileCount++;
+    }
+
+    const auto tiles_ = static_cast<double>(tileCount);
+    state.counters["occupancy"] = occupancy / tiles_;
+    state.counters["failedGlyphs"] = static_cast<double>(failedGlyphs) / tiles_;
+    state.counters["glyphUploads"] = static_cast<double>(glyphUploads) / tiles_;
+    state.counters["mergedUploads"] = static_cast<double>(mergedUploads) / tiles_;
+    state.counters["glyphPixels"] = static_cast<double>(glyphPixels) / tiles_;
+    state.counters["mergedPixels"] = static_cast<double>(mergedPixels) / tiles_;
+    state.SetItemsProcessed(static_cast<int64_t>(tileCount * glyphsPerTile));
+}
+
+// Merging the rectangles updated in a frame into upload regions
+static void Atlas_MergeDirtyRects(::benchmark::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    std::mt19937 random(42);
+
+    AtlasPacker packer({2048, 2048});
+    std::vector<Rect<uint16_t>> rects;
+    for (std::size_t i = 0; i < count; i++) {
+        const auto glyph = randomGlyph(random);
+        if (const auto* bin = packer.pack(static_cast<int32_t>(i), glyph.size)) {
+            rects.push_back(bin->rect);
+        }
+    }
+
+    std::size_t regions = 0;
+    for (auto _ : state) {
+        regions = mergeDirtyRects(rects).size();
+        ::benchmark::DoNotOptimize(regions);
+    }
+    state.counters["regions"] = static_cast<double>(regions);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * rects.size()));
+}
+
+BENCHMARK(Atlas_GlyphChurn)->Arg(512)->Arg(1024)->Arg(2048);
+BENCHMARK(Atlas_MergeDirtyRects)->Arg(64)->Arg(512)->Arg(2048);
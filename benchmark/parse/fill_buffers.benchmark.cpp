@@ -0,0 +1,82 @@
+#include <benchmark/benchmark.h>
+
+#include <mbgl/benchmark/memory.hpp>
+#include <mbgl/gfx/fill_generator.hpp>
+#include <mbgl/tile/vector_mvt_tile_data.hpp>
+#include <mbgl/util/io.hpp>
+#include <mbgl/util/monotonic_arena.hpp>
+
+using namespace mbgl;
+
+namespace {
+
+std::vector<GeometryCollection> loadPolygons() {
+    VectorMVTTileData tile(
+        std::make_shared<std::string>(util::read_file("test/fixtures/api/assets/streets/10-163-395.vector.pbf")));
+
+    std::vector<GeometryCollection> polygons;
+    for (const auto& name : tile.layerNames()) {
+        if (auto layer = tile.getLayer(name)) {
+            for (std::size_t i = 0; i < layer->featureCount(); i++) {
+                auto feature = layer->getFeature(i);
+                if (feature && feature->getType() == FeatureType::Polygon) {
+                    polygons.emplace_back(feature->getGeometries().clone());
+                }
+            }
+        }
+    }
+    return polygons;
+}
+
+void generateAll(const std::vector<GeometryCollection>& polygons) {
+    gfx::VertexVector<FillLayoutVertex> fillVertices;
+    gfx::IndexVector<gfx::Triangles> fillIndexes;
+    SegmentVector fillSegments;
+    gfx::VertexVector<LineLayoutVertex> lineVertices;
+    gfx::IndexVector<gfx::Triangles> lineIndexes;
+    SegmentVector lineSegments;
+
+    for (const auto& geometry : polygons) {
+        gfx::generateFillAndOutineBuffers(
+            geometry, fillVertices, fillIndexes, fillSegments, lineVertices, lineIndexes, lineSegments);
+    }
+    benchmark::DoNotOptimize(fillIndexes.elements() + lineIndexes.elements());
+}
+
+void run(benchmark::State& state, util::MonotonicArena* arena) {
+    const auto polygons = loadPolygons();
+
+    std::size_t iterations = 0;
+    const std::size_t allocationsBefore = threadAllocationCount();
+    while (state.KeepRunning()) {
+        setCountThreadAllocations(true);
+        if (arena) {
+            util::MonotonicArena::Scope scope(*arena);
+            generateAll(polygons);
+        } else {
+            generateAll(polygons);
+        }
+        setCountThreadAllocations(false);
+        iterations++;
+    }
+
+    const std::size_t allocationCount = threadAllocationCount() - allocationsBefore;
+    state.counters["allocations"] = static_cast<double>(allocationCount) / static_cast<double>(iterations);
+    if (arena) {
+        state.counters["arena_blocks"] = static_cast<double>(arena->blockCount());
+    }
+}
+
+} // namespace
+
+static void Parse_FillBuffers_Heap(benchmark::State& state) {
+    run(state, nullptr);
+}
+
+static void Parse_FillBuffers_Arena(benchmark::State& state) {
+    util::MonotonicArena arena;
+    run(state, &arena);
+}
+
+BENCHMARK(Parse_FillBuffers_Heap);
+BENCHMARK(Parse_FillBuffers_Arena);
@@ -0,0 +1,80 @@
+#include <benchmark/benchmark.h>
+
+#include <mbgl/gfx/polyline_generator.hpp>
+#include <mbgl/renderer/buckets/line_bucket.hpp>
+#include <mbgl/tile/vector_mvt_tile_data.hpp>
+#include <mbgl/util/io.hpp>
+
+using namespace mbgl;
+
+namespace {
+
+std::vector<GeometryCollection> loadRoads() {
+    VectorMVTTileData tile(
+        std::make_shared<std::string>(util::read_file("test/fixtures/api/assets/streets/10-163-395.vector.pbf")));
+
+    std::vector<GeometryCollection> roads;
+    if (auto layer = tile.getLayer("road")) {
+        for (std::size_t i = 0; i < layer->featureCount(); i++) {
+            auto feature = layer->getFeature(i);
+            if (feature && feature->getType() == FeatureType::LineString) {
+                roads.emplace_back(feature->getGeometries().clone());
+            }
+        }
+    }
+    return roads;
+}
+
+void generateRoads(benchmark::State& state, style::LineJoinType joinType, style::LineCapType capType) {
+    const auto roads = loadRoads();
+
+    gfx::PolylineGeneratorOptions options;
+    options.joinType = joinType;
+    options.beginCap = capType;
+    options.endCap = capType;
+
+    std::size_t vertexCount = 0;
+    while (state.KeepRunning()) {
+        gfx::VertexVector<LineLayoutVertex> vertices;
+        gfx::IndexVector<gfx::Triangles> indexes;
+        SegmentVector segments;
+
+        gfx::PolylineGenerator<LineLayoutVertex, SegmentBase, &LineBucket::layoutVertex> generator(
+            vertices,
+            segments,
+            [](std::size_t vertexOffset, std::size_t indexOffset) -> SegmentBase {
+                return SegmentBase(vertexOffset, indexOffset);
+            },
+            [](auto& seg) -> SegmentBase& { return seg; },
+            indexes);
+
+        for (const auto& road : roads) {
+            for (const auto& line : road) {
+                generator.generate(line, options);
+            }
+        }
+
+        benchmark::DoNotOptimize(indexes.elements());
+        vertexCount = vertices.elements();
+    }
+
+    state.counters["vertices"] = static_cast<double>(vertexCount);
+}
+
+} // namespace
+
+static void Parse_Polyline_Miter(benchmark::State& state) {
+    generateRoads(state, style::LineJoinType::Miter, style::LineCapType::Butt);
+}
+
+static void Parse_Polyline_Round(benchmark::State& state) {
+    generateRoads(state, style::LineJoinType::Round, style::LineCapType::Round);
+}
+
+static void Parse_Polyline_Bevel(benchmark::State& state) {
+    generateRoads(state, style::LineJoinType::Bevel, style::LineCapType::Square);
+}
+
+BENCHMARK(Parse_Polyline_Miter);
+BENCHMARK(Parse_Polyline_Round);
+BENCHMARK(Parse_Polyline_Bevel);
@@ -28,3 +28,28 @@ static void Parse_VectorTile(benchmark::State& state) {
 }
 
 BENCHMARK(Parse_VectorTile);
+
+static void Parse_VectorTileStreaming(benchmark::State& state) {
+    auto data = std::make_shared<std::string>(
+        util::read_file("test/fixtures/api/assets/streets/10-163-395.vector.pbf"));
+
+    const PropertyKey nameKey("name");
+    while (state.KeepRunning()) {
+        std::size_t length = 0;
+        VectorMVTTileData tile(data);
+        for (const auto& name : tile.layerNames()) {
+            if (auto layer = tile.getLayer(name)) {
+                const std::size_t count = layer->featureCount();
+                for (std::size_t i = 0; i < count; i++) {
+                    if (auto feature = layer->getFeature(i)) {
+                        feature->visitGeometries([&](GeometryRingsView rings) { length += rings.size(); });
+                        length += feature->getValueByKey(nameKey) ? 1 : 0;
+                    }
+                }
+            }
+        }
+        (void)length;
+    }
+}
+
+BENCHMARK(Parse_VectorTileStreaming);
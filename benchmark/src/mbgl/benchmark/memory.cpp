@@ -0,0 +1,68 @@
+#include <mbgl/benchmark/memory.hpp>
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
+namespace {
+
+std::atomic<std::size_t> allocationCount{0};
+thread_local bool countOnThread = false;
+thread_local std::size_t threadCount = 0;
+
+} // namespace
+
+void* operator new(std::size_t size) {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    if (countOnThread) {
+        threadCount++;
+    }
+    if (void* p = std::malloc(size ? size : 1)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+    std::free(p);
+}
+
+namespace mbgl {
+
+std::size_t processAllocationCount() {
+    return allocationCount.load(std::memory_order_relaxed);
+}
+
+std::size_t threadAllocationCount() {
+    return threadCount;
+}
+
+void setCountThreadAllocations(bool enable) {
+    countOnThread = enable;
+}
+
+std::size_t peakResidentSetSize() {
+#if defined(__unix__) || defined(__APPLE__)
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return 0;
+    }
+#if defined(__APPLE__)
+    return static_cast<std::size_t>(usage.ru_maxrss);
+#else
+    return static_cast<std::size_t>(usage.ru_maxrss) * 1024;
+#endif
+#else
+    return 0;
+#endif
+}
+
+} // namespace mbgl
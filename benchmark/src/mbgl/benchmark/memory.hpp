@@ -0,0 +1,19 @@
+#pragma once
+
+#include <cstddef>
+
+namespace mbgl {
+
+/// Heap allocations made through `operator new` by the whole process.
+std::size_t processAllocationCount();
+
+/// Heap allocations made through `operator new` by the calling thread while
+/// counting is enabled on it.
+std::size_t threadAllocationCount();
+void setCountThreadAllocations(bool enable);
+
+/// Peak resident set size of the process in bytes, or zero where it cannot be
+/// determined.
+std::size_t peakResidentSetSize();
+
+} // namespace mbgl
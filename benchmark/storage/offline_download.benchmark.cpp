@@ -0,0 +1,114 @@
+#include <benchmark/benchmark.h>
+
+#include <mbgl/storage/http_file_source.hpp>
+#include <mbgl/storage/offline_database.hpp>
+#include <mbgl/storage/offline_download.hpp>
+#include <mbgl/storage/resource_options.hpp>
+#include <mbgl/util/client_options.hpp>
+#include <mbgl/util/run_loop.hpp>
+#include <mbgl/util/string.hpp>
+
+// Every request blocks a server thread for its simulated latency.
+#define CPPHTTPLIB_THREAD_POOL_COUNT 32
+#include <httplib.h>
+
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace mbgl;
+using namespace std::chrono_literals;
+
+namespace {
+
+// A tile host on the loopback interface that answers every request after a
+// fixed delay, standing in for a remote tile server.
+class TileHost {
+public:
+    TileHost(int port_, std::chrono::milliseconds latency, std::string style)
+        : port(port_) {
+        server.Get("/style.json", [style = std::move(style)](const httplib::Request&, httplib::Response& res) {
+            res.set_content(style, "application/json");
+        });
+        server.Get(R"(/tiles/.*)", [latency](const httplib::Request&, httplib::Response& res) {
+            std::this_thread::sleep_for(latency);
+            res.set_content(std::string(16 * 1024, 'x'), "application/x-protobuf");
+        });
+
+        thread = std::thread([this] { server.listen("127.0.0.1", port); });
+        while (!server.is_running()) {
+            std::this_thread::sleep_for(1ms);
+        }
+    }
+
+    ~TileHost() {
+        server.stop();
+        thread.join();
+    }
+
+    std::string url(const std::string& path) const { return "http://127.0.0.1:" + util::toString(port) + path; }
+
+private:
+    const int port;
+    httplib::Server server;
+    std::thread thread;
+};
+
+class StopWhenComplete : public OfflineRegionObserver {
+public:
+    void statusChanged(OfflineRegionStatus status) override {
+        if (status.complete()) {
+            util::RunLoop::Get()->stop();
+        }
+    }
+};
+
+void downloadRegion(benchmark::State& state, const std::vector<std::chrono::milliseconds>& latencies) {
+    util::RunLoop loop;
+
+    std::string tiles;
+    for (std::size_t i = 0; i < latencies.size(); i++) {
+        tiles += (i ? ", \"" : "\"") + std::string("http://127.0.0.1:") + util::toString(3100 + i) +
+                 "/tiles/{z}/{x}/{y}.pbf\"";
+    }
+    const std::string style = R"({ "version": 8, "sources": { "tiles": { "type": "vector", "tiles": [)" + tiles +
+                              R"(] } }, "layers": [] })";
+
+    std::vector<std::unique_ptr<TileHost>> hosts;
+    for (std::size_t i = 0; i < latencies.size(); i++) {
+        hosts.push_back(std::make_unique<TileHost>(static_cast<int>(3100 + i), latencies[i], style));
+    }
+
+    HTTPFileSource fileSource(ResourceOptions::Default(), ClientOptions());
+    const OfflineTilePyramidRegionDefinition definition{
+        hosts.front()->url("/style.json"), LatLngBounds::world(), 0, 4, 1.0, false};
+
+    while (state.KeepRunning()) {
+        OfflineDatabase db(":memory:", TileServerOptions::MapLibreConfiguration());
+        auto region = db.createRegion(definition, {});
+
+        OfflineDownload download(region->getID(), definition, db, fileSource);
+        download.setObserver(std::make_unique<StopWhenComplete>());
+        download.setState(OfflineRegionDownloadState::Active);
+        loop.run();
+    }
+}
+
+} // namespace
+
+static void OfflineDownload_OneHost(benchmark::State& state) {
+    downloadRegion(state, {20ms});
+}
+
+static void OfflineDownload_ThreeHosts(benchmark::State& state) {
+    downloadRegion(state, {20ms, 20ms, 20ms});
+}
+
+static void OfflineDownload_OneSlowHost(benchmark::State& state) {
+    downloadRegion(state, {20ms, 20ms, 200ms});
+}
+
+BENCHMARK(OfflineDownload_OneHost)->Unit(benchmark::kMillisecond);
+BENCHMARK(OfflineDownload_ThreeHosts)->Unit(benchmark::kMillisecond);
+BENCHMARK(OfflineDownload_OneSlowHost)->Unit(benchmark::kMillisecond);
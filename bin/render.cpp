@@ -1,17 +1,82 @@
 #include <mbgl/map/map.hpp>
 #include <mbgl/map/map_options.hpp>
 #include <mbgl/util/image.hpp>
+#include <mbgl/util/image_encoder.hpp>
 #include <mbgl/util/run_loop.hpp>
 
 #include <mbgl/gfx/backend.hpp>
 #include <mbgl/gfx/headless_frontend.hpp>
+#include <mbgl/gfx/renderer_backend.hpp>
 #include <mbgl/style/style.hpp>
 
+#if MLN_RENDER_BACKEND_VULKAN
+#include <mbgl/vulkan/renderer_backend.hpp>
+#endif
+
 #include <args.hxx>
 
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cstdio>
 #include <cstdlib>
 #include <iostream>
 #include <fstream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+
+std::string tilePath(std::string path, const mbgl::CanonicalTileID& id) {
+    const auto replace = [&](const std::string& token, uint32_t value) {
+        for (auto pos = path.find(token); pos != std::string::npos; pos = path.find(token, pos)) {
+            path.replace(pos, token.size(), std::to_string(value));
+        }
+    };
+    replace("{z}", id.z);
+    replace("{x}", id.x);
+    replace("{y}", id.y);
+    return path;
+}
+
+// Encodes and writes the tiles of a metatile on a thread per core, with an encoder each
+void writeTiles(const mbgl::HeadlessFrontend::MetatileResult& metatile,
+                const std::string& output,
+                const mbgl::ImageEncoderOptions& encoderOptions) {
+    std::atomic<std::size_t> next{0};
+    std::exception_ptr error;
+    std::mutex errorMutex;
+    const auto write = [&] {
+        try {
+            auto encoder = mbgl::ImageEncoder::create(encoderOptions);
+            for (auto i = next++; i < metatile.tiles.size(); i = next++) {
+                const auto& tile = metatile.tiles[i];
+                std::ofstream out(tilePath(output, tile.id), std::ios::binary);
+                out << encoder->encode(tile.image);
+            }
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(errorMutex);
+            error = std::current_exception();
+        }
+    };
+
+    const auto workerCount = std::min<std::size_t>(std::max(std::thread::hardware_concurrency(), 1u),
+                                                    metatile.tiles.size());
+    std::vector<std::thread> workers;
+    for (std::size_t i = 1; i < workerCount; i++) {
+        workers.emplace_back(write);
+    }
+    write();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+} // namespace
 
 int main(int argc, char* argv[]) {
     args::ArgumentParser argumentParser("MapLibre Native render tool");
@@ -24,6 +89,12 @@ int main(int argc, char* argv[]) {
     args::ValueFlag<std::string> cacheValue(argumentParser, "file", "Cache database file name", {'c', "cache"});
     args::ValueFlag<std::string> assetsValue(
         argumentParser, "file", "Directory to which asset:// URLs will resolve", {'a', "assets"});
+    args::ValueFlag<std::string> shaderCacheValue(
+        argumentParser, "directory", "Directory in which compiled shaders are kept between runs", {"shader-cache"});
+#if MLN_RENDER_BACKEND_VULKAN
+    args::ValueFlag<uint32_t> recordingThreadsValue(
+        argumentParser, "number", "Threads recording the drawables of a render pass", {"recording-threads"});
+#endif
 
     args::Flag debugFlag(argumentParser, "debug", "Debug mode", {"debug"});
 
@@ -50,6 +121,26 @@ int main(int argc, char* argv[]) {
     args::ValueFlag<std::string> mapModeValue(
         argumentParser, "MapMode", "Map mode (e.g. 'static', 'tile', 'continuous')", {'m', "mode"});
 
+    args::ValueFlag<std::string> formatValue(
+        argumentParser, "format", "Image format (png, webp or jpeg), by default from the output file name", {"format"});
+    args::ValueFlag<int> qualityValue(argumentParser, "number", "WebP and JPEG quality from 0 to 100", {"quality"});
+    args::ValueFlag<int> compressionValue(
+        argumentParser, "number", "PNG compression level from 0 to 9", {"compression"});
+    args::ValueFlag<std::size_t> encoderThreadsValue(
+        argumentParser, "number", "Threads encoding the image", {"encoder-threads"});
+
+    args::Group metatileGroup(argumentParser, "Metatile:");
+    args::ValueFlag<std::string> tileValue(metatileGroup,
+                                           "z/x/y",
+                                           "Render the block of tiles containing this tile, writing each tile to the "
+                                           "output file name with {z}, {x} and {y} replaced",
+                                           {"tile"});
+    args::ValueFlag<uint32_t> metatileValue(
+        metatileGroup, "number", "Tiles along each side of the block", {"metatile"});
+    args::ValueFlag<uint16_t> tileSizeValue(metatileGroup, "pixels", "Tile size", {"tile-size"});
+    args::ValueFlag<uint32_t> bufferValue(
+        metatileGroup, "pixels", "Margin rendered around the block for labels", {"buffer"});
+
     try {
         argumentParser.ParseCLI(argc, argv);
     } catch (const args::Help&) {
@@ -77,7 +168,8 @@ int main(int argc, char* argv[]) {
 
     const uint32_t width = widthValue ? args::get(widthValue) : 512;
     const uint32_t height = heightValue ? args::get(heightValue) : 512;
-    const std::string output = outputValue ? args::get(outputValue) : "out.png";
+    const std::string defaultOutput = tileValue ? "{z}-{x}-{y}.png" : "out.png";
+    const std::string output = outputValue ? args::get(outputValue) : defaultOutput;
     const std::string cache_file = cacheValue ? args::get(cacheValue) : "cache.sqlite";
     const std::string asset_root = assetsValue ? args::get(assetsValue) : ".";
 
@@ -89,6 +181,28 @@ int main(int argc, char* argv[]) {
 
     using namespace mbgl;
 
+    std::string format = formatValue ? args::get(formatValue) : output.substr(output.find_last_of('.') + 1);
+    std::transform(format.begin(), format.end(), format.begin(), [](unsigned char c) { return std::tolower(c); });
+
+    ImageEncoderOptions encoderOptions;
+    if (format == "webp") {
+        encoderOptions.encoding = ImageEncoding::WebP;
+    } else if (format == "jpeg" || format == "jpg") {
+        encoderOptions.encoding = ImageEncoding::JPEG;
+    } else if (format != "png" && formatValue) {
+        std::cerr << "Unsupported image format: " << format << std::endl;
+        exit(1);
+    }
+    if (qualityValue) encoderOptions.quality = args::get(qualityValue);
+    if (compressionValue) encoderOptions.compressionLevel = args::get(compressionValue);
+    if (encoderThreadsValue) encoderOptions.threads = args::get(encoderThreadsValue);
+
+    auto encoder = ImageEncoder::create(encoderOptions);
+    if (!encoder) {
+        std::cerr << "Image format " << format << " isn't supported on this platform" << std::endl;
+        exit(1);
+    }
+
     auto mapTilerConfiguration = mbgl::TileServerOptions::MapTilerConfiguration();
     std::string style = styleValue ? args::get(styleValue) : mapTilerConfiguration.defaultStyles().at(0).getUrl();
 
@@ -105,6 +219,15 @@ int main(int argc, char* argv[]) {
     }
 
     HeadlessFrontend frontend({width, height}, static_cast<float>(pixelRatio));
+    if (shaderCacheValue) {
+        frontend.getBackend()->setShaderCacheDirectory(args::get(shaderCacheValue));
+    }
+#if MLN_RENDER_BACKEND_VULKAN
+    if (recordingThreadsValue) {
+        static_cast<vulkan::RendererBackend*>(frontend.getBackend())
+            ->setRecordingThreads(args::get(recordingThreadsValue));
+    }
+#endif
     Map map(
         frontend,
         MapObserver::nullObserver(),
@@ -141,9 +264,28 @@ int main(int argc, char* argv[]) {
     }
 
     try {
-        std::ofstream out(output, std::ios::binary);
-        out << encodePNG(frontend.render(map).image);
-        out.close();
+        if (tileValue) {
+            unsigned z = 0;
+            unsigned x = 0;
+            unsigned y = 0;
+            if (std::sscanf(args::get(tileValue).c_str(), "%u/%u/%u", &z, &x, &y) != 3 || z > 30 ||
+                x >= (1u << z) || y >= (1u << z)) {
+                std::cerr << "Invalid tile: " << args::get(tileValue) << std::endl;
+                exit(1);
+            }
+            HeadlessFrontend::MetatileOptions metatileOptions;
+            if (metatileValue) metatileOptions.count = std::max(args::get(metatileValue), 1u);
+            if (tileSizeValue) metatileOptions.tileSize = args::get(tileSizeValue);
+            if (bufferValue) metatileOptions.buffer = args::get(bufferValue);
+
+            const auto count = metatileOptions.count;
+            const CanonicalTileID first{static_cast<uint8_t>(z), x - x % count, y - y % count};
+            writeTiles(frontend.renderMetatile(map, first, metatileOptions), output, encoderOptions);
+        } else {
+            std::ofstream out(output, std::ios::binary);
+            out << encoder->encode(frontend.render(map).image);
+            out.close();
+        }
     } catch (std::exception& e) {
         std::cout << "Error: " << e.what() << std::endl;
         exit(1);
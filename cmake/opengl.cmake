@@ -54,6 +54,8 @@ list(APPEND
         SRC_FILES
         ${PROJECT_SOURCE_DIR}/src/mbgl/gl/attribute.cpp
         ${PROJECT_SOURCE_DIR}/src/mbgl/gl/attribute.hpp
+        ${PROJECT_SOURCE_DIR}/src/mbgl/gl/buffer_pool.cpp
+        ${PROJECT_SOURCE_DIR}/src/mbgl/gl/buffer_pool.hpp
         ${PROJECT_SOURCE_DIR}/src/mbgl/gl/command_encoder.cpp
         ${PROJECT_SOURCE_DIR}/src/mbgl/gl/command_encoder.hpp
         ${PROJECT_SOURCE_DIR}/src/mbgl/gl/context.cpp
@@ -74,6 +76,8 @@ list(APPEND
         ${PROJECT_SOURCE_DIR}/src/mbgl/gl/object.hpp
         ${PROJECT_SOURCE_DIR}/src/mbgl/gl/offscreen_texture.cpp
         ${PROJECT_SOURCE_DIR}/src/mbgl/gl/offscreen_texture.hpp
+        ${PROJECT_SOURCE_DIR}/src/mbgl/gl/readback_queue.cpp
+        ${PROJECT_SOURCE_DIR}/src/mbgl/gl/readback_queue.hpp
         ${PROJECT_SOURCE_DIR}/src/mbgl/gl/render_pass.cpp
         ${PROJECT_SOURCE_DIR}/src/mbgl/gl/render_pass.hpp
         ${PROJECT_SOURCE_DIR}/src/mbgl/gl/renderbuffer_resource.cpp
@@ -126,7 +130,7 @@ list(APPEND INCLUDE_FILES
         ${PROJECT_SOURCE_DIR}/include/mbgl/style/layers/custom_drawable_layer.hpp
         ${PROJECT_SOURCE_DIR}/include/mbgl/layermanager/custom_drawable_layer_factory.hpp
         ${PROJECT_SOURCE_DIR}/include/mbgl/shaders/gl/shader_program_gl.hpp
-        ${PROJECT_SOURCE_DIR}/include/mbgl/gl/buffer_allocator.hpp
+        ${PROJECT_SOURCE_DIR}/include/mbgl/gl/draw_list.hpp
         ${PROJECT_SOURCE_DIR}/include/mbgl/gl/drawable_gl.hpp
         ${PROJECT_SOURCE_DIR}/include/mbgl/gl/drawable_gl_builder.hpp
         ${PROJECT_SOURCE_DIR}/include/mbgl/gl/dynamic_texture.hpp
@@ -138,13 +142,15 @@ list(APPEND INCLUDE_FILES
 list(APPEND SRC_FILES
         ${PROJECT_SOURCE_DIR}/src/mbgl/shaders/gl/shader_info.cpp
         ${PROJECT_SOURCE_DIR}/src/mbgl/shaders/gl/shader_program_gl.cpp
-        ${PROJECT_SOURCE_DIR}/src/mbgl/gl/buffer_allocator.cpp
+        ${PROJECT_SOURCE_DIR}/src/mbgl/gl/draw_list.cpp
         ${PROJECT_SOURCE_DIR}/src/mbgl/gl/drawable_gl.cpp
         ${PROJECT_SOURCE_DIR}/src/mbgl/gl/drawable_gl_builder.cpp
         ${PROJECT_SOURCE_DIR}/src/mbgl/gl/drawable_gl_impl.hpp
         ${PROJECT_SOURCE_DIR}/src/mbgl/gl/dynamic_texture.cpp
         ${PROJECT_SOURCE_DIR}/src/mbgl/gl/layer_group_gl.cpp
         ${PROJECT_SOURCE_DIR}/src/mbgl/gl/texture2d.cpp
+        ${PROJECT_SOURCE_DIR}/src/mbgl/gl/uniform_arena_gl.cpp
+        ${PROJECT_SOURCE_DIR}/src/mbgl/gl/uniform_arena_gl.hpp
         ${PROJECT_SOURCE_DIR}/src/mbgl/gl/uniform_buffer_gl.cpp
         ${PROJECT_SOURCE_DIR}/src/mbgl/gl/vertex_attribute_gl.cpp
 )
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <mbgl/util/rect.hpp>
+#include <mbgl/util/size.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace mbgl {
+namespace gfx {
+
+/// Packs rectangles into shelves, rows of the atlas as high as the first rectangle placed in them.
+/// Released rectangles leave free spans in their shelf, which are merged with adjacent ones and
+/// reused for later rectangles of similar height. Shelves left empty are merged with empty shelves
+/// next to them, or handed back to the unused space at the bottom of the atlas, so that space freed
+/// by one kind of content can be reused by another. Rectangles never move, as their positions are
+/// baked into the buckets using them.
+class AtlasPacker {
+public:
+    struct Bin {
+        int32_t id = 0;
+        Rect<uint16_t> rect;
+        uint32_t refcount = 0;
+    };
+
+    explicit AtlasPacker(Size size);
+
+    /// Places a rectangle, or adds a reference to the one already packed with the same id.
+    /// Returns null if the atlas has no room for it.
+    const Bin* pack(int32_t id, Size size);
+    const Bin* getBin(int32_t id) const;
+    /// Releases a reference, freeing the space once none remain. Returns the remaining references.
+    uint32_t unref(int32_t id);
+
+    Size getSize() const { return size; }
+    std::size_t getBinCount() const { return bins.size(); }
+    std::size_t getShelfCount() const { return shelves.size(); }
+    /// Pixels covered by packed rectangles
+    std::size_t getUsedArea() const { return usedArea; }
+    /// Share of the atlas covered by packed rectangles
+    double getOccupancy() const;
+
+private:
+    struct Shelf {
+        uint16_t y = 0;
+        uint16_t h = 0;
+        // Widths of the free spans, by x
+        std::map<uint16_t, uint16_t> freeSpans;
+        std::size_t binCount = 0;
+    };
+
+    // Takes the first free span wide enough, if any
+    static std::optional<Rect<uint16_t>> packInShelf(Shelf&, Size);
+    // Finds room for a new shelf, returning its index
+    std::optional<std::size_t> openShelf(uint16_t height);
+    void release(const Rect<uint16_t>&);
+
+    Size size;
+    // Sorted by y, the space below the last one is unused
+    std::vector<Shelf> shelves;
+    std::unordered_map<int32_t, Bin> bins;
+    std::size_t usedArea = 0;
+};
+
+/// Merges the rectangles updated in an atlas into fewer upload regions. Two regions are merged if
+/// the pixels between them, which are uploaded as well, don't exceed `uploadCost`, the pixels
+/// worth an upload call of its own. By default, only regions that exactly cover their merged
+/// region are merged, for uploads that have no pixels to fill the space in between with.
+std::vector<Rect<uint16_t>> mergeDirtyRects(std::vector<Rect<uint16_t>> rects, std::size_t uploadCost = 0);
+
+} // namespace gfx
+} // namespace mbgl
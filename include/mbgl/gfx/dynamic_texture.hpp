@@ -1,13 +1,13 @@
 #pragma once
 
+#include <mbgl/gfx/atlas_packer.hpp>
 #include <mbgl/gfx/types.hpp>
 #include <mbgl/util/image.hpp>
 #include <mbgl/util/rect.hpp>
 
-#include <mapbox/shelf-pack.hpp>
-
 #include <optional>
 #include <mutex>
+#include <vector>
 
 namespace mbgl {
 namespace gfx {
@@ -18,10 +18,10 @@ using Texture2DPtr = std::shared_ptr<Texture2D>;
 
 class TextureHandle {
 public:
-    TextureHandle(const mapbox::Bin& bin)
+    TextureHandle(const AtlasPacker::Bin& bin)
         : id(bin.id),
-          rectangle(bin.x, bin.y, bin.w, bin.h),
-          needsUpload(bin.refcount() == 1) {};
+          rectangle(bin.rect),
+          needsUpload(bin.refcount == 1) {};
     ~TextureHandle() = default;
 
     int32_t getId() const { return id; }
@@ -63,11 +63,31 @@ public:
     virtual void uploadDeferredImages() {};
     virtual bool removeTexture(const TextureHandle& texHandle);
 
+    /// Share of the texture covered by images
+    double getOccupancy() const;
+
 protected:
-    mapbox::ShelfPack shelfPack;
+    struct StagedRegion {
+        Rect<uint16_t> rect;
+        /// Row after row
+        std::vector<uint8_t> pixels;
+    };
+
+    /// Copies an image to be uploaded with the images next to it. Images staged before in the same
+    /// space were removed since, and are dropped.
+    void stageImage(const uint8_t* pixelData, const Rect<uint16_t>& rect);
+    /// Regions of the texture covered by staged images next to each other, to upload them with as few
+    /// uploads as possible. Releases the staged images.
+    std::vector<StagedRegion> takeStagedRegions();
+
+    AtlasPacker packer;
     Texture2DPtr texture;
     int numTextures = 0;
     std::mutex mutex;
+
+private:
+    // Images waiting for `uploadDeferredImages`, there is no copy of the texture's contents
+    std::vector<StagedRegion> stagedImages;
 };
 
 } // namespace gfx
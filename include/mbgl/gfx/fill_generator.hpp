@@ -24,6 +24,13 @@ void generateFillAndOutineBuffers(const GeometryCollection& geometry,
                                   gfx::IndexVector<gfx::Lines>& lineIndexes,
                                   SegmentVector& lineSegments);
 
+void generateFillAndOutineBuffers(GeometryRingsView geometry,
+                                  gfx::VertexVector<FillLayoutVertex>& vertices,
+                                  gfx::IndexVector<gfx::Triangles>& fillIndexes,
+                                  SegmentVector& fillSegments,
+                                  gfx::IndexVector<gfx::Lines>& lineIndexes,
+                                  SegmentVector& lineSegments);
+
 /// Generate fill and outline buffers, where the outlines are built with triangle primitives
 void generateFillAndOutineBuffers(const GeometryCollection& geometry,
                                   gfx::VertexVector<FillLayoutVertex>& fillVertices,
@@ -44,5 +51,15 @@ void generateFillAndOutineBuffers(const GeometryCollection& geometry,
                                   gfx::IndexVector<gfx::Lines>& basicLineIndexes,
                                   SegmentVector& basicLineSegments);
 
+void generateFillAndOutineBuffers(GeometryRingsView geometry,
+                                  gfx::VertexVector<FillLayoutVertex>& fillVertices,
+                                  gfx::IndexVector<gfx::Triangles>& fillIndexes,
+                                  SegmentVector& fillSegments,
+                                  gfx::VertexVector<LineLayoutVertex>& lineVertices,
+                                  gfx::IndexVector<gfx::Triangles>& lineIndexes,
+                                  SegmentVector& lineSegments,
+                                  gfx::IndexVector<gfx::Lines>& basicLineIndexes,
+                                  SegmentVector& basicLineSegments);
+
 } // namespace gfx
 } // namespace mbgl
@@ -13,6 +13,8 @@
 #include <vector>
 #include <functional>
 #include <optional>
+#include <span>
+#include <type_traits>
 
 namespace mbgl {
 namespace gfx {
@@ -44,31 +46,40 @@ struct PolylineGeneratorOptions {
     std::optional<PolylineGeneratorDistances> clipDistances;
 };
 
-template <class PolylineLayoutVertex, class PolylineSegment>
+/// Builds the triangle strip geometry of a line, including joins and caps.
+///
+/// The layout vertex function is a template argument so that it is inlined into
+/// the per-vertex code. Segments are created at most once per line, so those
+/// callbacks stay type-erased.
+template <class PolylineLayoutVertex, class PolylineSegment, auto layoutVertex>
 class PolylineGenerator {
 public:
     using Vertices = gfx::VertexVector<PolylineLayoutVertex>;
     using Segments = std::vector<PolylineSegment>;
-    using LayoutVertexFunc = std::function<PolylineLayoutVertex(
-        Point<int16_t> p, Point<double> e, bool round, bool up, int8_t dir, int32_t linesofar /*= 0*/)>;
     using CreateSegmentFunc = std::function<PolylineSegment(std::size_t vertexOffset, std::size_t indexOffset)>;
     using GetSegmentFunc = std::function<mbgl::SegmentBase&(PolylineSegment& segment)>;
     using Indexes = gfx::IndexVector<gfx::Triangles>;
 
+    static_assert(std::is_invocable_r_v<PolylineLayoutVertex,
+                                        decltype(layoutVertex),
+                                        Point<int16_t> /*p*/,
+                                        Point<double> /*e*/,
+                                        bool /*round*/,
+                                        bool /*up*/,
+                                        int8_t /*dir*/,
+                                        int32_t /*linesofar*/>);
+
 public:
     PolylineGenerator(Vertices& polylineVertices,
-                      LayoutVertexFunc layoutVertexFunc,
                       Segments& polylineSegments,
                       CreateSegmentFunc createSegmentFunc,
                       GetSegmentFunc getSegmentFunc,
                       Indexes& polylineIndexes);
     ~PolylineGenerator() = default;
 
-    void generate(const GeometryCoordinates& coordinates, const PolylineGeneratorOptions& options);
+    void generate(std::span<const GeometryCoordinate> coordinates, const PolylineGeneratorOptions& options);
 
 private:
-    struct TriangleElement;
-
     void addCurrentVertex(const GeometryCoordinate& currentCoordinate,
                           double& distance,
                           const Point<double>& normal,
@@ -76,19 +87,17 @@ private:
                           double endRight,
                           bool round,
                           std::size_t startVertex,
-                          std::vector<TriangleElement>& triangleStore,
-                          std::optional<PolylineGeneratorDistances> lineDistances);
+                          const PolylineGeneratorDistances* lineDistances);
     void addPieSliceVertex(const GeometryCoordinate& currentVertex,
                            double distance,
                            const Point<double>& extrude,
                            bool lineTurnsLeft,
                            std::size_t startVertex,
-                           std::vector<TriangleElement>& triangleStore,
-                           std::optional<PolylineGeneratorDistances> lineDistances);
+                           const PolylineGeneratorDistances* lineDistances);
+    void addTriangle();
 
 private:
     Vertices& vertices;
-    LayoutVertexFunc layoutVertex;
     Segments& segments;
     CreateSegmentFunc createSegment;
     GetSegmentFunc getSegment;
@@ -5,6 +5,7 @@
 
 #include <memory>
 #include <mutex>
+#include <string>
 
 namespace mbgl {
 
@@ -52,6 +53,17 @@ public:
 
     /// One-time shader initialization
     virtual void initShaders(gfx::ShaderRegistry&, const ProgramParameters&) = 0;
+
+    /// Directory in which compiled shader programs are kept between runs, so that they are only
+    /// compiled the first time. Set it before the first frame, the cache is off while it's empty.
+    void setShaderCacheDirectory(std::string directory) { shaderCacheDirectory = std::move(directory); }
+    const std::string& getShaderCacheDirectory() const { return shaderCacheDirectory; }
+
+    /// Whether the renderers on this backend share their shader programs and static buffers. Only
+    /// for backends whose renderers take turns on the context, like that of a `HeadlessRenderPool`.
+    void setSharedStaticData(bool shared) { sharedStaticData = shared; }
+    bool hasSharedStaticData() const { return sharedStaticData; }
+
     const mbgl::util::SimpleIdentity uniqueID;
 
 protected:
@@ -76,6 +88,8 @@ protected:
     const ContextMode contextMode;
     std::once_flag initialized;
     TaggedScheduler threadPool;
+    std::string shaderCacheDirectory;
+    bool sharedStaticData = false;
 
     friend class BackendScope;
 };
@@ -21,6 +21,12 @@ struct RenderingStats {
     double encodingTime = 0.0;
     /// Frame CPU rendering time (seconds)
     double renderingTime = 0.0;
+    /// Part of the encoding time spent building the render tree, including placement (seconds)
+    double orchestrationTime = 0.0;
+    /// Part of the orchestration time spent on symbol placement (seconds)
+    double placementTime = 0.0;
+    /// Part of the encoding time spent in upload passes and layer group updates (seconds)
+    double uploadTime = 0.0;
 
     /// Number of frames rendered
     int numFrames = 0;
@@ -28,6 +34,8 @@ struct RenderingStats {
     int numDrawCalls = 0;
     /// Total number of draw calls executed during all the frames
     int totalDrawCalls = 0;
+    /// Total number of batches of drawables recorded in parallel, into command buffers of their own
+    std::size_t numParallelRecordedBatches = 0;
 
     /// Total number of textures created
     int numCreatedTextures = 0;
@@ -66,6 +74,19 @@ struct RenderingStats {
     /// Sum of vertex buffers update sizes
     std::size_t vertexUpdateBytes = 0;
 
+    /// Number of active vertex and index buffers sub-allocated from shared buffers
+    int numPooledBuffers = 0;
+    /// Number of shared buffers vertex and index buffers are sub-allocated from
+    int numBufferPages = 0;
+    /// Total memory of the shared buffers
+    int memBufferPages = 0;
+    /// Number of vertex array bindings during the most recent frame
+    int numVertexArrayBinds = 0;
+    /// Number of shader program changes between draw calls during the most recent frame
+    int numProgramBinds = 0;
+    /// Number of textures bound for draw calls during the most recent frame
+    int numTextureBinds = 0;
+
     /// Number of active uniform buffers
     int numUniformBuffers = 0;
     /// Number of times a uniform buffer is updated
@@ -89,6 +110,20 @@ struct RenderingStats {
     /// Number of stencil buffer updates
     int stencilUpdates = 0;
 
+    /// Total number of tile parses abandoned part-way because the tile was dropped or left the view
+    std::size_t numAbandonedTileParses = 0;
+    /// Total number of tile parses skipped because the tile was dropped or left the view before they started
+    std::size_t numSkippedTileParses = 0;
+    /// Total worker time spent on abandoned tile parses before they were cancelled (seconds)
+    double abandonedTileParseTime = 0.0;
+
+    /// Total number of label shapings served from the shaping cache shared by all maps
+    std::size_t numShapingCacheHits = 0;
+    /// Total number of label shapings that missed the shaping cache and were laid out from scratch
+    std::size_t numShapingCacheMisses = 0;
+    /// Number of shapings held by the shaping cache
+    std::size_t shapingCacheSize = 0;
+
     RenderingStats& operator+=(const RenderingStats&);
 
 #ifndef NDEBUG
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <mbgl/gfx/drawable.hpp>
+#include <mbgl/tile/tile_id.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace mbgl {
+
+namespace gl {
+
+class DrawableGL;
+
+/// The drawables a layer group draws in a render pass, in the order they are submitted in.
+/// They're drawn as one batch with `DrawableGL::Bindings`, so the order decides how many bindings
+/// change between draw calls.
+class DrawList {
+public:
+    void clear();
+
+    /// Adds a drawable after those added before
+    void add(DrawableGL&);
+
+    /// Groups the drawables by program and textures, so that fewer bindings change between them.
+    /// Only drawables of different tiles swap places, the drawables of a tile keep their order.
+    /// This requires the drawables to be clipped to their tiles, so that no two of them overlap.
+    void sort();
+
+    template <typename Func /* void(DrawableGL&) */>
+    void visitDrawables(Func f) const {
+        for (const auto& entry : entries) {
+            f(*entry.drawable);
+        }
+    }
+
+    bool empty() const { return entries.empty(); }
+    std::size_t size() const { return entries.size(); }
+    const DrawableGL& operator[](std::size_t index) const { return *entries[index].drawable; }
+
+private:
+    struct Entry {
+        DrawableGL* drawable;
+        gfx::DrawPriority priority;
+        /// Index among the drawables of its tile
+        std::size_t tileIndex;
+        std::uintptr_t shader;
+        std::size_t textures;
+    };
+
+    std::vector<Entry> entries;
+    std::unordered_map<OverscaledTileID, std::size_t> tileCounts;
+};
+
+} // namespace gl
+} // namespace mbgl
@@ -4,7 +4,9 @@
 #include <mbgl/gfx/draw_mode.hpp>
 #include <mbgl/gl/vertex_array.hpp>
 #include <mbgl/gl/vertex_attribute_gl.hpp>
+#include <mbgl/shaders/shader_defines.hpp>
 
+#include <bitset>
 #include <memory>
 
 namespace mbgl {
@@ -24,6 +26,7 @@ using UniqueVertexBufferResource = std::unique_ptr<VertexBufferResource>;
 
 namespace gl {
 
+class Context;
 class Texture2D;
 class VertexArray;
 
@@ -34,6 +37,20 @@ public:
 
     void draw(PaintParameters&) const override;
 
+    /// The bindings a batch of drawables leaves behind, restored with `unbind` after the batch
+    struct Bindings {
+        int32_t textureUnits = 0;
+        std::bitset<shaders::maxUBOCountPerShader> uniformBuffers;
+        const DrawableGL* last = nullptr;
+    };
+
+    /// Draws as part of a batch, leaving the bindings for the drawable after it. Textures the
+    /// previous drawable left bound are kept if it used the same program.
+    void draw(PaintParameters&, Bindings&) const;
+
+    /// Restores the default bindings after a batch
+    static void unbind(PaintParameters&, const Bindings&);
+
     struct DrawSegmentGL;
     void setIndexData(gfx::IndexVectorBasePtr, std::vector<UniqueDrawSegment> segments) override;
 
@@ -66,7 +83,9 @@ private:
 
     void uploadTextures() const;
 
-    void bindTextures() const;
+    bool bindProgram(gl::Context&) const;
+    /// Returns the number of texture units bound
+    int32_t bindTextures(gl::Context&, bool keepBound) const;
     void unbindTextures() const;
 };
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <mbgl/renderer/layer_group.hpp>
+#include <mbgl/gl/draw_list.hpp>
 #include <mbgl/gl/uniform_buffer_gl.hpp>
 
 namespace mbgl {
@@ -26,6 +27,7 @@ public:
 
 protected:
     UniformBufferArrayGL uniformBuffers;
+    DrawList drawList;
 };
 
 /**
@@ -61,6 +61,11 @@ public:
     /// @brief Unbind the texture, if it was bound
     void unbind() noexcept;
 
+    /// @brief Check whether the texture is still bound the way `bind` left it
+    /// @param location Location index of texture sampler in the current shader
+    /// @param textureUnit Unit the texture was bound to
+    bool isBound(int32_t location, int32_t textureUnit) const noexcept;
+
 private:
     void allocateTexture() noexcept;
     void updateTextureData(const void* data = nullptr) noexcept;
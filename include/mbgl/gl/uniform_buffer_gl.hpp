@@ -1,8 +1,8 @@
 #pragma once
 
+#include <mbgl/gfx/uniform_arena.hpp>
 #include <mbgl/gfx/uniform_buffer.hpp>
 #include <mbgl/gl/types.hpp>
-#include <mbgl/gl/buffer_allocator.hpp>
 
 namespace mbgl {
 namespace gl {
@@ -11,15 +11,15 @@ class UniformBufferGL final : public gfx::UniformBuffer {
     UniformBufferGL(const UniformBufferGL&);
 
 public:
-    UniformBufferGL(Context& context, const void* data, std::size_t size_, IBufferAllocator& allocator);
+    UniformBufferGL(Context& context, const void* data, std::size_t size_, gfx::UniformArena& arena);
     ~UniformBufferGL() override;
 
     UniformBufferGL(UniformBufferGL&& rhs) noexcept;
     UniformBufferGL& operator=(const UniformBufferGL& rhs) = delete;
 
+    /// The arena's buffer, which must be queried after the binding offset
     BufferID getID() const;
-    gl::RelocatableBuffer<UniformBufferGL>& getManagedBuffer() noexcept { return managedBuffer; }
-    const gl::RelocatableBuffer<UniformBufferGL>& getManagedBuffer() const noexcept { return managedBuffer; }
+    std::size_t getBindingOffset() const { return block.getBindingOffset(); }
 
     UniformBufferGL clone() const { return {*this}; }
 
@@ -30,16 +30,12 @@ private:
     Context& context;
 
     // unique id used for debugging and profiling purposes
-    // localID should not be used as unique id because a const buffer pool is managed using IBufferAllocator
     // Currently unique IDs for constant buffers are only used when Tracy profiling is enabled
 #ifdef MLN_TRACY_ENABLE
     int64_t uniqueDebugId = -1;
 #endif
 
-    // If the requested UBO size is too large for the allocator, the UBO will manage its own allocation
-    bool isManagedAllocation = false;
-    BufferID localID;
-    gl::RelocatableBuffer<UniformBufferGL> managedBuffer;
+    gfx::UniformArena::Block block;
 
     friend class UniformBufferArrayGL;
 };
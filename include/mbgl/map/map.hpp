@@ -21,6 +21,7 @@
 #include <vector>
 #include <memory>
 #include <optional>
+#include <utility>
 
 namespace mbgl {
 
@@ -133,6 +134,12 @@ public:
     void updateAnnotation(AnnotationID, const Annotation&);
     void removeAnnotation(AnnotationID);
 
+    /// Batched variants of the above, for adding, moving or removing many
+    /// annotations at once. Only the tiles the changes touch are rebuilt.
+    AnnotationIDs addAnnotations(const std::vector<Annotation>&);
+    void updateAnnotations(const std::vector<std::pair<AnnotationID, Annotation>>&);
+    void removeAnnotations(const AnnotationIDs&);
+
     // Tile prefetching
     //
     /// When loading a map, if `PrefetchZoomDelta` is set to any number greater
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace mbgl {
+
+/// CPU time spent on one rendered frame, broken down into the phases of the
+/// renderer and into the sources and layers they worked on.
+///
+/// Phases nest: the time of a phase includes the time of its children, see
+/// `parent()`. All times are in seconds.
+struct FrameProfile {
+    enum class Phase : uint8_t {
+        /// The whole frame, from building the render tree to presenting it
+        Frame,
+        /// Building the render tree
+        Orchestration,
+        /// Evaluating layer properties for the current zoom and transitions
+        UpdateLayers,
+        /// Updating the tile pyramids of the sources
+        UpdateSources,
+        /// Preparing the sources' tiles for rendering
+        PrepareSources,
+        /// Preparing the layers for rendering
+        PrepareLayers,
+        /// Symbol placement
+        Placement,
+        /// Upload passes and layer group updates
+        Upload,
+        /// Encoding the render passes
+        Encoding,
+        /// Submitting the encoded commands
+        Rendering,
+    };
+    static constexpr std::size_t PhaseCount = static_cast<std::size_t>(Phase::Rendering) + 1;
+
+    /// The phase that contains `phase`, or nothing for `Phase::Frame`.
+    static std::optional<Phase> parent(Phase phase);
+    static const char* name(Phase phase);
+
+    struct SourceCounters {
+        std::string id;
+        double updateTime = 0.0;
+        double prepareTime = 0.0;
+        /// Tiles the source had for rendering after preparing
+        std::size_t renderTiles = 0;
+    };
+
+    struct LayerCounters {
+        std::string id;
+        double evaluateTime = 0.0;
+        double prepareTime = 0.0;
+    };
+
+    /// Number of the frame since the renderer was created
+    uint64_t frame = 0;
+    std::array<double, PhaseCount> phases{};
+    std::vector<SourceCounters> sources;
+    std::vector<LayerCounters> layers;
+
+    double duration(Phase phase) const { return phases[static_cast<std::size_t>(phase)]; }
+};
+
+} // namespace mbgl
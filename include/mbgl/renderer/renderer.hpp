@@ -1,5 +1,6 @@
 #pragma once
 
+#include <mbgl/renderer/frame_profile.hpp>
 #include <mbgl/renderer/query.hpp>
 #include <mbgl/annotation/annotation.hpp>
 #include <mbgl/util/geo.hpp>
@@ -107,6 +108,21 @@ public:
      */
     const std::vector<PlacedSymbolData>& getPlacedSymbolsData() const;
 
+    // Profiling
+    /**
+     * @brief Enables or disables recording the CPU time spent on each frame,
+     * per phase, source and layer.
+     *
+     * Recorded frames are reported to `RendererObserver::onDidProfileFrame()`,
+     * and the most recent ones are kept for `getFrameProfiles()`. Profiling is
+     * disabled by default.
+     */
+    void setFrameProfilingEnabled(bool);
+    bool isFrameProfilingEnabled() const;
+
+    /// Frames recorded while profiling was enabled, oldest first.
+    std::vector<FrameProfile> getFrameProfiles() const;
+
     // Memory
     void setTileCacheEnabled(bool);
     bool getTileCacheEnabled() const;
@@ -3,6 +3,7 @@
 #include <mbgl/tile/tile_id.hpp>
 #include <mbgl/util/font_stack.hpp>
 #include <mbgl/gfx/rendering_stats.hpp>
+#include <mbgl/renderer/frame_profile.hpp>
 #include <mbgl/text/glyph_range.hpp>
 #include <mbgl/tile/tile_operation.hpp>
 #include <mbgl/gfx/backend.hpp>
@@ -59,6 +60,9 @@ public:
         onDidFinishRenderingFrame(mode, repaint, placementChanged, stats.encodingTime, stats.renderingTime);
     }
 
+    /// End of frame, while frame profiling is enabled with `Renderer::setFrameProfilingEnabled()`
+    virtual void onDidProfileFrame(const FrameProfile&) {}
+
     /// Final frame
     virtual void onDidFinishRenderingMap() {}
 
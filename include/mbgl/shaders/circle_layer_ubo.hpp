@@ -1,6 +1,8 @@
 #pragma once
 
 #include <mbgl/shaders/layer_ubo.hpp>
+#include <mbgl/util/bitmask_operations.hpp>
+#include <mbgl/gfx/gpu_expression.hpp>
 
 namespace mbgl {
 namespace shaders {
@@ -24,6 +26,29 @@ struct alignas(16) CircleDrawableUBO {
 };
 static_assert(sizeof(CircleDrawableUBO) == 7 * 16);
 
+/// Expression properties that do not depend on the tile
+enum class CircleExpressionMask : uint32_t {
+    None = 0,
+    Color = 1 << 0,
+    Radius = 1 << 1,
+    Blur = 1 << 2,
+    Opacity = 1 << 3,
+    StrokeColor = 1 << 4,
+    StrokeWidth = 1 << 5,
+    StrokeOpacity = 1 << 6,
+};
+
+struct alignas(16) CircleExpressionUBO {
+    gfx::GPUExpression color;
+    gfx::GPUExpression radius;
+    gfx::GPUExpression blur;
+    gfx::GPUExpression opacity;
+    gfx::GPUExpression stroke_color;
+    gfx::GPUExpression stroke_width;
+    gfx::GPUExpression stroke_opacity;
+};
+static_assert(sizeof(CircleExpressionUBO) % 16 == 0);
+
 /// Evaluated properties that do not depend on the tile
 struct alignas(16) CircleEvaluatedPropsUBO {
     /*  0 */ Color color;
@@ -35,7 +60,7 @@ struct alignas(16) CircleEvaluatedPropsUBO {
     /* 48 */ float stroke_opacity;
     /* 52 */ int scale_with_map;
     /* 56 */ int pitch_with_map;
-    /* 60 */ float pad1;
+    /* 60 */ CircleExpressionMask expressionMask;
     /* 64 */
 };
 static_assert(sizeof(CircleEvaluatedPropsUBO) == 4 * 16);
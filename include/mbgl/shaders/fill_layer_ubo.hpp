@@ -1,6 +1,8 @@
 #pragma once
 
 #include <mbgl/shaders/layer_ubo.hpp>
+#include <mbgl/util/bitmask_operations.hpp>
+#include <mbgl/gfx/gpu_expression.hpp>
 
 namespace mbgl {
 namespace shaders {
@@ -102,6 +104,21 @@ struct alignas(16) FillOutlineTriangulatedDrawableUBO {
 };
 static_assert(sizeof(FillOutlineTriangulatedDrawableUBO) == 5 * 16);
 
+/// Expression properties that do not depend on the tile
+enum class FillExpressionMask : uint32_t {
+    None = 0,
+    Color = 1 << 0,
+    Opacity = 1 << 1,
+    OutlineColor = 1 << 2,
+};
+
+struct alignas(16) FillExpressionUBO {
+    gfx::GPUExpression color;
+    gfx::GPUExpression opacity;
+    gfx::GPUExpression outline_color;
+};
+static_assert(sizeof(FillExpressionUBO) % 16 == 0);
+
 /// Evaluated properties that do not depend on the tile
 struct alignas(16) FillEvaluatedPropsUBO {
     /*  0 */ Color color;
@@ -110,9 +127,13 @@ struct alignas(16) FillEvaluatedPropsUBO {
     /* 36 */ float fade;
     /* 40 */ float from_scale;
     /* 44 */ float to_scale;
-    /* 48 */
+    /* 48 */ FillExpressionMask expressionMask;
+    /* 52 */ float pad1;
+    /* 56 */ float pad2;
+    /* 60 */ float pad3;
+    /* 64 */
 };
-static_assert(sizeof(FillEvaluatedPropsUBO) == 3 * 16);
+static_assert(sizeof(FillEvaluatedPropsUBO) == 4 * 16);
 
 #if MLN_UBO_CONSOLIDATION
 
@@ -12,6 +12,7 @@ constexpr auto circleShaderPrelude = R"(
 enum {
     idCircleDrawableUBO = idDrawableReservedVertexOnlyUBO,
     idCircleEvaluatedPropsUBO = drawableReservedUBOCount,
+    idCircleExpressionUBO,
     circleUBOCount
 };
 
@@ -34,6 +35,30 @@ struct alignas(16) CircleDrawableUBO {
 };
 static_assert(sizeof(CircleDrawableUBO) == 7 * 16, "wrong size");
 
+/// Expression properties that do not depend on the tile
+enum class CircleExpressionMask : uint32_t {
+    None = 0,
+    Color = 1 << 0,
+    Radius = 1 << 1,
+    Blur = 1 << 2,
+    Opacity = 1 << 3,
+    StrokeColor = 1 << 4,
+    StrokeWidth = 1 << 5,
+    StrokeOpacity = 1 << 6,
+};
+bool operator&(CircleExpressionMask a, CircleExpressionMask b) { return (uint32_t)a & (uint32_t)b; }
+
+struct alignas(16) CircleExpressionUBO {
+    GPUExpression color;
+    GPUExpression radius;
+    GPUExpression blur;
+    GPUExpression opacity;
+    GPUExpression stroke_color;
+    GPUExpression stroke_width;
+    GPUExpression stroke_opacity;
+};
+static_assert(sizeof(CircleExpressionUBO) % 16 == 0, "wrong alignment");
+
 /// Evaluated properties that do not depend on the tile
 struct alignas(16) CircleEvaluatedPropsUBO {
     /*  0 */ float4 color;
@@ -45,7 +70,7 @@ struct alignas(16) CircleEvaluatedPropsUBO {
     /* 48 */ float stroke_opacity;
     /* 52 */ int scale_with_map;
     /* 56 */ int pitch_with_map;
-    /* 60 */ float pad1;
+    /* 60 */ CircleExpressionMask expressionMask;
     /* 64 */
 };
 static_assert(sizeof(CircleEvaluatedPropsUBO) == 4 * 16, "wrong size");
@@ -123,18 +148,21 @@ FragmentStage vertex vertexMain(thread const VertexStage vertx [[stage_in]],
                                 device const GlobalPaintParamsUBO& paintParams [[buffer(idGlobalPaintParamsUBO)]],
                                 device const uint32_t& uboIndex [[buffer(idGlobalUBOIndex)]],
                                 device const CircleDrawableUBO* drawableVector [[buffer(idCircleDrawableUBO)]],
-                                device const CircleEvaluatedPropsUBO& props [[buffer(idCircleEvaluatedPropsUBO)]]) {
+                                device const CircleEvaluatedPropsUBO& props [[buffer(idCircleEvaluatedPropsUBO)]],
+                                device const CircleExpressionUBO& expr [[buffer(idCircleExpressionUBO)]]) {
 
     device const CircleDrawableUBO& drawable = drawableVector[uboIndex];
 
 #if defined(HAS_UNIFORM_u_radius)
-    const auto radius       = props.radius;
+    const auto exprRadius   = (props.expressionMask & CircleExpressionMask::Radius);
+    const auto radius       = exprRadius ? expr.radius.eval(paintParams.map_zoom) : props.radius;
 #else
     const auto radius       = unpack_mix_float(vertx.radius, drawable.radius_t);
 #endif
 
 #if defined(HAS_UNIFORM_u_stroke_width)
-    const auto stroke_width = props.stroke_width;
+    const auto exprStrokeWidth = (props.expressionMask & CircleExpressionMask::StrokeWidth);
+    const auto stroke_width = exprStrokeWidth ? expr.stroke_width.eval(paintParams.map_zoom) : props.stroke_width;
 #else
     const auto stroke_width = unpack_mix_float(vertx.stroke_width, drawable.stroke_width_t);
 #endif
@@ -203,43 +231,54 @@ FragmentStage vertex vertexMain(thread const VertexStage vertx [[stage_in]],
 }
 
 half4 fragment fragmentMain(FragmentStage in [[stage_in]],
-                            device const CircleEvaluatedPropsUBO& props [[buffer(idCircleEvaluatedPropsUBO)]]) {
+                            device const GlobalPaintParamsUBO& paintParams [[buffer(idGlobalPaintParamsUBO)]],
+                            device const CircleEvaluatedPropsUBO& props [[buffer(idCircleEvaluatedPropsUBO)]],
+                            device const CircleExpressionUBO& expr [[buffer(idCircleExpressionUBO)]]) {
 #if defined(OVERDRAW_INSPECTOR)
     return half4(1.0);
 #endif
 
 #if defined(HAS_UNIFORM_u_color)
-    const half4 color = half4(props.color);
+    const auto exprColor = (props.expressionMask & CircleExpressionMask::Color);
+    const half4 color = half4(exprColor ? expr.color.evalColor(paintParams.map_zoom) : props.color);
 #else
     const half4 color = in.color;
 #endif
 #if defined(HAS_UNIFORM_u_radius)
-    const float radius = props.radius;
+    const auto exprRadius = (props.expressionMask & CircleExpressionMask::Radius);
+    const float radius = exprRadius ? expr.radius.eval(paintParams.map_zoom) : props.radius;
 #else
     const float radius = in.radius;
 #endif
 #if defined(HAS_UNIFORM_u_blur)
-    const float blur = props.blur;
+    const auto exprBlur = (props.expressionMask & CircleExpressionMask::Blur);
+    const float blur = exprBlur ? expr.blur.eval(paintParams.map_zoom) : props.blur;
 #else
     const float blur = in.blur;
 #endif
 #if defined(HAS_UNIFORM_u_opacity)
-    const float opacity = props.opacity;
+    const auto exprOpacity = (props.expressionMask & CircleExpressionMask::Opacity);
+    const float opacity = exprOpacity ? expr.opacity.eval(paintParams.map_zoom) : props.opacity;
 #else
     const float opacity = in.opacity;
 #endif
 #if defined(HAS_UNIFORM_u_stroke_color)
-    const half4 stroke_color = half4(props.stroke_color);
+    const auto exprStrokeColor = (props.expressionMask & CircleExpressionMask::StrokeColor);
+    const half4 stroke_color = half4(exprStrokeColor ? expr.stroke_color.evalColor(paintParams.map_zoom)
+                                                     : props.stroke_color);
 #else
     const half4 stroke_color = in.stroke_color;
 #endif
 #if defined(HAS_UNIFORM_u_stroke_width)
-    const float stroke_width = props.stroke_width;
+    const auto exprStrokeWidth = (props.expressionMask & CircleExpressionMask::StrokeWidth);
+    const float stroke_width = exprStrokeWidth ? expr.stroke_width.eval(paintParams.map_zoom) : props.stroke_width;
 #else
     const float stroke_width = in.stroke_width;
 #endif
 #if defined(HAS_UNIFORM_u_stroke_opacity)
-    const float stroke_opacity = props.stroke_opacity;
+    const auto exprStrokeOpacity = (props.expressionMask & CircleExpressionMask::StrokeOpacity);
+    const float stroke_opacity = exprStrokeOpacity ? expr.stroke_opacity.eval(paintParams.map_zoom)
+                                                   : props.stroke_opacity;
 #else
     const float stroke_opacity = in.stroke_opacity;
 #endif
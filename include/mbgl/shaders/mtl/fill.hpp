@@ -13,6 +13,7 @@ enum {
     idFillDrawableUBO = idDrawableReservedVertexOnlyUBO,
     idFillTilePropsUBO = drawableReservedUBOCount,
     idFillEvaluatedPropsUBO,
+    idFillExpressionUBO,
     fillUBOCount
 };
 
@@ -113,6 +114,22 @@ struct alignas(16) FillOutlineTriangulatedDrawableUBO {
 };
 static_assert(sizeof(FillOutlineTriangulatedDrawableUBO) == 5 * 16, "wrong size");
 
+/// Expression properties that do not depend on the tile
+enum class FillExpressionMask : uint32_t {
+    None = 0,
+    Color = 1 << 0,
+    Opacity = 1 << 1,
+    OutlineColor = 1 << 2,
+};
+bool operator&(FillExpressionMask a, FillExpressionMask b) { return (uint32_t)a & (uint32_t)b; }
+
+struct alignas(16) FillExpressionUBO {
+    GPUExpression color;
+    GPUExpression opacity;
+    GPUExpression outline_color;
+};
+static_assert(sizeof(FillExpressionUBO) % 16 == 0, "wrong alignment");
+
 /// Evaluated properties that do not depend on the tile
 struct alignas(16) FillEvaluatedPropsUBO {
     /*  0 */ float4 color;
@@ -121,9 +138,18 @@ struct alignas(16) FillEvaluatedPropsUBO {
     /* 36 */ float fade;
     /* 40 */ float from_scale;
     /* 44 */ float to_scale;
-    /* 48 */
+    /* 48 */ FillExpressionMask expressionMask;
+    /* 52 */ float pad1;
+    /* 56 */ float pad2;
+    /* 60 */ float pad3;
+    /* 64 */
 };
-static_assert(sizeof(FillEvaluatedPropsUBO) == 3 * 16, "wrong size");
+static_assert(sizeof(FillEvaluatedPropsUBO) == 4 * 16, "wrong size");
+
+/// Opacity, from the expression buffer if it's evaluated on the GPU
+float fillOpacity(device const FillEvaluatedPropsUBO& props, device const FillExpressionUBO& expr, float zoom) {
+    return (props.expressionMask & FillExpressionMask::Opacity) ? expr.opacity.eval(zoom) : props.opacity;
+}
 
 union FillDrawableUnionUBO {
     FillDrawableUBO fillDrawableUBO;
@@ -193,19 +219,22 @@ FragmentStage vertex vertexMain(thread const VertexStage vertx [[stage_in]],
 }
 
 half4 fragment fragmentMain(FragmentStage in [[stage_in]],
-                            device const FillEvaluatedPropsUBO& props [[buffer(idFillEvaluatedPropsUBO)]]) {
+                            device const GlobalPaintParamsUBO& paintParams [[buffer(idGlobalPaintParamsUBO)]],
+                            device const FillEvaluatedPropsUBO& props [[buffer(idFillEvaluatedPropsUBO)]],
+                            device const FillExpressionUBO& expr [[buffer(idFillExpressionUBO)]]) {
 #if defined(OVERDRAW_INSPECTOR)
     return half4(1.0);
 #endif
 
 #if defined(HAS_UNIFORM_u_color)
-    const half4 color = half4(props.color);
+    const auto exprColor = (props.expressionMask & FillExpressionMask::Color);
+    const half4 color = half4(exprColor ? expr.color.evalColor(paintParams.map_zoom) : props.color);
 #else
     const half4 color = in.color;
 #endif
 
 #if defined(HAS_UNIFORM_u_opacity)
-    const half opacity = props.opacity;
+    const half opacity = fillOpacity(props, expr, paintParams.map_zoom);
 #else
     const half opacity = in.opacity;
 #endif
@@ -266,7 +295,9 @@ FragmentStage vertex vertexMain(thread const VertexStage vertx [[stage_in]],
 }
 
 half4 fragment fragmentMain(FragmentStage in [[stage_in]],
-                            device const FillEvaluatedPropsUBO& props [[buffer(idFillEvaluatedPropsUBO)]]) {
+                            device const GlobalPaintParamsUBO& paintParams [[buffer(idGlobalPaintParamsUBO)]],
+                            device const FillEvaluatedPropsUBO& props [[buffer(idFillEvaluatedPropsUBO)]],
+                            device const FillExpressionUBO& expr [[buffer(idFillExpressionUBO)]]) {
 #if defined(OVERDRAW_INSPECTOR)
     return half4(1.0);
 #endif
@@ -278,13 +309,14 @@ half4 fragment fragmentMain(FragmentStage in [[stage_in]],
 //    float alpha = 1.0 - smoothstep(0.0, 1.0, dist);
 
 #if defined(HAS_UNIFORM_u_outline_color)
-    const half4 color = half4(props.outline_color);
+    const auto exprColor = (props.expressionMask & FillExpressionMask::OutlineColor);
+    const half4 color = half4(exprColor ? expr.outline_color.evalColor(paintParams.map_zoom) : props.outline_color);
 #else
     const half4 color = in.outline_color;
 #endif
 
 #if defined(HAS_UNIFORM_u_opacity)
-    const half opacity = props.opacity;
+    const half opacity = fillOpacity(props, expr, paintParams.map_zoom);
 #else
     const half opacity = in.opacity;
 #endif
@@ -392,7 +424,9 @@ FragmentStage vertex vertexMain(thread const VertexStage vertx [[stage_in]],
 half4 fragment fragmentMain(FragmentStage in [[stage_in]],
                             device const uint32_t& uboIndex [[buffer(idGlobalUBOIndex)]],
                             device const FillTilePropsUnionUBO* tilePropsVector [[buffer(idFillTilePropsUBO)]],
+                            device const GlobalPaintParamsUBO& paintParams [[buffer(idGlobalPaintParamsUBO)]],
                             device const FillEvaluatedPropsUBO& props [[buffer(idFillEvaluatedPropsUBO)]],
+                            device const FillExpressionUBO& expr [[buffer(idFillExpressionUBO)]],
                             texture2d<float, access::sample> image0 [[texture(0)]],
                             sampler image0_sampler [[sampler(0)]]) {
 #if defined(OVERDRAW_INSPECTOR)
@@ -414,7 +448,7 @@ half4 fragment fragmentMain(FragmentStage in [[stage_in]],
 #endif
 
 #if defined(HAS_UNIFORM_u_opacity)
-    const auto opacity        = props.opacity;
+    const auto opacity        = fillOpacity(props, expr, paintParams.map_zoom);
 #else
     const auto opacity        = in.opacity;
 #endif
@@ -543,7 +577,9 @@ FragmentStage vertex vertexMain(thread const VertexStage vertx [[stage_in]],
 half4 fragment fragmentMain(FragmentStage in [[stage_in]],
                             device const uint32_t& uboIndex [[buffer(idGlobalUBOIndex)]],
                             device const FillTilePropsUnionUBO* tilePropsVector [[buffer(idFillTilePropsUBO)]],
+                            device const GlobalPaintParamsUBO& paintParams [[buffer(idGlobalPaintParamsUBO)]],
                             device const FillEvaluatedPropsUBO& props [[buffer(idFillEvaluatedPropsUBO)]],
+                            device const FillExpressionUBO& expr [[buffer(idFillExpressionUBO)]],
                             texture2d<float, access::sample> image0 [[texture(0)]],
                             sampler image0_sampler [[sampler(0)]]) {
 #if defined(OVERDRAW_INSPECTOR)
@@ -565,7 +601,7 @@ half4 fragment fragmentMain(FragmentStage in [[stage_in]],
 #endif
 
 #if defined(HAS_UNIFORM_u_opacity)
-    const auto opacity        = props.opacity;
+    const auto opacity        = fillOpacity(props, expr, paintParams.map_zoom);
 #else
     const auto opacity        = in.opacity;
 #endif
@@ -660,7 +696,9 @@ FragmentStage vertex vertexMain(thread const VertexStage vertx [[stage_in]],
 }
 
 half4 fragment fragmentMain(FragmentStage in [[stage_in]],
-                            device const FillEvaluatedPropsUBO& props [[buffer(idFillEvaluatedPropsUBO)]]) {
+                            device const GlobalPaintParamsUBO& paintParams [[buffer(idGlobalPaintParamsUBO)]],
+                            device const FillEvaluatedPropsUBO& props [[buffer(idFillEvaluatedPropsUBO)]],
+                            device const FillExpressionUBO& expr [[buffer(idFillExpressionUBO)]]) {
 
     // Calculate the distance of the pixel from the line in pixels.
     const float dist = length(in.normal) * in.width2;
@@ -670,7 +708,9 @@ half4 fragment fragmentMain(FragmentStage in [[stage_in]],
     const float blur2 = (1.0 / DEVICE_PIXEL_RATIO) * in.gamma_scale;
     const float alpha = clamp(min(dist + blur2, in.width2 - dist) / blur2, 0.0, 1.0);
 
-    return half4(props.outline_color * (alpha * props.opacity));
+    const auto exprColor = (props.expressionMask & FillExpressionMask::OutlineColor);
+    const float4 outline_color = exprColor ? expr.outline_color.evalColor(paintParams.map_zoom) : props.outline_color;
+    return half4(outline_color * (alpha * fillOpacity(props, expr, paintParams.map_zoom)));
 }
 )";
 };
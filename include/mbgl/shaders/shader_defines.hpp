@@ -150,6 +150,7 @@ enum {
 
 enum {
     idCircleEvaluatedPropsUBO = getLayerStartValue(circleDrawableUBOCount),
+    idCircleExpressionUBO,
     circleUBOCount
 };
 
@@ -175,6 +176,7 @@ enum {
 
 enum {
     idFillEvaluatedPropsUBO = getLayerStartValue(fillDrawableUBOCount),
+    idFillExpressionUBO,
     fillUBOCount
 };
 
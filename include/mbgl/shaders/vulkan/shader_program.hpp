@@ -5,6 +5,7 @@
 #include <mbgl/vulkan/renderer_backend.hpp>
 #include <mbgl/vulkan/pipeline.hpp>
 
+#include <mutex>
 #include <optional>
 #include <string>
 #include <unordered_map>
@@ -84,6 +85,8 @@ protected:
     vk::UniqueShaderModule vertexShader;
     vk::UniqueShaderModule fragmentShader;
     std::shared_ptr<std::unordered_map<std::size_t, vk::UniquePipeline>> pipelines;
+    // Drawables are recorded on several threads when render passes use secondary command buffers
+    std::mutex pipelineMutex;
 
     VertexAttributeArray vertexAttributes;
     VertexAttributeArray instanceAttributes;
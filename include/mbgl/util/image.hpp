@@ -8,6 +8,7 @@
 #include <cstring>
 #include <memory>
 #include <algorithm>
+#include <stdexcept>
 
 namespace mbgl {
 
@@ -171,9 +172,52 @@ public:
     std::unique_ptr<uint8_t[]> data;
 };
 
+/// Rectangle of pixels within an image, referencing its rows without copying them. The image has
+/// to outlive the view.
+template <ImageAlphaMode Mode>
+class ImageView {
+public:
+    ImageView() = default;
+
+    ImageView(const Image<Mode>& image)
+        : size(image.size),
+          stride(image.stride()),
+          data(image.data.get()) {}
+
+    ImageView(const Image<Mode>& image, const Point<uint32_t>& pt, const Size& size_)
+        : size(size_),
+          stride(image.stride()) {
+        if (size.width > image.size.width || size.height > image.size.height ||
+            pt.x > image.size.width - size.width || pt.y > image.size.height - size.height) {
+            throw std::out_of_range("out of range coordinates for image view");
+        }
+        data = image.data.get() + pt.y * stride + pt.x * channels;
+    }
+
+    bool valid() const { return !size.isEmpty() && data != nullptr; }
+
+    const uint8_t* row(uint32_t y) const { return data + y * stride; }
+
+    Image<Mode> clone() const {
+        Image<Mode> copy_(size);
+        for (uint32_t y = 0; y < size.height; y++) {
+            std::copy(row(y), row(y) + size.width * channels, copy_.data.get() + y * copy_.stride());
+        }
+        return copy_;
+    }
+
+    static constexpr size_t channels = Image<Mode>::channels;
+
+    Size size;
+    /// Bytes from one row to the next, which includes the rest of the image around the view
+    size_t stride = 0;
+    const uint8_t* data = nullptr;
+};
+
 using UnassociatedImage = Image<ImageAlphaMode::Unassociated>;
 using PremultipliedImage = Image<ImageAlphaMode::Premultiplied>;
 using AlphaImage = Image<ImageAlphaMode::Exclusive>;
+using PremultipliedImageView = ImageView<ImageAlphaMode::Premultiplied>;
 
 // TODO: don't use std::string for binary data.
 PremultipliedImage decodeImage(const std::string&);
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <mbgl/util/image.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace mbgl {
+
+enum class ImageEncoding : uint8_t {
+    PNG,
+    WebP,
+    JPEG,
+};
+
+struct ImageEncoderOptions {
+    ImageEncoding encoding = ImageEncoding::PNG;
+    /// zlib compression level of PNG images from 0 to 9, or -1 for zlib's default
+    int compressionLevel = -1;
+    /// Quality of WebP and JPEG images from 0 to 100. WebP images of quality 100 are lossless.
+    int quality = 90;
+    /// Parts of an image compressed in parallel, by the calling thread and the background thread
+    /// pool, where the encoding supports it
+    std::size_t threads = 1;
+};
+
+/// Encodes rendered images into a file format. An encoder keeps its scratch buffers from one image
+/// to the next, so a series of images is best encoded with the same one. Encoders aren't
+/// thread-safe, use one per thread to encode on several of them.
+class ImageEncoder {
+public:
+    virtual ~ImageEncoder() = default;
+
+    /// Creates an encoder for `options.encoding`, or returns null if the platform can't write it.
+    static std::unique_ptr<ImageEncoder> create(const ImageEncoderOptions& options);
+
+    /// Encodes an image, or a view of part of one such as a tile of a larger rendering
+    virtual std::string encode(const PremultipliedImageView&) = 0;
+};
+
+} // namespace mbgl
@@ -0,0 +1,146 @@
+#pragma once
+
+#include <mbgl/util/noncopyable.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <vector>
+
+namespace mbgl {
+namespace util {
+
+/// A bump allocator for short-lived scratch data. Allocations are never freed
+/// individually; `rewind()` releases everything allocated after a mark, and
+/// `reset()` releases everything at once and keeps one block around so that
+/// the next round of work usually allocates nothing.
+///
+/// Not thread-safe. Each thread populating buckets uses its own arena.
+class MonotonicArena : private util::noncopyable {
+public:
+    static constexpr std::size_t defaultBlockSize = 64 * 1024;
+    /// Blocks larger than this are returned to the system on reset.
+    static constexpr std::size_t maxRetainedBlockSize = 4 * 1024 * 1024;
+
+    explicit MonotonicArena(std::size_t blockSize = defaultBlockSize);
+    ~MonotonicArena();
+
+    void* allocate(std::size_t bytes, std::size_t alignment = alignof(std::max_align_t));
+
+    /// Invalidates everything allocated from this arena, and any marks taken.
+    void reset();
+
+    /// A position to rewind the arena to.
+    struct Mark {
+        std::size_t block = 0;
+        std::byte* cursor = nullptr;
+        std::size_t allocated = 0;
+    };
+
+    Mark mark() const { return {activeBlock, cursor, allocated}; }
+
+    /// Invalidates everything allocated since `mark` was taken. The blocks are
+    /// reused by later allocations, and trimmed as by `reset()` once the arena
+    /// is empty again.
+    void rewind(const Mark&);
+
+    /// Bytes handed out and not rewound yet.
+    std::size_t bytesAllocated() const { return allocated; }
+    /// Number of blocks currently owned by the arena.
+    std::size_t blockCount() const { return blocks.size(); }
+
+    /// The arena that `ArenaAllocator`s constructed on this thread draw from, if any.
+    static MonotonicArena* current();
+
+    /// Makes an arena current on this thread for the lifetime of the scope, and
+    /// rewinds it to where it was when the scope ends. Scopes on the same arena
+    /// nest, an inner scope leaves what the outer one allocated alone.
+    class Scope : private util::noncopyable {
+    public:
+        explicit Scope(MonotonicArena&);
+        ~Scope();
+
+    private:
+        MonotonicArena& arena;
+        MonotonicArena* const previous;
+        const Mark start;
+    };
+
+    /// Rewinds the current arena, if there is one, when it goes out of scope.
+    /// Used around work whose intermediates should not pile up, like a single feature.
+    class Checkpoint : private util::noncopyable {
+    public:
+        Checkpoint();
+        ~Checkpoint();
+
+    private:
+        MonotonicArena* const arena;
+        const Mark start;
+    };
+
+private:
+    struct Block {
+        std::unique_ptr<std::byte[]> data;
+        std::size_t size;
+    };
+
+    void nextBlock(std::size_t minSize);
+
+    const std::size_t blockSize;
+    std::vector<Block> blocks;
+    // The block `cursor` points into, when it points anywhere.
+    std::size_t activeBlock = 0;
+    std::byte* cursor = nullptr;
+    std::byte* end = nullptr;
+    std::size_t allocated = 0;
+};
+
+/// Allocates from the arena that was current when the allocator was created,
+/// or from the heap when there was none. Containers using it can therefore be
+/// used unchanged outside of a parse.
+template <class T>
+class ArenaAllocator {
+public:
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    ArenaAllocator() noexcept
+        : arena(MonotonicArena::current()) {}
+    explicit ArenaAllocator(MonotonicArena* arena_) noexcept
+        : arena(arena_) {}
+    template <class U>
+    ArenaAllocator(const ArenaAllocator<U>& other) noexcept
+        : arena(other.arena) {}
+
+    T* allocate(std::size_t n) {
+        if (arena) {
+            return static_cast<T*>(arena->allocate(n * sizeof(T), alignof(T)));
+        }
+        return std::allocator<T>().allocate(n);
+    }
+
+    void deallocate(T* p, std::size_t n) noexcept {
+        if (!arena) {
+            std::allocator<T>().deallocate(p, n);
+        }
+    }
+
+    template <class U>
+    bool operator==(const ArenaAllocator<U>& other) const noexcept {
+        return arena == other.arena;
+    }
+
+private:
+    template <class U>
+    friend class ArenaAllocator;
+
+    MonotonicArena* arena;
+};
+
+template <class T>
+using ArenaVector = std::vector<T, ArenaAllocator<T>>;
+
+} // namespace util
+} // namespace mbgl
@@ -0,0 +1,133 @@
+#pragma once
+
+#include <mbgl/util/identity.hpp>
+#include <mbgl/util/monotonic_timer.hpp>
+#include <mbgl/util/noncopyable.hpp>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace mbgl {
+namespace util {
+
+/// Kinds of work timed with `TaskTimer`, whichever thread it runs on.
+enum class TaskCategory : uint8_t {
+    TileParse,
+    Glyph,
+    ImageDecode,
+    Database,
+};
+constexpr std::size_t TaskCategoryCount = static_cast<std::size_t>(TaskCategory::Database) + 1;
+
+/// Counts durations into fixed buckets. Recording doesn't lock, so a histogram
+/// can be shared between threads.
+class DurationHistogram : private noncopyable {
+public:
+    /// Upper bounds of the buckets in seconds. One more bucket counts everything longer.
+    static constexpr std::array<double, 16> bounds{
+        0.00005, 0.0001, 0.00025, 0.0005, 0.001, 0.0025, 0.005, 0.01, 0.025, 0.05, 0.1, 0.25, 0.5, 1.0, 2.5, 5.0};
+
+    struct Snapshot {
+        std::array<uint64_t, bounds.size() + 1> counts{};
+        uint64_t count = 0;
+        /// Seconds
+        double sum = 0.0;
+
+        /// Upper bound of the bucket holding the `q` quantile, or infinity if
+        /// it's in the last bucket.
+        double quantile(double q) const;
+    };
+
+    void record(std::chrono::duration<double>);
+    Snapshot snapshot() const;
+
+private:
+    std::array<std::atomic<uint64_t>, bounds.size() + 1> counts{};
+    std::atomic<uint64_t> sumNanoseconds{0};
+};
+
+/// Process-wide statistics of the worker thread schedulers: how long tasks wait
+/// in the queue and run per tag, how busy the worker threads are, and how long
+/// the work timed with `TaskTimer` takes per category.
+class SchedulerTelemetry : private noncopyable {
+public:
+    struct TagStats {
+        /// From scheduling a task to a worker thread starting it
+        DurationHistogram queueLatency;
+        DurationHistogram execution;
+    };
+
+    struct Snapshot {
+        struct Tag {
+            std::int64_t tag;
+            DurationHistogram::Snapshot queueLatency;
+            DurationHistogram::Snapshot execution;
+        };
+        std::vector<Tag> tags;
+        std::array<DurationHistogram::Snapshot, TaskCategoryCount> categories;
+
+        /// Worker threads currently running
+        std::size_t threads = 0;
+        /// Seconds spent running tasks, summed over all worker threads
+        double busyTime = 0.0;
+        /// Seconds the worker threads have existed, summed over all of them
+        double threadTime = 0.0;
+
+        /// Fraction of the worker threads' lifetime spent running tasks
+        double utilization() const { return threadTime > 0.0 ? busyTime / threadTime : 0.0; }
+    };
+
+    static SchedulerTelemetry& get();
+    static const char* name(TaskCategory);
+
+    /// Statistics of the tasks scheduled with `tag`, created on first use.
+    std::shared_ptr<TagStats> getTagStats(const SimpleIdentity& tag);
+    /// Stops reporting a tag, e.g. once its owner has waited for its tasks.
+    void removeTag(const SimpleIdentity& tag);
+
+    void recordTask(TaskCategory, std::chrono::duration<double>);
+
+    void threadStarted();
+    void threadStopped();
+    void addBusyTime(std::chrono::duration<double>);
+
+    Snapshot snapshot() const;
+
+    /// The snapshot in the Prometheus text exposition format.
+    std::string toPrometheus() const;
+
+private:
+    mutable std::mutex tagsMutex;
+    std::unordered_map<std::int64_t, std::shared_ptr<TagStats>> tags;
+
+    std::array<DurationHistogram, TaskCategoryCount> categories;
+
+    std::atomic<std::size_t> threads{0};
+    std::atomic<std::int64_t> busyNanoseconds{0};
+    // The lifetime of the running threads is `threads * now - runningThreadStarts`.
+    std::atomic<std::int64_t> runningThreadStarts{0};
+    std::atomic<std::int64_t> stoppedThreadNanoseconds{0};
+};
+
+/// Records the time until it goes out of scope under a task category.
+class TaskTimer : private noncopyable {
+public:
+    explicit TaskTimer(TaskCategory category_)
+        : category(category_),
+          start(MonotonicTimer::now()) {}
+    ~TaskTimer() { SchedulerTelemetry::get().recordTask(category, MonotonicTimer::now() - start); }
+
+private:
+    const TaskCategory category;
+    const std::chrono::duration<double> start;
+};
+
+} // namespace util
+} // namespace mbgl
@@ -22,7 +22,10 @@ public:
 
     vulkan::Context& getContext() { return context; }
     const vulkan::Context& getContext() const { return context; }
-    const vk::UniqueCommandBuffer& getCommandBuffer() const { return commandBuffer; }
+    /// The buffer commands are recorded into, which is a secondary one while a render pass records its
+    /// commands into secondary command buffers
+    const vk::UniqueCommandBuffer& getCommandBuffer() const { return *commandBuffer; }
+    const vk::UniqueCommandBuffer& getPrimaryCommandBuffer() const { return primaryCommandBuffer; }
 
     std::unique_ptr<gfx::UploadPass> createUploadPass(const char* name, gfx::Renderable&) override;
     std::unique_ptr<gfx::RenderPass> createRenderPass(const char* name, const gfx::RenderPassDescriptor&) override;
@@ -34,12 +37,17 @@ private:
     void pushDebugGroup(const char* name, const std::array<float, 4>& color);
     void popDebugGroup() override;
 
+    void setCommandBuffer(const vk::UniqueCommandBuffer& buffer) { commandBuffer = &buffer; }
+
 private:
     friend class RenderPass;
     friend class UploadPass;
 
     vulkan::Context& context;
-    const vk::UniqueCommandBuffer& commandBuffer;
+    const vk::UniqueCommandBuffer& primaryCommandBuffer;
+    const vk::UniqueCommandBuffer* commandBuffer;
+    // Labels aren't allowed to span secondary command buffers, they're left out while recording those
+    uint32_t skippedDebugGroups = 0;
 };
 
 } // namespace vulkan
@@ -15,6 +15,7 @@
 #include <mbgl/vulkan/descriptor_set.hpp>
 #include <mbgl/util/util.hpp>
 
+#include <deque>
 #include <memory>
 #include <optional>
 #include <unordered_map>
@@ -157,10 +158,25 @@ public:
 
     void requestSurfaceUpdate(bool useDelay = true);
 
+    /// Creates the command pools of the current frame up to `count`. Secondary command buffers of different
+    /// pools may be recorded on different threads at the same time, the pools have to exist before that.
+    void reserveSecondaryCommandPools(std::size_t count);
+
+    /// Begins a secondary command buffer of the current frame, which continues the render pass of the renderable
+    const vk::UniqueCommandBuffer& beginSecondaryCommandBuffer(std::size_t poolIndex, gfx::Renderable&);
+
 private:
+    struct SecondaryCommandPool {
+        vk::UniqueCommandPool pool;
+        // Reset with the pool at the start of the frame and reused
+        std::deque<vk::UniqueCommandBuffer> buffers;
+        std::size_t used = 0;
+    };
+
     struct FrameResources {
         vk::UniqueCommandBuffer commandBuffer;
         vk::UniqueFence flightFrameFence;
+        std::deque<SecondaryCommandPool> secondaryCommandPools;
 
         DeletionQueue deletionQueue;
 
@@ -61,7 +61,7 @@ public:
     void allocate();
 
     virtual void markDirty();
-    void bind(CommandEncoder& encoder);
+    void bind(CommandEncoder& encoder) const;
 
 protected:
     void createDescriptorPool(DescriptorPoolGrowable& growablePool);
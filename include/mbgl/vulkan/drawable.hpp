@@ -18,6 +18,7 @@ class StencilMode;
 namespace vulkan {
 
 class CommandEncoder;
+class Context;
 class UploadPass;
 
 class Drawable : public gfx::Drawable {
@@ -28,6 +29,14 @@ public:
     void upload(gfx::UploadPass&);
     void draw(PaintParameters&) const override;
 
+    /// Sets up what `record` needs on the render thread: the depth and stencil modes of the pass and
+    /// the descriptor sets. Returns false if there's nothing to draw.
+    bool prepare(PaintParameters&) const;
+
+    /// Records the draw calls of a prepared drawable and returns their number. It doesn't touch state
+    /// shared with other drawables, so that drawables can be recorded on different threads.
+    std::size_t record(CommandEncoder&) const;
+
     void setIndexData(gfx::IndexVectorBasePtr, std::vector<UniqueDrawSegment> segments) override;
     void setVertices(std::vector<uint8_t>&&, std::size_t, gfx::AttributeDataType) override;
 
@@ -55,7 +64,8 @@ protected:
     void buildVulkanInputBindings() noexcept;
 
     bool bindAttributes(CommandEncoder&) const noexcept;
-    bool bindDescriptors(CommandEncoder&) const noexcept;
+    bool updateDescriptors(Context&) const noexcept;
+    void bindDescriptors(CommandEncoder&) const noexcept;
 
     void uploadTextures(UploadPass&) const noexcept;
 
@@ -19,14 +19,12 @@ public:
 
     void uploadImage(const uint8_t* pixelData, gfx::TextureHandle& texHandle) override;
     void uploadDeferredImages() override;
-    bool removeTexture(const gfx::TextureHandle& texHandle) override;
 
 #if DYNAMIC_TEXTURE_VULKAN_MULTITHREADED_UPLOAD
+    bool removeTexture(const gfx::TextureHandle& texHandle) override;
+
     using TexturesToBlit =
         std::unordered_map<gfx::TextureHandle, std::shared_ptr<vulkan::Texture2D>, gfx::TextureHandle::Hasher>;
-#else
-    using TextureBuffersToUpload =
-        std::unordered_map<gfx::TextureHandle, UniqueBufferAllocation, gfx::TextureHandle::Hasher>;
 #endif
 
 private:
@@ -35,8 +33,6 @@ private:
 #if DYNAMIC_TEXTURE_VULKAN_MULTITHREADED_UPLOAD
     TexturesToBlit texturesToBlit;
     vk::UniqueCommandPool commandPool;
-#else
-    TextureBuffersToUpload textureBuffersToUpload;
 #endif
 };
 
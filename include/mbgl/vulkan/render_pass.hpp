@@ -1,9 +1,12 @@
 #pragma once
 
 #include <mbgl/gfx/render_pass.hpp>
+#include <mbgl/vulkan/renderer_backend.hpp>
 
+#include <functional>
 #include <memory>
 #include <optional>
+#include <vector>
 
 namespace mbgl {
 namespace vulkan {
@@ -11,6 +14,8 @@ namespace vulkan {
 class BufferResource;
 class CommandEncoder;
 class Context;
+class Drawable;
+class UniformBufferArray;
 
 class RenderPass final : public gfx::RenderPass {
 public:
@@ -23,15 +28,37 @@ public:
 
     void clearStencil(uint32_t value = 0) const;
 
+    /// Whether the commands of the pass go into secondary command buffers, which is the case when the
+    /// backend records with more than one thread
+    bool isRecordingSecondary() const { return recordingSecondary; }
+
+    /// Records prepared drawables in order, spreading them over the backend's recording threads in
+    /// contiguous batches with a secondary command buffer each. Secondary command buffers don't inherit
+    /// bindings, `bindLayer` binds what the drawables share besides the global uniform buffers.
+    void recordDrawables(const std::vector<const Drawable*>& drawables,
+                         const std::function<void(CommandEncoder&)>& bindLayer);
+
+    /// Global uniform buffers bound in the pass, which each secondary command buffer binds again
+    void setGlobalUniformBuffers(const UniformBufferArray* buffers) { globalUniformBuffers = buffers; }
+
     void addDebugSignpost(const char* name) override;
 
 private:
     void pushDebugGroup(const char* name) override;
     void popDebugGroup() override;
 
+    // Starts or ends the secondary command buffer the render thread records into between batches
+    void beginSegment();
+    void endSegment();
+
 private:
     gfx::RenderPassDescriptor descriptor;
     vulkan::CommandEncoder& commandEncoder;
+
+    const bool recordingSecondary;
+    // Secondary command buffers to execute at the end of the pass, in order
+    std::vector<vk::CommandBuffer> segments;
+    const UniformBufferArray* globalUniformBuffers = nullptr;
 };
 
 } // namespace vulkan
@@ -3,6 +3,8 @@
 #include <mbgl/gfx/renderer_backend.hpp>
 #include <mbgl/gfx/context.hpp>
 
+#include <algorithm>
+
 #define VULKAN_HPP_DISPATCH_LOADER_DYNAMIC 1
 #define VULKAN_HPP_NO_DEFAULT_DISPATCHER
 
@@ -29,6 +31,10 @@ namespace mbgl {
 
 class ProgramParameters;
 
+namespace gfx {
+class ShaderBinaryCache;
+} // namespace gfx
+
 namespace vulkan {
 
 class RendererBackend : public gfx::RendererBackend {
@@ -54,6 +60,14 @@ public:
     int32_t getGraphicsQueueIndex() const { return graphicsQueueIndex; }
     int32_t getPresentQueueIndex() const { return presentQueueIndex; }
 
+    /// Pipeline cache seeded from the shader cache directory, or a null handle when it's not set
+    vk::PipelineCache getPipelineCache();
+
+    /// Threads that record the drawables of a render pass, the render thread included. With more than
+    /// one, render passes record into secondary command buffers, see `RenderPass::recordDrawables`.
+    void setRecordingThreads(uint32_t value) { recordingThreads = std::max(value, 1u); }
+    uint32_t getRecordingThreads() const { return recordingThreads; }
+
     template <typename T>
         requires vk::isVulkanHandleType<T>::value
     void setDebugName([[maybe_unused]] const T& object, [[maybe_unused]] const std::string& name) const {
@@ -72,6 +86,9 @@ public:
     void endDebugLabel(const vk::CommandBuffer& buffer) const;
     void insertDebugLabel(const vk::CommandBuffer& buffer, const char* name) const;
 
+    /// Called by the context when a frame begins
+    virtual void onBeginFrame() {}
+
     void startFrameCapture();
     void endFrameCapture();
     void setFrameCaptureLoop(bool value);
@@ -95,6 +112,9 @@ protected:
     virtual void initFrameCapture();
 
     void destroyResources();
+    // Starts reading the stored pipeline cache, if a cache directory is set
+    void initShaderBinaryCache();
+    void savePipelineCache();
 
 protected:
     vk::DynamicLoader dynamicLoader;
@@ -117,9 +137,14 @@ protected:
 
     vk::UniqueCommandPool commandPool;
     uint32_t maxFrames = 1;
+    uint32_t recordingThreads = 1;
 
     VmaAllocator allocator;
 
+    std::unique_ptr<gfx::ShaderBinaryCache> shaderBinaryCache;
+    vk::UniquePipelineCache pipelineCache;
+    bool pipelineCacheChecked{false};
+
     bool debugUtilsEnabled{false};
     bool usingSharedContext{false};
 };
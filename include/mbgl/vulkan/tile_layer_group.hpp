@@ -4,6 +4,7 @@
 #include <mbgl/renderer/layer_group.hpp>
 
 #include <optional>
+#include <vector>
 
 namespace mbgl {
 
@@ -11,6 +12,7 @@ class PaintParameters;
 
 namespace vulkan {
 
+class Drawable;
 class RenderPass;
 
 /**
@@ -29,6 +31,8 @@ public:
 
 protected:
     UniformBufferArray uniformBuffers;
+    // Drawables prepared for a render pass that records into secondary command buffers
+    std::vector<const Drawable*> preparedDrawables;
 };
 
 } // namespace vulkan
@@ -69,6 +69,12 @@ public:
     void bind(gfx::RenderPass& renderPass) override;
 
     void bindDescriptorSets(CommandEncoder& encoder);
+
+    /// Brings the descriptor set of the current frame up to date without binding it
+    void updateDescriptorSets(Context& context);
+    /// Binds the descriptor set `updateDescriptorSets` brought up to date. It only reads the array, so
+    /// that worker threads recording secondary command buffers can bind it at the same time.
+    void bindUpdatedDescriptorSets(CommandEncoder& encoder) const;
     void freeDescriptorSets() { descriptorSet.reset(); }
 
 private:
@@ -13,14 +13,9 @@ public:
 
     void uploadImage(const uint8_t* pixelData, gfx::TextureHandle& texHandle) override;
     void uploadDeferredImages() override;
-    bool removeTexture(const gfx::TextureHandle& texHandle) override;
-
-    using ImagesToUpload =
-        std::unordered_map<gfx::TextureHandle, std::unique_ptr<uint8_t[]>, gfx::TextureHandle::Hasher>;
 
 private:
     bool deferredCreation = false;
-    ImagesToUpload imagesToUpload;
 };
 
 } // namespace webgpu
@@ -1,4 +1,5 @@
 #include <mbgl/util/image.hpp>
+#include <mbgl/util/image_encoder.hpp>
 #include <mbgl/util/string.hpp>
 
 #include <string>
@@ -8,6 +9,8 @@
 
 namespace mbgl {
 
+std::unique_ptr<ImageEncoder> createPNGEncoder(const ImageEncoderOptions&);
+
 PremultipliedImage decodeImage(const std::string& string) {
     auto env{android::AttachEnv()};
 
@@ -17,4 +20,8 @@ PremultipliedImage decodeImage(const std::string& string) {
     return android::Bitmap::GetImage(*env, android::BitmapFactory::DecodeByteArray(*env, array, 0, string.size()));
 }
 
+std::unique_ptr<ImageEncoder> ImageEncoder::create(const ImageEncoderOptions& options) {
+    return options.encoding == ImageEncoding::PNG ? createPNGEncoder(options) : nullptr;
+}
+
 } // namespace mbgl
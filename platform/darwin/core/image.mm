@@ -1,4 +1,5 @@
 #include <mbgl/util/image+MLNAdditions.hpp>
+#include <mbgl/util/image_encoder.hpp>
 
 #import <ImageIO/ImageIO.h>
 
@@ -72,6 +73,8 @@ mbgl::PremultipliedImage MLNPremultipliedImageFromCGImage(CGImageRef src) {
 
 namespace mbgl {
 
+std::unique_ptr<ImageEncoder> createPNGEncoder(const ImageEncoderOptions&);
+
 PremultipliedImage decodeImage(const std::string& source) {
   CFDataHandle data(CFDataCreateWithBytesNoCopy(
       kCFAllocatorDefault, reinterpret_cast<const unsigned char*>(source.data()), source.size(),
@@ -93,4 +96,8 @@ PremultipliedImage decodeImage(const std::string& source) {
   return MLNPremultipliedImageFromCGImage(*image);
 }
 
+std::unique_ptr<ImageEncoder> ImageEncoder::create(const ImageEncoderOptions& options) {
+  return options.encoding == ImageEncoding::PNG ? createPNGEncoder(options) : nullptr;
+}
+
 }  // namespace mbgl
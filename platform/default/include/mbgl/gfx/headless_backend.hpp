@@ -5,6 +5,7 @@
 #include <mbgl/gfx/renderer_backend.hpp>
 #include <mbgl/util/image.hpp>
 
+#include <functional>
 #include <memory>
 
 namespace mbgl {
@@ -23,6 +24,16 @@ public:
     }
 
     virtual PremultipliedImage readStillImage() = 0;
+
+    /// Starts reading the rendered image without waiting for the GPU to finish. `callback` is
+    /// called on the render thread once the pixels are available, by `processReadbacks()` or when
+    /// a later frame begins. Backends without asynchronous readback call it right away.
+    virtual void readStillImageAsync(std::function<void(PremultipliedImage)> callback) {
+        callback(readStillImage());
+    }
+    /// Calls the callbacks of the completed asynchronous reads. If `wait`, waits for all of them.
+    virtual void processReadbacks(bool /*wait*/) {}
+
     virtual RendererBackend* getRendererBackend() = 0;
     void setSize(Size);
 
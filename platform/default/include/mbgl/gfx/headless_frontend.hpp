@@ -4,17 +4,22 @@
 #include <mbgl/gfx/rendering_stats.hpp>
 #include <mbgl/map/camera.hpp>
 #include <mbgl/renderer/renderer_frontend.hpp>
+#include <mbgl/tile/tile_id.hpp>
 #include <mbgl/util/async_task.hpp>
+#include <mbgl/util/image.hpp>
 
 #include <atomic>
+#include <functional>
 #include <memory>
 #include <optional>
+#include <vector>
 
 namespace mbgl {
 
 class Renderer;
 class Map;
 class TransformState;
+class HeadlessRenderPool;
 
 class HeadlessFrontend : public RendererFrontend {
 public:
@@ -23,6 +28,30 @@ public:
         gfx::RenderingStats stats;
     };
 
+    struct MetatileOptions {
+        /// Tiles along each side of the block
+        uint32_t count = 4;
+        /// Logical pixels of a tile side
+        uint16_t tileSize = 256;
+        /// Logical pixels rendered around the block so that labels near its edges are placed as
+        /// they would be in a larger view, then cropped
+        uint32_t buffer = 128;
+    };
+
+    struct MetatileResult {
+        struct Tile {
+            CanonicalTileID id;
+            /// The tile's pixels within `image`
+            PremultipliedImageView image;
+        };
+
+        /// The whole block, including the buffer
+        PremultipliedImage image;
+        gfx::RenderingStats stats;
+        /// The tiles of the block within the world, by rows
+        std::vector<Tile> tiles;
+    };
+
     HeadlessFrontend(float pixelRatio_,
                      gfx::HeadlessBackend::SwapBehaviour swapBehavior = gfx::HeadlessBackend::SwapBehaviour::NoFlush,
                      gfx::ContextMode mode = gfx::ContextMode::Unique,
@@ -33,6 +62,12 @@ public:
                      gfx::ContextMode mode = gfx::ContextMode::Unique,
                      const std::optional<std::string>& localFontFamily = std::nullopt,
                      bool invalidateOnUpdate_ = true);
+    /// Renders on the backend of `pool`, which has to outlive the frontend. Frames take turns with
+    /// those of the pool's other frontends.
+    HeadlessFrontend(HeadlessRenderPool& pool,
+                     Size,
+                     float pixelRatio_,
+                     const std::optional<std::string>& localFontFamily = std::nullopt);
     ~HeadlessFrontend() override;
 
     void reset() override;
@@ -57,17 +92,35 @@ public:
 
     PremultipliedImage readStillImage();
     RenderResult render(Map&);
+    /// Renders a still image like `render`, but returns once the frame was submitted instead of
+    /// waiting for the GPU to finish it. `callback` gets the result from `processReadbacks()` or a
+    /// later render, so that the next image is rendered while this one is read back. Frontends of a
+    /// pool render synchronously and call `callback` right away.
+    void renderAsync(Map&, std::function<void(RenderResult)> callback);
+    /// Calls the callbacks of the asynchronous renders whose images arrived. If `wait`, waits for all of them.
+    void processReadbacks(bool wait);
+    /// Renders the block of tiles starting at `first` as a single map view, so that the tiles share
+    /// data, symbol placement and the overhead of a frame. `first` is usually a multiple of the tile
+    /// count. Resizes the frontend and the map to the block, moves the camera to it and stops
+    /// constraining the camera. Throws `std::invalid_argument` if the tiles are smaller than the world
+    /// at map zoom 0, such as 256 pixel tiles at zoom 0.
+    MetatileResult renderMetatile(Map&, const CanonicalTileID& first, const MetatileOptions&);
     void renderOnce(Map&);
     void renderFrame();
 
     std::optional<TransformState> getTransformState() const;
 
 private:
+    Size physicalSize() const;
+
     Size size;
     float pixelRatio;
 
     std::atomic<double> frameTime;
-    std::unique_ptr<gfx::HeadlessBackend> backend;
+    HeadlessRenderPool* pool = nullptr;
+    // Null for frontends rendering on the backend of a pool
+    std::unique_ptr<gfx::HeadlessBackend> ownBackend;
+    gfx::HeadlessBackend* backend;
     util::AsyncTask asyncInvalidate;
     bool invalidateOnUpdate;
 
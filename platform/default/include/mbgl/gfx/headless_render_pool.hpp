@@ -0,0 +1,76 @@
+#pragma once
+
+#include <mbgl/gfx/headless_backend.hpp>
+#include <mbgl/util/chrono.hpp>
+#include <mbgl/util/noncopyable.hpp>
+#include <mbgl/util/size.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+namespace mbgl {
+
+/// Renders many maps on a single headless backend. The `HeadlessFrontend`s created with the pool
+/// share its context, so that shader programs and static buffers are created once instead of for
+/// every map. A frontend renders a frame once it acquired the pool's render slot, which makes the
+/// frames of frontends on different threads take turns on the context.
+///
+/// The frontends may render on any thread, so the pool needs a context that isn't bound to the thread
+/// that created it. Only the OpenGL backend qualifies: the Vulkan context asserts that it's used on its
+/// creating thread, and the pool throws when created with any other backend.
+class HeadlessRenderPool : private util::noncopyable {
+public:
+    struct Stats {
+        /// Times frontends acquired the render slot, which they do for every frame
+        uint64_t frames = 0;
+        /// Frames per second since the pool was created
+        double framesPerSecond = 0;
+        /// Time frames waited for the render slot
+        Duration averageWaitTime = Duration::zero();
+        Duration maxWaitTime = Duration::zero();
+        /// Time frames held the render slot
+        Duration averageRenderTime = Duration::zero();
+        Duration maxRenderTime = Duration::zero();
+        /// Share of the time since the pool was created that the render slot was held
+        double utilization = 0;
+    };
+
+    /// Exclusive use of the pool's backend for a frame. Waits for the frames of other frontends,
+    /// then sizes the backend's renderable for this one.
+    class Slot : private util::noncopyable {
+    public:
+        Slot(HeadlessRenderPool&, Size);
+        ~Slot();
+
+    private:
+        HeadlessRenderPool& pool;
+        const TimePoint requested;
+        std::unique_lock<std::mutex> lock;
+        const TimePoint acquired;
+    };
+
+    explicit HeadlessRenderPool(gfx::HeadlessBackend::SwapBehaviour = gfx::HeadlessBackend::SwapBehaviour::NoFlush,
+                                gfx::ContextMode = gfx::ContextMode::Unique);
+    ~HeadlessRenderPool();
+
+    gfx::HeadlessBackend& getBackend() { return *backend; }
+
+    Stats getStats() const;
+
+private:
+    void record(Duration wait, Duration render);
+
+    std::unique_ptr<gfx::HeadlessBackend> backend;
+    std::mutex slotMutex;
+
+    mutable std::mutex statsMutex;
+    const TimePoint created;
+    uint64_t frames = 0;
+    Duration totalWaitTime = Duration::zero();
+    Duration maxWaitTime = Duration::zero();
+    Duration totalRenderTime = Duration::zero();
+    Duration maxRenderTime = Duration::zero();
+};
+
+} // namespace mbgl
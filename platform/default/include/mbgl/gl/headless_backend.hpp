@@ -17,6 +17,8 @@ public:
     void updateAssumedState() override;
     gfx::Renderable& getDefaultRenderable() override;
     PremultipliedImage readStillImage() override;
+    void readStillImageAsync(std::function<void(PremultipliedImage)> callback) override;
+    void processReadbacks(bool wait) override;
     RendererBackend* getRendererBackend() override;
 
     void swap();
@@ -79,8 +79,19 @@ public:
     // Return value is (response, stored size)
     std::optional<std::pair<Response, uint64_t>> getRegionResource(const Resource&);
     std::optional<int64_t> hasRegionResource(const Resource&);
+    // Return value is the stored size of each tile, or nothing if it isn't stored.
+    // Consecutive tiles of the same source and zoom level share a single query.
+    std::vector<std::optional<int64_t>> hasRegionTiles(const std::vector<Resource::TileData>&);
     uint64_t putRegionResource(int64_t regionID, const Resource&, const Response&);
     void putRegionResources(int64_t regionID, const std::list<std::tuple<Resource, Response>>&, OfflineRegionStatus&);
+    // Same as above, with the data of each response already compressed by compressData().
+    void putRegionResources(int64_t regionID,
+                            const std::list<std::tuple<Resource, Response, std::optional<std::string>>>&,
+                            OfflineRegionStatus&);
+
+    // Return value is the data of the response the way it's stored, if compressing makes it
+    // smaller. Doesn't use the database, so it can run on any thread before the response is put.
+    static std::optional<std::string> compressData(const Response&);
 
     expected<OfflineRegionDefinition, std::exception_ptr> getRegionDefinition(int64_t regionID);
     expected<OfflineRegionStatus, std::exception_ptr> getRegionCompletedStatus(int64_t regionID);
@@ -127,11 +138,18 @@ private:
     std::optional<int64_t> hasResource(const Resource&);
     bool putResource(const Resource&, const Response&, const std::string&, bool compressed);
 
-    uint64_t putRegionResourceInternal(int64_t regionID, const Resource&, const Response&);
+    uint64_t putRegionResourceInternal(int64_t regionID,
+                                       const Resource&,
+                                       const Response&,
+                                       const std::optional<std::string>& compressedData);
 
     std::optional<std::pair<Response, uint64_t>> getInternal(const Resource&);
     std::optional<int64_t> hasInternal(const Resource&);
     std::pair<bool, uint64_t> putInternal(const Resource&, const Response&, bool evict);
+    std::pair<bool, uint64_t> putInternal(const Resource&,
+                                          const Response&,
+                                          const std::optional<std::string>& compressedData,
+                                          bool evict);
 
     // Return value is true iff the resource was previously unused by any other regions.
     bool markUsed(int64_t regionID, const Resource&);
@@ -4,10 +4,15 @@
 #include <mbgl/storage/offline.hpp>
 #include <mbgl/storage/resource.hpp>
 
+#include <mapbox/std/weak.hpp>
+
+#include <chrono>
 #include <list>
+#include <unordered_map>
 #include <unordered_set>
 #include <memory>
 #include <deque>
+#include <optional>
 
 namespace mbgl {
 
@@ -21,6 +26,45 @@ namespace style {
 class Parser;
 } // namespace style
 
+/**
+ * Limits the number of concurrent requests to a single host. The limit starts
+ * at the overall limit and is halved when the host returns errors or its
+ * latency rises well above the fastest response seen, which is the usual sign
+ * of requests queueing up at the server. It grows back by one for every window
+ * of successful responses.
+
+ * @private
+ */
+class HostConcurrency {
+public:
+    using Duration = std::chrono::duration<double>;
+
+    explicit HostConcurrency(uint32_t maxLimit);
+
+    bool hasCapacity() const { return inFlight < getLimit(); }
+    uint32_t getLimit() const { return static_cast<uint32_t>(limit); }
+    uint32_t getInFlight() const { return inFlight; }
+
+    void requestStarted();
+    // The request finished without a signal about the host, e.g. because it
+    // was served from the database.
+    void requestFinished();
+    void requestSucceeded(Duration latency);
+    // Failed requests are retried, so they remain in flight.
+    void requestFailed();
+
+private:
+    void decrease();
+
+    const double maxLimit;
+    double limit;
+    uint32_t inFlight = 0;
+    uint32_t responsesSinceDecrease = 0;
+    bool decreased = false;
+    Duration minLatency{0};
+    Duration averageLatency{0};
+};
+
 /**
  * Coordinates the request and storage of all resources for an offline region.
 
@@ -39,8 +83,11 @@ public:
 private:
     void activateDownload();
     void continueDownload();
+    void scheduleContinueDownload();
     void deactivateDownload();
     bool flushResourcesBuffer();
+    // Compresses the data of a response on a background thread, then buffers it to be stored
+    void bufferResponse(const Resource&, const Response&);
 
     /*
      * Ensure that the resource is stored in the database, requesting it if necessary.
@@ -49,6 +96,9 @@ private:
      */
     void ensureResource(Resource&&, std::function<void(Response)> = {});
 
+    HostConcurrency& hostConcurrency(const Resource&);
+    uint32_t maxConcurrentRequests() const;
+
     void onMapboxTileCountLimitExceeded();
 
     int64_t id;
@@ -61,11 +111,22 @@ private:
     std::list<std::unique_ptr<AsyncRequest>> requests;
     std::set<std::string> requiredSourceURLs;
     std::deque<Resource> resourcesRemaining;
+
+    // Tiles of each source are enumerated lazily, one zoom level's tile cover
+    // at a time, and checked against the database in batches.
+    struct TileQueue;
+    std::list<TileQueue> tileQueues;
+
+    std::unordered_map<std::string, HostConcurrency> hosts;
+
     std::list<Resource> resourcesToBeMarkedAsUsed;
-    std::list<std::tuple<Resource, Response>> buffer;
+    std::list<std::tuple<Resource, Response, std::optional<std::string>>> buffer;
+    // Replaced when the download is deactivated, so that responses still being compressed are dropped
+    std::unique_ptr<mapbox::base::WeakPtrFactory<OfflineDownload>> weakFactory;
 
     void queueResource(Resource&&);
     void queueTiles(style::SourceType, uint16_t tileSize, const Tileset&);
+    void queueNextTiles();
     void markPendingUsedResources();
 };
 
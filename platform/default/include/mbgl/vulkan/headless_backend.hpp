@@ -4,6 +4,7 @@
 #include <mbgl/vulkan/renderer_backend.hpp>
 #include <memory>
 #include <functional>
+#include <vector>
 
 namespace mbgl {
 namespace vulkan {
@@ -18,7 +19,10 @@ public:
     ~HeadlessBackend() override;
     gfx::Renderable& getDefaultRenderable() override;
     PremultipliedImage readStillImage() override;
+    void readStillImageAsync(std::function<void(PremultipliedImage)> callback) override;
+    void processReadbacks(bool wait) override;
     RendererBackend* getRendererBackend() override;
+    void onBeginFrame() override;
 
     class Impl {
     public:
@@ -40,6 +44,12 @@ private:
     bool active = false;
 
     std::unique_ptr<Texture2D> texture;
+
+    // Copies of rendered images into staging buffers, in the order they were submitted
+    struct Readback;
+    std::vector<std::unique_ptr<Readback>> readbacks;
+    // Completed copies whose staging buffer, command buffer and fence are reused by later reads
+    std::vector<std::unique_ptr<Readback>> freeReadbacks;
 };
 
 } // namespace vulkan
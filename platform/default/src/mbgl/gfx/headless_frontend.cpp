@@ -1,14 +1,21 @@
 #include <mbgl/gfx/backend_scope.hpp>
 #include <mbgl/gfx/context.hpp>
 #include <mbgl/gfx/headless_frontend.hpp>
+#include <mbgl/gfx/headless_render_pool.hpp>
 #include <mbgl/map/map.hpp>
 #include <mbgl/map/transform_state.hpp>
 #include <mbgl/renderer/renderer.hpp>
 #include <mbgl/renderer/renderer_state.hpp>
 #include <mbgl/renderer/update_parameters.hpp>
 #include <mbgl/util/monotonic_timer.hpp>
+#include <mbgl/util/projection.hpp>
 #include <mbgl/util/run_loop.hpp>
 
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
 namespace mbgl {
 
 HeadlessFrontend::HeadlessFrontend(float pixelRatio_,
@@ -26,18 +33,42 @@ HeadlessFrontend::HeadlessFrontend(Size size_,
     : size(size_),
       pixelRatio(pixelRatio_),
       frameTime(0),
-      backend(gfx::HeadlessBackend::Create(
+      ownBackend(gfx::HeadlessBackend::Create(
           {static_cast<uint32_t>(size.width * pixelRatio), static_cast<uint32_t>(size.height * pixelRatio)},
           swapBehavior,
           contextMode)),
+      backend(ownBackend.get()),
       asyncInvalidate([this] { renderFrame(); }),
       invalidateOnUpdate(invalidateOnUpdate_),
       renderer(std::make_unique<Renderer>(*getBackend(), pixelRatio, localFontFamily)) {}
 
-HeadlessFrontend::~HeadlessFrontend() = default;
+HeadlessFrontend::HeadlessFrontend(HeadlessRenderPool& pool_,
+                                   Size size_,
+                                   float pixelRatio_,
+                                   const std::optional<std::string>& localFontFamily)
+    : size(size_),
+      pixelRatio(pixelRatio_),
+      frameTime(0),
+      pool(&pool_),
+      backend(&pool_.getBackend()),
+      asyncInvalidate([this] { renderFrame(); }),
+      invalidateOnUpdate(true),
+      renderer(std::make_unique<Renderer>(*getBackend(), pixelRatio, localFontFamily)) {}
+
+HeadlessFrontend::~HeadlessFrontend() {
+    if (pool && renderer) {
+        // Releasing the renderer's resources uses the shared context
+        HeadlessRenderPool::Slot slot{*pool, physicalSize()};
+        renderer.reset();
+    }
+}
 
 void HeadlessFrontend::reset() {
     assert(renderer);
+    std::optional<HeadlessRenderPool::Slot> slot;
+    if (pool) {
+        slot.emplace(*pool, physicalSize());
+    }
     renderer.reset();
 }
 
@@ -123,11 +154,17 @@ LatLng HeadlessFrontend::latLngForPixel(const ScreenCoordinate& point) {
 void HeadlessFrontend::setSize(Size size_) {
     if (size != size_) {
         size = size_;
-        backend->setSize(
-            {static_cast<uint32_t>(size_.width * pixelRatio), static_cast<uint32_t>(size_.height * pixelRatio)});
+        // The render slot sizes the shared backend for each frame
+        if (!pool) {
+            backend->setSize(physicalSize());
+        }
     }
 }
 
+Size HeadlessFrontend::physicalSize() const {
+    return {static_cast<uint32_t>(size.width * pixelRatio), static_cast<uint32_t>(size.height * pixelRatio)};
+}
+
 PremultipliedImage HeadlessFrontend::readStillImage() {
     return backend->readStillImage();
 }
@@ -135,7 +172,11 @@ PremultipliedImage HeadlessFrontend::readStillImage() {
 HeadlessFrontend::RenderResult HeadlessFrontend::render(Map& map) {
     HeadlessFrontend::RenderResult result;
     std::exception_ptr error;
-    gfx::BackendScope guard{*getBackend()};
+    // Frontends of a pool only use the context while they hold the render slot, in `renderFrame`
+    std::optional<gfx::BackendScope> guard;
+    if (!pool) {
+        guard.emplace(*getBackend());
+    }
 
     map.renderStill([&](const std::exception_ptr& e) {
         if (e) {
@@ -157,12 +198,100 @@ HeadlessFrontend::RenderResult HeadlessFrontend::render(Map& map) {
     return result;
 }
 
+void HeadlessFrontend::renderAsync(Map& map, std::function<void(RenderResult)> callback) {
+    if (pool) {
+        // Readbacks pending on the shared backend would complete on the thread of another frontend
+        callback(render(map));
+        return;
+    }
+
+    bool rendered = false;
+    std::exception_ptr error;
+    gfx::BackendScope guard{*getBackend()};
+
+    map.renderStill([&](const std::exception_ptr& e) {
+        if (e) {
+            error = e;
+            return;
+        }
+        rendered = true;
+        // The stats are those of the frame just rendered, the image arrives later
+        backend->readStillImageAsync(
+            [stats = getBackend()->getContext().renderingStats(), callback_ = std::move(callback)](
+                PremultipliedImage image) { callback_({.image = std::move(image), .stats = stats}); });
+    });
+
+    while (!rendered && !error) {
+        util::RunLoop::Get()->runOnce();
+    }
+
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+void HeadlessFrontend::processReadbacks(bool wait) {
+    if (pool) {
+        return;
+    }
+    gfx::BackendScope guard{*getBackend()};
+    backend->processReadbacks(wait);
+}
+
+HeadlessFrontend::MetatileResult HeadlessFrontend::renderMetatile(Map& map,
+                                                                  const CanonicalTileID& first,
+                                                                  const MetatileOptions& options) {
+    // Tiles smaller than the world at zoom 0 would need a negative map zoom
+    if ((uint64_t{options.tileSize} << first.z) < util::tileSize_I) {
+        throw std::invalid_argument("Tiles of " + std::to_string(options.tileSize) +
+                                    " pixels can't be rendered at zoom " + std::to_string(first.z));
+    }
+
+    const uint32_t tilesPerSide = 1u << first.z;
+    const uint32_t count = std::min(options.count, tilesPerSide);
+    const uint32_t blockSize = count * options.tileSize + 2 * options.buffer;
+    setSize({blockSize, blockSize});
+    map.setSize({blockSize, blockSize});
+    // The buffer of blocks at the poles extends beyond the world, which mustn't move the camera
+    map.setConstrainMode(ConstrainMode::None);
+
+    // Center on the middle of the block, at the zoom level where a tile covers `tileSize` pixels
+    const Point<double> center{(first.x + count / 2.0) * util::tileSize_D, (first.y + count / 2.0) * util::tileSize_D};
+    map.jumpTo(CameraOptions()
+                   .withCenter(Projection::unproject(center, tilesPerSide).wrapped())
+                   .withZoom(first.z + std::log2(options.tileSize / util::tileSize_D))
+                   .withBearing(0.0)
+                   .withPitch(0.0));
+
+    auto rendered = render(map);
+    MetatileResult result{.image = std::move(rendered.image), .stats = rendered.stats, .tiles = {}};
+
+    const auto tileSize = static_cast<uint32_t>(options.tileSize * pixelRatio);
+    const auto buffer = static_cast<uint32_t>(options.buffer * pixelRatio);
+    for (uint32_t y = 0; y < count && first.y + y < tilesPerSide; y++) {
+        for (uint32_t x = 0; x < count; x++) {
+            // Blocks crossing the antimeridian continue with the tiles on the other side
+            const CanonicalTileID id{first.z, (first.x + x) % tilesPerSide, first.y + y};
+            result.tiles.push_back(
+                {.id = id,
+                 .image = PremultipliedImageView(
+                     result.image, {buffer + x * tileSize, buffer + y * tileSize}, {tileSize, tileSize})});
+        }
+    }
+
+    return result;
+}
+
 void HeadlessFrontend::renderOnce(Map&) {
     util::RunLoop::Get()->runOnce();
 }
 
 void HeadlessFrontend::renderFrame() {
     if (renderer && updateParameters) {
+        std::optional<HeadlessRenderPool::Slot> slot;
+        if (pool) {
+            slot.emplace(*pool, physicalSize());
+        }
         auto startTime = mbgl::util::MonotonicTimer::now();
         gfx::BackendScope guard{*getBackend()};
 
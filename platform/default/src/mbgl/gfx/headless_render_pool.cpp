@@ -0,0 +1,65 @@
+#include <mbgl/gfx/headless_render_pool.hpp>
+
+#include <mbgl/gfx/backend.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace mbgl {
+
+HeadlessRenderPool::Slot::Slot(HeadlessRenderPool& pool_, Size size)
+    : pool(pool_),
+      requested(Clock::now()),
+      lock(pool.slotMutex),
+      acquired(Clock::now()) {
+    // Resizing drops the renderable's framebuffer, frontends of the same size don't recreate it
+    if (pool.backend->getSize() != size) {
+        pool.backend->setSize(size);
+    }
+}
+
+HeadlessRenderPool::Slot::~Slot() {
+    const auto released = Clock::now();
+    lock.unlock();
+    pool.record(acquired - requested, released - acquired);
+}
+
+HeadlessRenderPool::HeadlessRenderPool(gfx::HeadlessBackend::SwapBehaviour swapBehavior, gfx::ContextMode mode)
+    : backend(gfx::HeadlessBackend::Create({256, 256}, swapBehavior, mode)),
+      created(Clock::now()) {
+    if (gfx::Backend::GetType() != gfx::Backend::Type::OpenGL) {
+        throw std::runtime_error("HeadlessRenderPool requires the OpenGL backend");
+    }
+    backend->setSharedStaticData(true);
+}
+
+HeadlessRenderPool::~HeadlessRenderPool() = default;
+
+void HeadlessRenderPool::record(Duration wait, Duration render) {
+    std::lock_guard<std::mutex> lock(statsMutex);
+    frames++;
+    totalWaitTime += wait;
+    maxWaitTime = std::max(maxWaitTime, wait);
+    totalRenderTime += render;
+    maxRenderTime = std::max(maxRenderTime, render);
+}
+
+HeadlessRenderPool::Stats HeadlessRenderPool::getStats() const {
+    std::lock_guard<std::mutex> lock(statsMutex);
+    const auto elapsed = std::chrono::duration<double>(Clock::now() - created).count();
+    Stats stats;
+    stats.frames = frames;
+    stats.maxWaitTime = maxWaitTime;
+    stats.maxRenderTime = maxRenderTime;
+    if (frames) {
+        stats.averageWaitTime = totalWaitTime / frames;
+        stats.averageRenderTime = totalRenderTime / frames;
+    }
+    if (elapsed > 0) {
+        stats.framesPerSecond = static_cast<double>(frames) / elapsed;
+        stats.utilization = std::chrono::duration<double>(totalRenderTime).count() / elapsed;
+    }
+    return stats;
+}
+
+} // namespace mbgl
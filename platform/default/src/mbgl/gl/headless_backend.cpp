@@ -118,6 +118,16 @@ PremultipliedImage HeadlessBackend::readStillImage() {
     return static_cast<gl::Context&>(getContext()).readFramebuffer<PremultipliedImage>(size);
 }
 
+void HeadlessBackend::readStillImageAsync(std::function<void(PremultipliedImage)> callback) {
+    MLN_TRACE_FUNC();
+
+    static_cast<gl::Context&>(getContext()).readFramebufferAsync<PremultipliedImage>(size, std::move(callback));
+}
+
+void HeadlessBackend::processReadbacks(bool wait) {
+    static_cast<gl::Context&>(getContext()).processReadbacks(wait);
+}
+
 RendererBackend* HeadlessBackend::getRendererBackend() {
     return this;
 }
@@ -10,6 +10,7 @@
 #include <mbgl/util/constants.hpp>
 #include <mbgl/util/logging.hpp>
 #include <mbgl/util/platform.hpp>
+#include <mbgl/util/scheduler_telemetry.hpp>
 #include <mbgl/util/thread.hpp>
 
 #include <map>
@@ -23,9 +24,11 @@ public:
           onlineFileSource(std::move(onlineFileSource_)) {}
 
     void request(const Resource& resource, const ActorRef<FileSourceRequest>& req) {
-        std::optional<Response> offlineResponse = (resource.storagePolicy != Resource::StoragePolicy::Volatile)
-                                                      ? db->get(resource)
-                                                      : std::nullopt;
+        std::optional<Response> offlineResponse;
+        if (resource.storagePolicy != Resource::StoragePolicy::Volatile) {
+            const util::TaskTimer taskTimer(util::TaskCategory::Database);
+            offlineResponse = db->get(resource);
+        }
         if (!offlineResponse) {
             offlineResponse.emplace();
             offlineResponse->noContent = true;
@@ -46,7 +49,10 @@ public:
     }
 
     void forward(const Resource& resource, const Response& response, const std::function<void()>& callback) {
-        db->put(resource, response);
+        {
+            const util::TaskTimer taskTimer(util::TaskCategory::Database);
+            db->put(resource, response);
+        }
         if (callback) {
             callback();
         }
@@ -58,7 +64,10 @@ public:
 
     void runPackDatabaseAutomatically(bool autopack) { db->runPackDatabaseAutomatically(autopack); }
 
-    void put(const Resource& resource, const Response& response) { db->put(resource, response); }
+    void put(const Resource& resource, const Response& response) {
+        const util::TaskTimer taskTimer(util::TaskCategory::Database);
+        db->put(resource, response);
+    }
 
     void invalidateAmbientCache(const std::function<void(std::exception_ptr)>& callback) {
         callback(db->invalidateAmbientCache());
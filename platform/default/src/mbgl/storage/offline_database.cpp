@@ -11,6 +11,10 @@
 #include <mbgl/storage/offline_schema.hpp>
 #include <mbgl/storage/merge_sideloaded.hpp>
 
+#include <algorithm>
+#include <numeric>
+#include <tuple>
+
 namespace mbgl {
 
 OfflineDatabase::OfflineDatabase(std::string path_, const TileServerOptions& options)
@@ -294,24 +298,37 @@ std::pair<bool, uint64_t> OfflineDatabase::put(const Resource& resource, const R
     return {false, 0};
 }
 
+std::optional<std::string> OfflineDatabase::compressData(const Response& response) {
+    if (response.error || !response.data) {
+        return std::nullopt;
+    }
+    auto compressedData = util::compress(*response.data);
+    if (compressedData.size() >= response.data->size()) {
+        return std::nullopt;
+    }
+    return compressedData;
+}
+
 std::pair<bool, uint64_t> OfflineDatabase::putInternal(const Resource& resource,
                                                        const Response& response,
                                                        bool evict_) {
+    return putInternal(resource, response, compressData(response), evict_);
+}
+
+std::pair<bool, uint64_t> OfflineDatabase::putInternal(const Resource& resource,
+                                                       const Response& response,
+                                                       const std::optional<std::string>& compressedData,
+                                                       bool evict_) {
     checkFlags();
 
     if (response.error) {
         return {false, 0};
     }
 
-    std::string compressedData;
-    bool compressed = false;
-    uint64_t size = 0;
-
-    if (response.data) {
-        compressedData = util::compress(*response.data);
-        compressed = compressedData.size() < response.data->size();
-        size = compressed ? compressedData.size() : response.data->size();
-    }
+    const bool compressed = compressedData.has_value();
+    const uint64_t size = compressed      ? compressedData->size()
+                          : response.data ? response.data->size()
+                                          : 0;
 
     std::optional<DatabaseSizeChangeStats> stats;
     if (evict_) {
@@ -328,14 +345,14 @@ std::pair<bool, uint64_t> OfflineDatabase::putInternal(const Resource& resource,
         assert(resource.tileData);
         inserted = putTile(*resource.tileData,
                            response,
-                           compressed      ? compressedData
+                           compressed      ? *compressedData
                            : response.data ? *response.data
                                            : "",
                            compressed);
     } else {
         inserted = putResource(resource,
                                response,
-                               compressed      ? compressedData
+                               compressed      ? *compressedData
                                : response.data ? *response.data
                                                : "",
                                compressed);
@@ -1011,6 +1028,79 @@ std::optional<int64_t> OfflineDatabase::hasRegionResource(const Resource& resour
     return std::nullopt;
 }
 
+std::vector<std::optional<int64_t>> OfflineDatabase::hasRegionTiles(const std::vector<Resource::TileData>& tiles) try {
+    std::vector<std::optional<int64_t>> result(tiles.size());
+
+    // clang-format off
+    mapbox::sqlite::Query query{ getStatement(
+        "SELECT y, length(data) "
+        "FROM tiles "
+        "WHERE url_template = ?1 "
+        "  AND pixel_ratio  = ?2 "
+        "  AND z            = ?3 "
+        "  AND x            = ?4 "
+        "  AND y BETWEEN ?5 AND ?6 ") };
+    // clang-format on
+
+    // Tile covers enumerate rows, so sort the tiles into columns first.
+    std::vector<std::size_t> order(tiles.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](std::size_t lhs, std::size_t rhs) {
+        const Resource::TileData& a = tiles[lhs];
+        const Resource::TileData& b = tiles[rhs];
+        return std::tie(a.urlTemplate, a.pixelRatio, a.z, a.x, a.y) <
+               std::tie(b.urlTemplate, b.pixelRatio, b.z, b.x, b.y);
+    });
+
+    std::size_t begin = 0;
+    while (begin < order.size()) {
+        const Resource::TileData& first = tiles[order[begin]];
+        int32_t maxY = first.y;
+
+        std::size_t end = begin + 1;
+        for (; end < order.size(); ++end) {
+            const Resource::TileData& tile = tiles[order[end]];
+            if (tile.x != first.x || tile.z != first.z || tile.pixelRatio != first.pixelRatio ||
+                tile.urlTemplate != first.urlTemplate) {
+                break;
+            }
+            maxY = tile.y;
+        }
+
+        // Look up the column of the run. With x fixed, the (url_template,
+        // pixel_ratio, z, x, y) index serves the y bounds as a range scan
+        // that only visits rows of this column.
+        query.bind(1, first.urlTemplate);
+        query.bind(2, first.pixelRatio);
+        query.bind(3, first.z);
+        query.bind(4, first.x);
+        query.bind(5, first.y);
+        query.bind(6, maxY);
+
+        std::map<int64_t, int64_t> stored;
+        while (query.run()) {
+            if (auto size = query.get<std::optional<int64_t>>(1)) {
+                stored.emplace(query.get<int64_t>(0), *size);
+            }
+        }
+        query.reset();
+
+        for (std::size_t i = begin; i < end; ++i) {
+            auto it = stored.find(tiles[order[i]].y);
+            if (it != stored.end()) {
+                result[order[i]] = it->second;
+            }
+        }
+
+        begin = end;
+    }
+
+    return result;
+} catch (...) {
+    handleError("query region tiles");
+    return std::vector<std::optional<int64_t>>(tiles.size());
+}
+
 uint64_t OfflineDatabase::putRegionResource(int64_t regionID, const Resource& resource, const Response& response) try {
     checkFlags();
 
@@ -1018,7 +1108,7 @@ uint64_t OfflineDatabase::putRegionResource(int64_t regionID, const Resource& re
         initialize();
     }
     mapbox::sqlite::Transaction transaction(*db);
-    auto size = putRegionResourceInternal(regionID, resource, response);
+    auto size = putRegionResourceInternal(regionID, resource, response, compressData(response));
     transaction.commit();
     return size;
 } catch (...) {
@@ -1028,7 +1118,18 @@ uint64_t OfflineDatabase::putRegionResource(int64_t regionID, const Resource& re
 
 void OfflineDatabase::putRegionResources(int64_t regionID,
                                          const std::list<std::tuple<Resource, Response>>& resources,
-                                         OfflineRegionStatus& status) try {
+                                         OfflineRegionStatus& status) {
+    std::list<std::tuple<Resource, Response, std::optional<std::string>>> compressedResources;
+    for (const auto& [resource, response] : resources) {
+        compressedResources.emplace_back(resource, response, compressData(response));
+    }
+    putRegionResources(regionID, compressedResources, status);
+}
+
+void OfflineDatabase::putRegionResources(
+    int64_t regionID,
+    const std::list<std::tuple<Resource, Response, std::optional<std::string>>>& resources,
+    OfflineRegionStatus& status) try {
     checkFlags();
 
     if (!db) {
@@ -1049,7 +1150,7 @@ void OfflineDatabase::putRegionResources(int64_t regionID,
         const auto& response = std::get<1>(elem);
 
         try {
-            uint64_t resourceSize = putRegionResourceInternal(regionID, resource, response);
+            uint64_t resourceSize = putRegionResourceInternal(regionID, resource, response, std::get<2>(elem));
             completedResourceCount++;
             completedResourceSize += resourceSize;
             if (resource.kind == Resource::Kind::Tile) {
@@ -1076,10 +1177,11 @@ void OfflineDatabase::putRegionResources(int64_t regionID,
 
 uint64_t OfflineDatabase::putRegionResourceInternal(int64_t regionID,
                                                     const Resource& resource,
-                                                    const Response& response) {
+                                                    const Response& response,
+                                                    const std::optional<std::string>& compressedData) {
     checkFlags();
 
-    uint64_t size = putInternal(resource, response, false).second;
+    uint64_t size = putInternal(resource, response, compressedData, false).second;
     bool previouslyUnused = markUsed(regionID, resource);
 
     if (previouslyUnused && exceedsOfflineMapboxTileCountLimit(resource)) {
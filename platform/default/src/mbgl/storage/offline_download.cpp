@@ -1,3 +1,4 @@
+#include <mbgl/actor/scheduler.hpp>
 #include <mbgl/storage/offline_database.hpp>
 #include <mbgl/storage/offline_download.hpp>
 #include <mbgl/storage/resource.hpp>
@@ -15,16 +16,30 @@
 #include <mbgl/text/glyph.hpp>
 #include <mbgl/util/i18n.hpp>
 #include <mbgl/util/mapbox.hpp>
+#include <mbgl/util/monotonic_timer.hpp>
 #include <mbgl/util/run_loop.hpp>
 #include <mbgl/util/tile_cover.hpp>
 #include <mbgl/util/tileset.hpp>
+#include <mbgl/util/url.hpp>
 
+#include <mapbox/geometry/envelope.hpp>
+
+#include <algorithm>
+#include <cassert>
 #include <set>
 
 namespace {
 
 const size_t kResourcesBatchSize = 64;
 const size_t kMarkBatchSize = 200;
+// Number of tiles whose existence is checked with a single query.
+const size_t kTileExistenceBatchSize = 256;
+// Number of existence batches checked before yielding to the run loop.
+const size_t kTileExistenceBatchesPerStep = 16;
+// Number of queued resources looked at for one with an unsaturated host.
+const size_t kMaxDispatchScan = 512;
+// Average latency this many times the fastest response is treated as congestion.
+const double kCongestionLatencyFactor = 3;
 
 } // namespace
 
@@ -49,30 +64,15 @@ Range<uint8_t> coveringZoomRange(const RegionDefinition& definition,
     return {static_cast<uint8_t>(minZ), static_cast<uint8_t>(maxZ)};
 }
 
-template <class Geometry, class Fn>
-void tileCover(const Geometry& geometry, uint8_t z, Fn&& fn) {
-    util::TileCover cover(geometry, z);
-    while (cover.hasNext()) {
-        fn(cover.next()->canonical);
-    }
-}
-
-template <class Fn>
-void tileCover(const OfflineRegionDefinition& definition,
-               style::SourceType type,
-               uint16_t tileSize,
-               const Range<uint8_t>& zoomRange,
-               Fn&& fn) {
-    const Range<uint8_t> clampedZoomRange = std::visit(
-        [&](auto& reg) { return coveringZoomRange(reg, type, tileSize, zoomRange); }, definition);
-
-    for (uint8_t z = clampedZoomRange.min; z <= clampedZoomRange.max; z++) {
-        std::visit(overloaded{[&](const OfflineTilePyramidRegionDefinition& reg) { tileCover(reg.bounds, z, fn); },
-                              [&](const OfflineGeometryRegionDefinition& reg) {
-                                  tileCover(reg.geometry, z, fn);
-                              }},
-                   definition);
-    }
+std::unique_ptr<util::TileCover> tileCover(const OfflineRegionDefinition& definition, uint8_t z) {
+    return std::visit(
+        overloaded{[&](const OfflineTilePyramidRegionDefinition& reg) {
+                       return std::make_unique<util::TileCover>(reg.bounds, z);
+                   },
+                   [&](const OfflineGeometryRegionDefinition& reg) {
+                       return std::make_unique<util::TileCover>(reg.geometry, z);
+                   }},
+        definition);
 }
 
 uint64_t tileCount(const OfflineRegionDefinition& definition,
@@ -95,8 +95,90 @@ uint64_t tileCount(const OfflineRegionDefinition& definition,
     return result;
 }
 
+// Counts the tiles covering the bounding box of the region, which takes constant time per zoom level.
+// Unlike tileCount(), geometry regions aren't covered tile by tile, so they're overestimated.
+uint64_t estimateTileCount(const OfflineRegionDefinition& definition,
+                           style::SourceType type,
+                           uint16_t tileSize,
+                           const Range<uint8_t>& zoomRange) {
+    const Range<uint8_t> clampedZoomRange = std::visit(
+        [&](auto& reg) { return coveringZoomRange(reg, type, tileSize, zoomRange); }, definition);
+    const LatLngBounds bounds = std::visit(
+        overloaded{[](const OfflineTilePyramidRegionDefinition& reg) { return reg.bounds; },
+                   [](const OfflineGeometryRegionDefinition& reg) {
+                       const auto box = mapbox::geometry::envelope(reg.geometry);
+                       return LatLngBounds::hull({box.min.y, box.min.x}, {box.max.y, box.max.x});
+                   }},
+        definition);
+
+    uint64_t result{};
+    for (uint8_t z = clampedZoomRange.min; z <= clampedZoomRange.max; z++) {
+        result += util::tileCount(bounds, z);
+    }
+
+    return result;
+}
+
+// HostConcurrency
+
+HostConcurrency::HostConcurrency(uint32_t maxLimit_)
+    : maxLimit(std::max<uint32_t>(maxLimit_, 1)),
+      limit(maxLimit) {}
+
+void HostConcurrency::requestStarted() {
+    inFlight++;
+}
+
+void HostConcurrency::requestFinished() {
+    assert(inFlight > 0);
+    inFlight--;
+}
+
+void HostConcurrency::requestSucceeded(Duration latency) {
+    requestFinished();
+    responsesSinceDecrease++;
+
+    if (minLatency == Duration::zero() || latency < minLatency) {
+        minLatency = latency;
+    }
+    averageLatency = averageLatency == Duration::zero() ? latency : averageLatency * 0.875 + latency * 0.125;
+
+    if (averageLatency > minLatency * kCongestionLatencyFactor) {
+        decrease();
+    } else {
+        // Adds up to one request per window of `limit` responses.
+        limit = std::min(maxLimit, limit + 1 / limit);
+    }
+}
+
+void HostConcurrency::requestFailed() {
+    responsesSinceDecrease++;
+    decrease();
+}
+
+void HostConcurrency::decrease() {
+    // Responses to requests sent before the last decrease still reflect the
+    // old limit, so wait for a window of new ones before backing off again.
+    if (decreased && responsesSinceDecrease < limit) {
+        return;
+    }
+    limit = std::max(1.0, limit / 2);
+    responsesSinceDecrease = 0;
+    decreased = true;
+}
+
 // OfflineDownload
 
+struct OfflineDownload::TileQueue {
+    Tileset tileset;
+    Range<uint8_t> zoomRange;
+    uint8_t z;
+    std::unique_ptr<util::TileCover> cover;
+    // Tiles counted into the status up front, and tiles enumerated so far.
+    uint64_t expectedCount;
+    uint64_t enumeratedCount = 0;
+};
+
 OfflineDownload::OfflineDownload(int64_t id_,
                                  OfflineRegionDefinition definition_,
                                  OfflineDatabase& offlineDatabase_,
@@ -240,6 +322,7 @@ OfflineRegionStatus OfflineDownload::getStatus() const {
 }
 
 void OfflineDownload::activateDownload() {
+    weakFactory = std::make_unique<mapbox::base::WeakPtrFactory<OfflineDownload>>(this);
     status = OfflineRegionStatus();
     status.downloadState = OfflineRegionDownloadState::Active;
     status.requiredResourceCount++;
@@ -394,6 +477,20 @@ void OfflineDownload::activateDownload() {
 */
 void OfflineDownload::continueDownload() {
     if (resourcesRemaining.empty()) {
+        queueNextTiles();
+    }
+
+    if (resourcesRemaining.empty()) {
+        if (!tileQueues.empty()) {
+            // Every tile checked so far is stored already. Check the next ones
+            // from the run loop rather than blocking it for the whole region.
+            if (resourcesToBeMarkedAsUsed.size() >= kMarkBatchSize) markPendingUsedResources();
+            if (requests.empty()) {
+                scheduleContinueDownload();
+            }
+            return;
+        }
+
         // Flush pending buffers.
         if (!flushResourcesBuffer()) return;
         if (status.complete()) {
@@ -405,23 +502,63 @@ void OfflineDownload::continueDownload() {
 
     if (resourcesToBeMarkedAsUsed.size() >= kMarkBatchSize) markPendingUsedResources();
 
-    uint32_t maxConcurrentRequests = util::DEFAULT_MAXIMUM_CONCURRENT_REQUESTS;
+    // Requests are spread over hosts by their own limits, so a slow or failing
+    // host doesn't hold back resources queued for other hosts.
+    const uint32_t maxRequests = maxConcurrentRequests();
+    auto next = resourcesRemaining.begin();
+    for (std::size_t scanned = 0; requests.size() < maxRequests && scanned < kMaxDispatchScan; scanned++) {
+        if (next == resourcesRemaining.end()) {
+            if (!resourcesRemaining.empty()) {
+                // Everything left waits for a saturated host.
+                break;
+            }
+            queueNextTiles();
+            next = resourcesRemaining.begin();
+            if (next == resourcesRemaining.end()) {
+                break;
+            }
+        }
+
+        if (!hostConcurrency(*next).hasCapacity()) {
+            ++next;
+            continue;
+        }
+
+        ensureResource(std::move(*next));
+        next = resourcesRemaining.erase(next);
+    }
+}
+
+uint32_t OfflineDownload::maxConcurrentRequests() const {
     auto value = onlineFileSource.getProperty(MAX_CONCURRENT_REQUESTS_KEY);
     if (uint64_t* maxRequests = value.getUint()) {
-        maxConcurrentRequests = static_cast<uint32_t>(*maxRequests);
+        return static_cast<uint32_t>(*maxRequests);
     }
+    return util::DEFAULT_MAXIMUM_CONCURRENT_REQUESTS;
+}
 
-    while (!resourcesRemaining.empty() && requests.size() < maxConcurrentRequests) {
-        ensureResource(std::move(resourcesRemaining.front()));
-        resourcesRemaining.pop_front();
-    }
+HostConcurrency& OfflineDownload::hostConcurrency(const Resource& resource) {
+    const util::URL url(resource.url);
+    auto host = resource.url.substr(url.domain.first, url.domain.second);
+    return hosts.try_emplace(std::move(host), maxConcurrentRequests()).first->second;
+}
+
+void OfflineDownload::scheduleContinueDownload() {
+    auto workRequestsIt = requests.insert(requests.begin(), nullptr);
+    *workRequestsIt = util::RunLoop::Get()->invokeCancellable([workRequestsIt, this]() {
+        requests.erase(workRequestsIt);
+        continueDownload();
+    });
 }
 
 void OfflineDownload::deactivateDownload() {
     requiredSourceURLs.clear();
     resourcesRemaining.clear();
+    tileQueues.clear();
     requests.clear();
+    hosts.clear();
     buffer.clear();
+    weakFactory.reset();
 }
 
 bool OfflineDownload::flushResourcesBuffer() {
@@ -448,22 +585,105 @@ void OfflineDownload::queueResource(Resource&& resource) {
 }
 
 void OfflineDownload::queueTiles(SourceType type, uint16_t tileSize, const Tileset& tileset) {
-    tileCover(definition, type, tileSize, tileset.zoomRange, [&](const auto& tile) {
-        status.requiredResourceCount++;
-        status.requiredTileCount++;
+    // The tiles themselves are enumerated on demand by queueNextTiles(), which settles the estimate.
+    const uint64_t count = estimateTileCount(definition, type, tileSize, tileset.zoomRange);
+    status.requiredResourceCount += count;
+    status.requiredTileCount += count;
+
+    const Range<uint8_t> zoomRange = std::visit(
+        [&](auto& reg) { return coveringZoomRange(reg, type, tileSize, tileset.zoomRange); }, definition);
+    tileQueues.push_back(
+        {.tileset = tileset, .zoomRange = zoomRange, .z = zoomRange.min, .cover = nullptr, .expectedCount = count});
+}
 
-        auto tileResource = Resource::tile(tileset.tiles[0],
-                                           std::visit([](auto& def) { return def.pixelRatio; }, definition),
-                                           tile.x,
-                                           tile.y,
-                                           tile.z,
-                                           tileset.scheme);
+void OfflineDownload::queueNextTiles() {
+    const float pixelRatio = std::visit([](auto& def) { return def.pixelRatio; }, definition);
 
-        tileResource.setPriority(Resource::Priority::Low);
-        tileResource.setUsage(Resource::Usage::Offline);
+    for (std::size_t step = 0; step < kTileExistenceBatchesPerStep && resourcesRemaining.empty() && !tileQueues.empty();
+         ++step) {
+        TileQueue& queue = tileQueues.front();
 
-        resourcesRemaining.push_back(std::move(tileResource));
-    });
+        std::vector<Resource> batch;
+        batch.reserve(kTileExistenceBatchSize);
+        while (batch.size() < kTileExistenceBatchSize && queue.z <= queue.zoomRange.max) {
+            if (!queue.cover) {
+                queue.cover = tileCover(definition, queue.z);
+            }
+
+            const std::optional<UnwrappedTileID> tile = queue.cover->next();
+            if (!tile) {
+                queue.cover.reset();
+                queue.z++;
+                continue;
+            }
+
+            queue.enumeratedCount++;
+            auto tileResource = Resource::tile(queue.tileset.tiles[0],
+                                               pixelRatio,
+                                               tile->canonical.x,
+                                               tile->canonical.y,
+                                               tile->canonical.z,
+                                               queue.tileset.scheme);
+            tileResource.setPriority(Resource::Priority::Low);
+            tileResource.setUsage(Resource::Usage::Offline);
+
+            // Tiles are stored under the first URL template, but fetched from
+            // all the hosts the tileset lists.
+            if (const std::size_t mirrors = queue.tileset.tiles.size(); mirrors > 1) {
+                const auto& urlTemplate = queue.tileset.tiles[(tile->canonical.x + tile->canonical.y) % mirrors];
+                tileResource.url = Resource::tile(urlTemplate,
+                                                  pixelRatio,
+                                                  tile->canonical.x,
+                                                  tile->canonical.y,
+                                                  tile->canonical.z,
+                                                  queue.tileset.scheme)
+                                       .url;
+            }
+
+            batch.push_back(std::move(tileResource));
+        }
+
+        if (queue.z > queue.zoomRange.max) {
+            // The up front count covers the bounding box of the region, which
+            // is more than geometry regions need. Settle it now that the actual
+            // number of tiles is known.
+            status.requiredResourceCount += queue.enumeratedCount;
+            status.requiredResourceCount -= queue.expectedCount;
+            status.requiredTileCount += queue.enumeratedCount;
+            status.requiredTileCount -= queue.expectedCount;
+            tileQueues.pop_front();
+        }
+
+        if (batch.empty()) {
+            continue;
+        }
+
+        std::vector<Resource::TileData> tiles;
+        tiles.reserve(batch.size());
+        for (const auto& resource : batch) {
+            tiles.push_back(*resource.tileData);
+        }
+
+        // Only tiles that aren't stored yet are requested one by one.
+        const auto sizes = offlineDatabase.hasRegionTiles(tiles);
+        bool completedTiles = false;
+        for (std::size_t i = 0; i < batch.size(); ++i) {
+            if (sizes[i]) {
+                status.completedResourceCount++;
+                status.completedResourceSize += *sizes[i];
+                status.completedTileCount++;
+                status.completedTileSize += *sizes[i];
+                resourcesToBeMarkedAsUsed.push_back(std::move(batch[i]));
+                completedTiles = true;
+            } else {
+                resourcesRemaining.push_back(std::move(batch[i]));
+            }
+        }
+
+        if (completedTiles) {
+            observer->statusChanged(status);
+        }
+    }
 }
 
 void OfflineDownload::markPendingUsedResources() {
@@ -475,6 +695,8 @@ void OfflineDownload::ensureResource(Resource&& resource, std::function<void(Res
     assert(resource.priority == Resource::Priority::Low);
     assert(resource.usage == Resource::Usage::Offline);
 
+    hostConcurrency(resource).requestStarted();
+
     auto workRequestsIt = requests.insert(requests.begin(), nullptr);
     *workRequestsIt = util::RunLoop::Get()->invokeCancellable([=, this]() {
         requests.erase(workRequestsIt);
@@ -505,6 +727,7 @@ void OfflineDownload::ensureResource(Resource&& resource, std::function<void(Res
                 status.completedTileSize += *offlineResponse;
             }
 
+            hostConcurrency(resource).requestFinished();
             observer->statusChanged(status);
             continueDownload();
             return;
@@ -515,43 +738,72 @@ void OfflineDownload::ensureResource(Resource&& resource, std::function<void(Res
             return;
         }
 
+        const auto requested = util::MonotonicTimer::now();
         auto fileRequestsIt = requests.insert(requests.begin(), nullptr);
         *fileRequestsIt = onlineFileSource.request(resource, [=, this](const Response& onlineResponse) {
+            HostConcurrency& host = hostConcurrency(resource);
             if (onlineResponse.error) {
                 observer->responseError(*onlineResponse.error);
                 if (onlineResponse.error->reason == Response::Error::Reason::NotFound) {
                     // On error 404, we skip this request and go further.
+                    host.requestSucceeded(util::MonotonicTimer::now() - requested);
                     requests.erase(fileRequestsIt);
                     assert(status.requiredResourceCount > 0);
                     status.requiredResourceCount--;
                     continueDownload();
+                } else {
+                    host.requestFailed();
                 }
                 return;
             }
 
+            host.requestSucceeded(util::MonotonicTimer::now() - requested);
             requests.erase(fileRequestsIt);
 
             if (callback) {
                 callback(onlineResponse);
             }
 
+            bufferResponse(resource, onlineResponse);
+            continueDownload();
+        });
+    });
+}
+
+void OfflineDownload::bufferResponse(const Resource& resource, const Response& response) {
+    // Only writing the data is left to the database thread
+    Scheduler::GetBackground()->scheduleAndReplyValue(
+        util::SimpleIdentity::Empty,
+        [response] { return OfflineDatabase::compressData(response); },
+        [this, resource, response, weak = weakFactory->makeWeakPtr()](std::optional<std::string> compressedData) {
+            // Replies run on this thread, which is where the download is deactivated or destroyed. A
+            // guard isn't needed, and would block deactivating the download from the reply.
+            if (!weak) {
+                return;
+            }
+
             // Queue up for batched insertion
-            buffer.emplace_back(resource, onlineResponse);
+            buffer.emplace_back(resource, response, std::move(compressedData));
 
-            // Flush buffer periodically.
-            // Have to keep `resourcesRemaining.empty()` as the following
-            // condition would fail otherwise.
+            // Flush buffer periodically, and once nothing is left to request.
+            // Tiles that are still to be enumerated don't count as nothing
+            // left, so the tail of every batch doesn't flush one by one.
+            // Have to keep the emptiness check as the following condition
+            // would fail otherwise.
             // TODO: Simplify the tile count limit check code path!
-            if ((buffer.size() == kResourcesBatchSize || resourcesRemaining.empty()) && !flushResourcesBuffer()) return;
+            const bool drained = resourcesRemaining.empty() && tileQueues.empty();
+            if ((buffer.size() == kResourcesBatchSize || drained) && !flushResourcesBuffer()) return;
 
             if (offlineDatabase.exceedsOfflineMapboxTileCountLimit(resource)) {
                 onMapboxTileCountLimitExceeded();
                 return;
             }
 
-            continueDownload();
+            // The last responses complete the download
+            if (drained) {
+                continueDownload();
+            }
         });
-    });
 }
 
 void OfflineDownload::onMapboxTileCountLimitExceeded() {
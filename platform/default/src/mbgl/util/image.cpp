@@ -1,4 +1,5 @@
 #include <mbgl/util/image.hpp>
+#include <mbgl/util/image_encoder.hpp>
 #include <mbgl/util/string.hpp>
 #include <mbgl/util/premultiply.hpp>
 
@@ -8,6 +9,10 @@ PremultipliedImage decodePNG(const uint8_t*, size_t);
 PremultipliedImage decodeJPEG(const uint8_t*, size_t);
 PremultipliedImage decodeWEBP(const uint8_t*, size_t);
 
+std::unique_ptr<ImageEncoder> createPNGEncoder(const ImageEncoderOptions&);
+std::unique_ptr<ImageEncoder> createJPEGEncoder(const ImageEncoderOptions&);
+std::unique_ptr<ImageEncoder> createWebPEncoder(const ImageEncoderOptions&);
+
 PremultipliedImage decodeImage(const std::string& string) {
     const auto* data = reinterpret_cast<const uint8_t*>(string.data());
     const size_t size = string.size();
@@ -44,4 +49,16 @@ PremultipliedImage decodeImage(const std::string& string) {
     throw std::runtime_error("unsupported image type");
 }
 
+std::unique_ptr<ImageEncoder> ImageEncoder::create(const ImageEncoderOptions& options) {
+    switch (options.encoding) {
+        case ImageEncoding::PNG:
+            return createPNGEncoder(options);
+        case ImageEncoding::WebP:
+            return createWebPEncoder(options);
+        case ImageEncoding::JPEG:
+            return createJPEGEncoder(options);
+    }
+    return nullptr;
+}
+
 } // namespace mbgl
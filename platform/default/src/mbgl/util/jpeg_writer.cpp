@@ -0,0 +1,121 @@
+#include <mbgl/util/image.hpp>
+#include <mbgl/util/image_encoder.hpp>
+
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+extern "C" {
+#include <jpeglib.h>
+}
+
+namespace mbgl {
+
+namespace {
+
+const static unsigned BUF_SIZE = 16384;
+
+// Appends the compressed data to a string
+struct jpeg_string_destination {
+    jpeg_destination_mgr manager;
+    std::string* output;
+    std::array<JOCTET, BUF_SIZE> buffer;
+};
+
+void init_destination(j_compress_ptr cinfo) {
+    auto* dest = reinterpret_cast<jpeg_string_destination*>(cinfo->dest);
+    dest->manager.next_output_byte = dest->buffer.data();
+    dest->manager.free_in_buffer = BUF_SIZE;
+}
+
+boolean empty_output_buffer(j_compress_ptr cinfo) {
+    auto* dest = reinterpret_cast<jpeg_string_destination*>(cinfo->dest);
+    dest->output->append(reinterpret_cast<const char*>(dest->buffer.data()), BUF_SIZE);
+    dest->manager.next_output_byte = dest->buffer.data();
+    dest->manager.free_in_buffer = BUF_SIZE;
+    return TRUE;
+}
+
+void term_destination(j_compress_ptr cinfo) {
+    auto* dest = reinterpret_cast<jpeg_string_destination*>(cinfo->dest);
+    dest->output->append(reinterpret_cast<const char*>(dest->buffer.data()), BUF_SIZE - dest->manager.free_in_buffer);
+}
+
+void on_error(j_common_ptr cinfo) {
+    char buffer[JMSG_LENGTH_MAX];
+    (*cinfo->err->format_message)(cinfo, buffer);
+    throw std::runtime_error(std::string("JPEG Writer: libjpeg could not write image: ") + buffer);
+}
+
+void on_error_message(j_common_ptr) {}
+
+} // namespace
+
+class JPEGEncoder final : public ImageEncoder {
+public:
+    explicit JPEGEncoder(const ImageEncoderOptions& options)
+        : quality(std::clamp(options.quality, 0, 100)) {
+        cinfo.err = jpeg_std_error(&jerr);
+        jerr.error_exit = on_error;
+        jerr.output_message = on_error_message;
+        jpeg_create_compress(&cinfo);
+
+        cinfo.dest = &destination.manager;
+        destination.manager.init_destination = init_destination;
+        destination.manager.empty_output_buffer = empty_output_buffer;
+        destination.manager.term_destination = term_destination;
+    }
+    JPEGEncoder(const JPEGEncoder&) = delete;
+    JPEGEncoder& operator=(const JPEGEncoder&) = delete;
+    ~JPEGEncoder() override { jpeg_destroy_compress(&cinfo); }
+
+    // JPEG has no alpha channel, transparent pixels end up composited over black
+    std::string encode(const PremultipliedImageView& image) override {
+        std::string result;
+        destination.output = &result;
+
+        cinfo.image_width = image.size.width;
+        cinfo.image_height = image.size.height;
+        cinfo.input_components = 3;
+        cinfo.in_color_space = JCS_RGB;
+        jpeg_set_defaults(&cinfo);
+        jpeg_set_quality(&cinfo, quality, TRUE);
+
+        try {
+            jpeg_start_compress(&cinfo, TRUE);
+            row.resize(static_cast<std::size_t>(image.size.width) * 3);
+            while (cinfo.next_scanline < cinfo.image_height) {
+                const uint8_t* source = image.row(cinfo.next_scanline);
+                for (std::size_t x = 0; x < image.size.width; x++) {
+                    row[x * 3 + 0] = source[x * 4 + 0];
+                    row[x * 3 + 1] = source[x * 4 + 1];
+                    row[x * 3 + 2] = source[x * 4 + 2];
+                }
+                JSAMPROW rowPointer = row.data();
+                jpeg_write_scanlines(&cinfo, &rowPointer, 1);
+            }
+            jpeg_finish_compress(&cinfo);
+        } catch (...) {
+            jpeg_abort_compress(&cinfo);
+            throw;
+        }
+
+        return result;
+    }
+
+private:
+    const int quality;
+    jpeg_compress_struct cinfo{};
+    jpeg_error_mgr jerr{};
+    jpeg_string_destination destination{};
+    // Row converted to RGB, reused between rows and images
+    std::vector<JSAMPLE> row;
+};
+
+std::unique_ptr<ImageEncoder> createJPEGEncoder(const ImageEncoderOptions& options) {
+    return std::make_unique<JPEGEncoder>(options);
+}
+
+} // namespace mbgl
@@ -1,11 +1,18 @@
-#include <mbgl/util/compression.hpp>
+#include <mbgl/actor/scheduler.hpp>
 #include <mbgl/util/image.hpp>
-#include <mbgl/util/premultiply.hpp>
+#include <mbgl/util/image_encoder.hpp>
+#include <mbgl/util/identity.hpp>
+#include <mbgl/util/parallel_for.hpp>
 
 #include <boost/crc.hpp>
 
+#include <zlib.h>
+
+#include <algorithm>
 #include <cassert>
 #include <cstring>
+#include <stdexcept>
+#include <vector>
 
 #define NETWORK_BYTE_UINT32(value) char((value) >> 24), char((value) >> 16), char((value) >> 8), char((value) >> 0)
 
@@ -29,39 +36,147 @@ void addChunk(std::string& png, const char* type, const char* data = "", const u
     png.append(crc, 4);
 }
 
+// Rows are only split between tasks if each gets at least this many bytes
+constexpr std::size_t minBytesPerThread = 128 * 1024;
+// Deflate window, which also bounds the dictionary a row group gets from the rows before it
+constexpr std::size_t windowSize = 32 * 1024;
+
+// A raw deflate stream compressing a group of rows, which is reset for every image
+class DeflateGroup {
+public:
+    explicit DeflateGroup(int level) {
+        // Negative window bits make a raw stream, the zlib header and checksum are written for all groups at once
+        if (deflateInit2(&stream, level, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+            throw std::runtime_error("failed to initialize deflate");
+        }
+    }
+    DeflateGroup(const DeflateGroup&) = delete;
+    DeflateGroup& operator=(const DeflateGroup&) = delete;
+    ~DeflateGroup() { deflateEnd(&stream); }
+
+    // Compresses `size` bytes at `data`, using the bytes before `data` back to `dictionaryStart` as
+    // history. All groups but the last end with a sync flush so that their output can be concatenated.
+    void compress(const uint8_t* dictionaryStart, const uint8_t* data, std::size_t size, bool last) {
+        deflateReset(&stream);
+        if (data > dictionaryStart) {
+            deflateSetDictionary(&stream, dictionaryStart, static_cast<uInt>(data - dictionaryStart));
+        }
+
+        output.resize(std::max<std::size_t>(output.size(), deflateBound(&stream, static_cast<uLong>(size)) + 16));
+        stream.next_in = const_cast<Bytef*>(data);
+        stream.avail_in = static_cast<uInt>(size);
+        stream.next_out = output.data();
+        stream.avail_out = static_cast<uInt>(output.size());
+
+        const int code = deflate(&stream, last ? Z_FINISH : Z_SYNC_FLUSH);
+        if ((last && code != Z_STREAM_END) || (!last && code != Z_OK) || stream.avail_in != 0) {
+            throw std::runtime_error("failed to deflate image data");
+        }
+
+        outputSize = output.size() - stream.avail_out;
+        inputSize = size;
+        checksum = adler32(adler32(0, nullptr, 0), data, static_cast<uInt>(size));
+    }
+
+    std::vector<uint8_t> output;
+    std::size_t outputSize = 0;
+    std::size_t inputSize = 0;
+    uLong checksum = 0;
+
+private:
+    z_stream stream{};
+};
+
 } // namespace
 
 namespace mbgl {
 
-// Encode PNGs without libpng.
-std::string encodePNG(const PremultipliedImage& pre) {
-    // Make copy of the image so that we can unpremultiply it.
-    const auto src = util::unpremultiply(pre.clone());
+// Encodes PNGs without libpng. The scanlines are split into groups deflated in parallel on the
+// background thread pool, as pigz does, and concatenated into a single zlib stream.
+class PNGEncoder final : public ImageEncoder {
+public:
+    explicit PNGEncoder(const ImageEncoderOptions& options_)
+        : options(options_) {}
+
+    std::string encode(const PremultipliedImageView& image) override;
+
+private:
+    const ImageEncoderOptions options;
+    util::SimpleIdentity uniqueID;
+    TaggedScheduler scheduler{Scheduler::GetBackground(), uniqueID};
+    // Unpremultiplied rows, each prefixed with its filter type
+    std::vector<uint8_t> scanlines;
+    std::vector<std::unique_ptr<DeflateGroup>> groups;
+    std::string idat;
+};
+
+std::string PNGEncoder::encode(const PremultipliedImageView& image) {
+    const std::size_t stride = image.size.width * PremultipliedImageView::channels;
+    const auto rowSize = stride + 1;
+    const auto height = image.size.height;
+
+    scanlines.resize(rowSize * height);
+    for (uint32_t y = 0; y < height; y++) {
+        const uint8_t* source = image.row(y);
+        uint8_t* row = scanlines.data() + y * rowSize;
+        *row++ = 0; // filter type 0
+        for (std::size_t x = 0; x < stride; x += 4) {
+            const uint8_t a = source[x + 3];
+            for (std::size_t c = 0; c < 3; c++) {
+                row[x + c] = a ? static_cast<uint8_t>((255 * source[x + c] + (a / 2)) / a) : source[x + c];
+            }
+            row[x + 3] = a;
+        }
+    }
+
+    const auto maxGroups = std::min<std::size_t>(scanlines.size() / minBytesPerThread, height);
+    const std::size_t groupCount = std::clamp<std::size_t>(maxGroups, 1, std::max<std::size_t>(options.threads, 1));
+    while (groups.size() < groupCount) {
+        groups.push_back(std::make_unique<DeflateGroup>(options.compressionLevel));
+    }
+
+    const std::size_t rowsPerGroup = (height + groupCount - 1) / groupCount;
+    // The calling thread compresses groups as well, helpers only take the groups it hasn't started yet
+    util::parallelFor(scheduler, groupCount, groupCount - 1, [&](std::size_t i) {
+        const auto begin = std::min<std::size_t>(i * rowsPerGroup, height) * rowSize;
+        const auto end = std::min<std::size_t>((i + 1) * rowsPerGroup, height) * rowSize;
+        const auto dictionary = begin - std::min(begin, windowSize);
+        groups[i]->compress(scanlines.data() + dictionary, scanlines.data() + begin, end - begin, i + 1 == groupCount);
+    });
+
+    // zlib header for a 32K window, with the level hint matching the compression level
+    const int level = options.compressionLevel < 0 ? Z_DEFAULT_COMPRESSION : options.compressionLevel;
+    const int levelHint = level == Z_DEFAULT_COMPRESSION ? 2 : level < 2 ? 0 : level < 6 ? 1 : level == 6 ? 2 : 3;
+    const int cmf = 0x78;
+    int flg = levelHint << 6;
+    flg += 31 - ((cmf << 8) + flg) % 31;
+
+    idat.clear();
+    idat.push_back(static_cast<char>(cmf));
+    idat.push_back(static_cast<char>(flg));
+    uLong checksum = adler32(0, nullptr, 0);
+    for (std::size_t i = 0; i < groupCount; i++) {
+        const auto& group = *groups[i];
+        idat.append(reinterpret_cast<const char*>(group.output.data()), group.outputSize);
+        checksum = adler32_combine(checksum, group.checksum, static_cast<z_off_t>(group.inputSize));
+    }
+    const char trailer[4] = {NETWORK_BYTE_UINT32(checksum)};
+    idat.append(trailer, 4);
 
     // PNG magic bytes
     const char preamble[8] = {char(0x89), 'P', 'N', 'G', '\r', '\n', 0x1a, '\n'};
 
     // IHDR chunk for our RGBA image.
     const char ihdr[13] = {
-        NETWORK_BYTE_UINT32(src.size.width),  // width
-        NETWORK_BYTE_UINT32(src.size.height), // height
-        8,                                    // bit depth == 8 bits
-        6,                                    // color type == RGBA
-        0,                                    // compression method == deflate
-        0,                                    // filter method == default
-        0,                                    // interlace method == none
+        NETWORK_BYTE_UINT32(image.size.width),  // width
+        NETWORK_BYTE_UINT32(image.size.height), // height
+        8,                                      // bit depth == 8 bits
+        6,                                      // color type == RGBA
+        0,                                      // compression method == deflate
+        0,                                      // filter method == default
+        0,                                      // interlace method == none
     };
 
-    // Prepare the (compressed) data chunk.
-    const auto stride = src.stride();
-    std::string idat;
-    for (uint32_t y = 0; y < src.size.height; y++) {
-        // Every scanline needs to be prefixed with one byte that indicates the filter type.
-        idat.append(1, 0); // filter type 0
-        idat.append(reinterpret_cast<const char*>(src.data.get() + y * stride), stride);
-    }
-    idat = util::compress(idat);
-
     // Assemble the PNG.
     std::string png;
     png.reserve((8 /* preamble */) + (12 + 13 /* IHDR */) + (12 + idat.size() /* IDAT */) + (12 /* IEND */));
@@ -72,4 +187,12 @@ std::string encodePNG(const PremultipliedImage& pre) {
     return png;
 }
 
+std::unique_ptr<ImageEncoder> createPNGEncoder(const ImageEncoderOptions& options) {
+    return std::make_unique<PNGEncoder>(options);
+}
+
+std::string encodePNG(const PremultipliedImage& pre) {
+    return PNGEncoder({}).encode(pre);
+}
+
 } // namespace mbgl
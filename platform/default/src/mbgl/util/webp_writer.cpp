@@ -0,0 +1,81 @@
+#include <mbgl/util/image.hpp>
+#include <mbgl/util/image_encoder.hpp>
+
+#include <webp/encode.h>
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+namespace mbgl {
+
+namespace {
+
+int writeToString(const uint8_t* data, size_t size, const WebPPicture* picture) {
+    static_cast<std::string*>(picture->custom_ptr)->append(reinterpret_cast<const char*>(data), size);
+    return 1;
+}
+
+} // namespace
+
+class WebPEncoder final : public ImageEncoder {
+public:
+    explicit WebPEncoder(const ImageEncoderOptions& options) {
+        if (!WebPConfigInit(&config)) {
+            throw std::runtime_error("WebP encoder version mismatch");
+        }
+        config.quality = static_cast<float>(std::clamp(options.quality, 0, 100));
+        config.lossless = options.quality >= 100 ? 1 : 0;
+        config.thread_level = options.threads > 1 ? 1 : 0;
+    }
+
+    std::string encode(const PremultipliedImageView& image) override {
+        // WebP stores unassociated alpha, reuse the buffer holding the unpremultiplied pixels
+        if (unpremultiplied.size != image.size) {
+            unpremultiplied = UnassociatedImage(image.size);
+        }
+        for (uint32_t y = 0; y < image.size.height; y++) {
+            const uint8_t* source = image.row(y);
+            uint8_t* target = unpremultiplied.data.get() + y * unpremultiplied.stride();
+            for (std::size_t i = 0; i < unpremultiplied.stride(); i += 4) {
+                const uint8_t a = source[i + 3];
+                for (std::size_t c = 0; c < 3; c++) {
+                    target[i + c] = a ? static_cast<uint8_t>((255 * source[i + c] + (a / 2)) / a) : source[i + c];
+                }
+                target[i + 3] = a;
+            }
+        }
+
+        WebPPicture picture;
+        if (!WebPPictureInit(&picture)) {
+            throw std::runtime_error("WebP encoder version mismatch");
+        }
+        picture.use_argb = config.lossless;
+        picture.width = static_cast<int>(image.size.width);
+        picture.height = static_cast<int>(image.size.height);
+
+        std::string result;
+        picture.writer = writeToString;
+        picture.custom_ptr = &result;
+
+        const bool imported = WebPPictureImportRGBA(
+            &picture, unpremultiplied.data.get(), static_cast<int>(unpremultiplied.stride()));
+        const bool encoded = imported && WebPEncode(&config, &picture);
+        const auto error = picture.error_code;
+        WebPPictureFree(&picture);
+        if (!encoded) {
+            throw std::runtime_error("failed to encode WebP image, error " + std::to_string(error));
+        }
+        return result;
+    }
+
+private:
+    WebPConfig config;
+    UnassociatedImage unpremultiplied;
+};
+
+std::unique_ptr<ImageEncoder> createWebPEncoder(const ImageEncoderOptions& options) {
+    return std::make_unique<WebPEncoder>(options);
+}
+
+} // namespace mbgl
@@ -2,9 +2,15 @@
 #include <mbgl/vulkan/renderable_resource.hpp>
 #include <mbgl/vulkan/context.hpp>
 #include <mbgl/vulkan/texture2d.hpp>
+#include <mbgl/vulkan/buffer_resource.hpp>
 #include <mbgl/gfx/backend_scope.hpp>
+#include <mbgl/util/logging.hpp>
 
+#include <algorithm>
 #include <cassert>
+#include <cstring>
+#include <iterator>
+#include <limits>
 #include <stdexcept>
 #include <type_traits>
 
@@ -31,6 +37,14 @@ public:
     }
 };
 
+struct HeadlessBackend::Readback {
+    Size size;
+    UniqueBufferAllocation buffer;
+    vk::UniqueCommandBuffer commandBuffer;
+    vk::UniqueFence fence;
+    std::function<void(PremultipliedImage)> callback;
+};
+
 HeadlessBackend::HeadlessBackend(const Size size_,
                                  gfx::HeadlessBackend::SwapBehaviour,
                                  const gfx::ContextMode contextMode_)
@@ -42,6 +56,7 @@ HeadlessBackend::HeadlessBackend(const Size size_,
 HeadlessBackend::~HeadlessBackend() {
     gfx::BackendScope guard{*this, gfx::BackendScope::ScopeType::Implicit};
 
+    processReadbacks(/*wait=*/true);
     texture.reset();
 
     // Explicitly reset the renderable resource
@@ -96,6 +111,132 @@ PremultipliedImage HeadlessBackend::readStillImage() {
     return std::move(*texture->readImage());
 }
 
+void HeadlessBackend::readStillImageAsync(std::function<void(PremultipliedImage)> callback) {
+    if (!resource) {
+        resource = std::make_unique<HeadlessRenderableResource>(*this);
+    }
+
+    const auto& image = static_cast<HeadlessRenderableResource&>(*resource).getAcquiredImage();
+    if (!image) {
+        callback(readStillImage());
+        return;
+    }
+
+    const auto& device = getDevice();
+    std::unique_ptr<Readback> readback;
+    // Reuse the resources of a completed read of the same size
+    const auto it = std::ranges::find_if(freeReadbacks, [&](const auto& free) { return free->size == size; });
+    if (it != freeReadbacks.end()) {
+        readback = std::move(*it);
+        freeReadbacks.erase(it);
+        device->resetFences(readback->fence.get(), getDispatcher());
+        readback->commandBuffer->reset({}, getDispatcher());
+    } else {
+        const auto bufferInfo = vk::BufferCreateInfo()
+                                    .setSize(static_cast<vk::DeviceSize>(size.area()) * 4)
+                                    .setUsage(vk::BufferUsageFlagBits::eTransferDst)
+                                    .setSharingMode(vk::SharingMode::eExclusive);
+
+        VmaAllocationCreateInfo allocationInfo = {};
+        allocationInfo.usage = VMA_MEMORY_USAGE_AUTO_PREFER_HOST;
+        allocationInfo.requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+        allocationInfo.flags = VMA_ALLOCATION_CREATE_HOST_ACCESS_RANDOM_BIT;
+
+        auto buffer = std::make_unique<BufferAllocation>(getAllocator());
+        if (!buffer->create(allocationInfo, bufferInfo)) {
+            Log::Error(Event::Render, "Vulkan readback staging buffer allocation failed");
+            callback(readStillImage());
+            return;
+        }
+
+        const vk::CommandBufferAllocateInfo allocateInfo(getCommandPool().get(), vk::CommandBufferLevel::ePrimary, 1);
+        auto commandBuffers = device->allocateCommandBuffersUnique(allocateInfo, getDispatcher());
+
+        readback = std::make_unique<Readback>(
+            Readback{.size = size,
+                     .buffer = std::move(buffer),
+                     .commandBuffer = std::move(commandBuffers.front()),
+                     .fence = device->createFenceUnique(vk::FenceCreateInfo(), nullptr, getDispatcher()),
+                     .callback = {}});
+    }
+
+    // Copy straight from the rendered image, without waiting for the copy to complete
+    const auto& commandBuffer = readback->commandBuffer;
+    commandBuffer->begin(vk::CommandBufferBeginInfo(vk::CommandBufferUsageFlagBits::eOneTimeSubmit), getDispatcher());
+
+    const vk::MemoryBarrier renderBarrier(vk::AccessFlagBits::eColorAttachmentWrite, vk::AccessFlagBits::eTransferRead);
+    commandBuffer->pipelineBarrier(vk::PipelineStageFlagBits::eColorAttachmentOutput,
+                                   vk::PipelineStageFlagBits::eTransfer,
+                                   {},
+                                   renderBarrier,
+                                   nullptr,
+                                   nullptr,
+                                   getDispatcher());
+
+    const auto region = vk::BufferImageCopy()
+                            .setImageSubresource(vk::ImageSubresourceLayers(vk::ImageAspectFlagBits::eColor, 0, 0, 1))
+                            .setImageExtent({size.width, size.height, 1});
+    commandBuffer->copyImageToBuffer(
+        image, vk::ImageLayout::eTransferSrcOptimal, readback->buffer->buffer, region, getDispatcher());
+
+    const vk::MemoryBarrier hostBarrier(vk::AccessFlagBits::eTransferWrite, vk::AccessFlagBits::eHostRead);
+    commandBuffer->pipelineBarrier(vk::PipelineStageFlagBits::eTransfer,
+                                   vk::PipelineStageFlagBits::eHost,
+                                   {},
+                                   hostBarrier,
+                                   nullptr,
+                                   nullptr,
+                                   getDispatcher());
+
+    commandBuffer->end(getDispatcher());
+
+    getGraphicsQueue().submit(
+        vk::SubmitInfo().setCommandBuffers(commandBuffer.get()), readback->fence.get(), getDispatcher());
+
+    readback->callback = std::move(callback);
+    readbacks.push_back(std::move(readback));
+}
+
+void HeadlessBackend::processReadbacks(bool wait) {
+    const auto& device = getDevice();
+    const auto end = std::ranges::find_if(readbacks, [&](const auto& readback) {
+        if (wait) {
+            constexpr uint64_t timeout = std::numeric_limits<uint64_t>::max();
+            return device->waitForFences(1, &readback->fence.get(), VK_TRUE, timeout, getDispatcher()) !=
+                   vk::Result::eSuccess;
+        }
+        return device->getFenceStatus(readback->fence.get(), getDispatcher()) != vk::Result::eSuccess;
+    });
+
+    // Callbacks may start new reads, take the completed ones out first
+    std::vector<std::unique_ptr<Readback>> completed{std::make_move_iterator(readbacks.begin()),
+                                                     std::make_move_iterator(end)};
+    readbacks.erase(readbacks.begin(), end);
+
+    for (auto& readback : completed) {
+        PremultipliedImage image{readback->size};
+        void* mapped = nullptr;
+        if (vmaMapMemory(getAllocator(), readback->buffer->allocation, &mapped) == VK_SUCCESS) {
+            std::memcpy(image.data.get(), mapped, image.bytes());
+            vmaUnmapMemory(getAllocator(), readback->buffer->allocation);
+        }
+        auto callback = std::move(readback->callback);
+
+        // Keep the resources for the next reads, which have the same size until the backend is resized
+        std::erase_if(freeReadbacks, [&](const auto& free) { return free->size != readback->size; });
+        if (freeReadbacks.size() < getMaxFrames()) {
+            freeReadbacks.push_back(std::move(readback));
+        }
+
+        callback(std::move(image));
+    }
+}
+
+void HeadlessBackend::onBeginFrame() {
+    // Hand over the images of previous frames the GPU is done with
+    processReadbacks(/*wait=*/false);
+}
+
 RendererBackend* HeadlessBackend::getRendererBackend() {
     return this;
 }
@@ -1,8 +1,13 @@
 #include <mbgl/util/image.hpp>
+#include <mbgl/util/image_encoder.hpp>
 
 #include <QBuffer>
 #include <QByteArray>
 #include <QImage>
+#include <QImageWriter>
+
+#include <algorithm>
+#include <stdexcept>
 
 namespace mbgl {
 
@@ -18,6 +23,57 @@ std::string encodePNG(const PremultipliedImage& pre) {
     return std::string(array.constData(), array.size());
 }
 
+namespace {
+
+// Encodes through the image format plugins Qt was built with
+class QtImageEncoder final : public ImageEncoder {
+public:
+    QtImageEncoder(const char* format_, int quality_)
+        : format(format_),
+          quality(quality_) {}
+
+    std::string encode(const PremultipliedImageView& pre) override {
+        QImage image(pre.data,
+                     pre.size.width,
+                     pre.size.height,
+                     static_cast<int>(pre.stride),
+                     QImage::Format_ARGB32_Premultiplied);
+
+        array.clear();
+        QBuffer buffer(&array);
+        buffer.open(QIODevice::WriteOnly);
+        if (!image.rgbSwapped().save(&buffer, format, quality)) {
+            throw std::runtime_error(std::string("failed to encode ") + format + " image");
+        }
+
+        return std::string(array.constData(), array.size());
+    }
+
+private:
+    const char* const format;
+    const int quality;
+    QByteArray array;
+};
+
+} // namespace
+
+std::unique_ptr<ImageEncoder> ImageEncoder::create(const ImageEncoderOptions& options) {
+    switch (options.encoding) {
+        case ImageEncoding::PNG:
+            // Qt maps its quality from 0 to 100 to zlib levels in reverse
+            return std::make_unique<QtImageEncoder>(
+                "PNG", options.compressionLevel < 0 ? -1 : (9 - std::min(options.compressionLevel, 9)) * 100 / 9);
+        case ImageEncoding::WebP:
+            if (!QImageWriter::supportedImageFormats().contains("webp")) {
+                return nullptr;
+            }
+            return std::make_unique<QtImageEncoder>("WEBP", options.quality);
+        case ImageEncoding::JPEG:
+            return std::make_unique<QtImageEncoder>("JPG", options.quality);
+    }
+    return nullptr;
+}
+
 #if !defined(QT_IMAGE_DECODERS)
 PremultipliedImage decodeJPEG(const uint8_t*, size_t);
 #endif
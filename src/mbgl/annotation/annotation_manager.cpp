@@ -11,9 +11,14 @@
 #include <mbgl/style/layers/symbol_layer_impl.hpp>
 #include <mbgl/style/style.hpp>
 #include <mbgl/style/style_impl.hpp>
+#include <mbgl/util/constants.hpp>
+#include <mbgl/util/tile_coordinate.hpp>
 
 #include <boost/iterator/function_output_iterator.hpp>
 
+#include <algorithm>
+#include <cmath>
+
 // Note: LayerManager::annotationsEnabled is defined
 // at compile time, so that linker (with LTO on) is able
 // to optimize out the unreachable code.
@@ -53,7 +58,7 @@ void AnnotationManager::onStyleLoaded() {
 
 AnnotationID AnnotationManager::addAnnotation(const Annotation& annotation) {
     CHECK_ANNOTATIONS_ENABLED_AND_RETURN(nextID++);
-    std::scoped_lock lock(mutex);
+    std::unique_lock lock(mutex);
     AnnotationID id = nextID++;
     Annotation::visit(annotation, [&](const auto& annotation_) { this->add(id, annotation_); });
     dirty = true;
@@ -62,34 +67,69 @@ AnnotationID AnnotationManager::addAnnotation(const Annotation& annotation) {
 
 bool AnnotationManager::updateAnnotation(const AnnotationID& id, const Annotation& annotation) {
     CHECK_ANNOTATIONS_ENABLED_AND_RETURN(true);
-    std::scoped_lock lock(mutex);
+    std::unique_lock lock(mutex);
     Annotation::visit(annotation, [&](const auto& annotation_) { this->update(id, annotation_); });
     return dirty;
 }
 
 void AnnotationManager::removeAnnotation(const AnnotationID& id) {
     CHECK_ANNOTATIONS_ENABLED_AND_RETURN_NOARG();
-    std::scoped_lock lock(mutex);
+    std::unique_lock lock(mutex);
     remove(id);
     dirty = true;
 }
 
+AnnotationIDs AnnotationManager::addAnnotations(const std::vector<Annotation>& annotations) {
+    AnnotationIDs ids;
+    ids.reserve(annotations.size());
+    CHECK_ANNOTATIONS_ENABLED_AND_RETURN(ids);
+    std::unique_lock lock(mutex);
+    for (const auto& annotation : annotations) {
+        AnnotationID id = nextID++;
+        Annotation::visit(annotation, [&](const auto& annotation_) { this->add(id, annotation_); });
+        ids.push_back(id);
+    }
+    dirty = dirty || !annotations.empty();
+    return ids;
+}
+
+bool AnnotationManager::updateAnnotations(const std::vector<std::pair<AnnotationID, Annotation>>& annotations) {
+    CHECK_ANNOTATIONS_ENABLED_AND_RETURN(true);
+    std::unique_lock lock(mutex);
+    for (const auto& [id, annotation] : annotations) {
+        Annotation::visit(annotation, [&, &id = id](const auto& annotation_) { this->update(id, annotation_); });
+    }
+    return dirty;
+}
+
+void AnnotationManager::removeAnnotations(const AnnotationIDs& ids) {
+    CHECK_ANNOTATIONS_ENABLED_AND_RETURN_NOARG();
+    std::unique_lock lock(mutex);
+    for (const auto& id : ids) {
+        remove(id);
+    }
+    dirty = dirty || !ids.empty();
+}
+
 void AnnotationManager::add(const AnnotationID& id, const SymbolAnnotation& annotation) {
     auto impl = std::make_shared<SymbolAnnotationImpl>(id, annotation);
     symbolTree.insert(impl);
     symbolAnnotations.emplace(id, impl);
+    invalidate(annotation.geometry);
 }
 
 void AnnotationManager::add(const AnnotationID& id, const LineAnnotation& annotation) {
     ShapeAnnotationImpl& impl =
         *shapeAnnotations.emplace(id, std::make_unique<LineAnnotationImpl>(id, annotation)).first->second;
     impl.updateStyle(*style.get().impl);
+    invalidateAll();
 }
 
 void AnnotationManager::add(const AnnotationID& id, const FillAnnotation& annotation) {
     ShapeAnnotationImpl& impl =
         *shapeAnnotations.emplace(id, std::make_unique<FillAnnotationImpl>(id, annotation)).first->second;
     impl.updateStyle(*style.get().impl);
+    invalidateAll();
 }
 
 void AnnotationManager::update(const AnnotationID& id, const SymbolAnnotation& annotation) {
@@ -99,13 +139,21 @@ void AnnotationManager::update(const AnnotationID& id, const SymbolAnnotation& a
         return;
     }
 
-    const SymbolAnnotation& existing = it->second->annotation;
+    SymbolAnnotationImpl& impl = *it->second;
 
-    if (existing.geometry != annotation.geometry || existing.icon != annotation.icon) {
+    if (impl.annotation.geometry != annotation.geometry) {
+        // The tree indexes symbols by position, so a moved symbol is taken out
+        // and put back. Its impl and map entry are reused as they are.
         dirty = true;
-
-        remove(id);
-        add(id, annotation);
+        invalidate(impl.annotation.geometry);
+        symbolTree.remove(it->second);
+        impl.annotation = annotation;
+        symbolTree.insert(it->second);
+        invalidate(impl.annotation.geometry);
+    } else if (impl.annotation.icon != annotation.icon) {
+        dirty = true;
+        impl.annotation.icon = annotation.icon;
+        invalidate(impl.annotation.geometry);
     }
 }
 
@@ -135,18 +183,31 @@ void AnnotationManager::update(const AnnotationID& id, const FillAnnotation& ann
 
 void AnnotationManager::remove(const AnnotationID& id) {
     CHECK_ANNOTATIONS_ENABLED_AND_RETURN_NOARG();
-    if (symbolAnnotations.contains(id)) {
-        symbolTree.remove(symbolAnnotations.at(id));
-        symbolAnnotations.erase(id);
-    } else if (shapeAnnotations.contains(id)) {
-        auto it = shapeAnnotations.find(id);
-        (void)*style.get().impl->removeLayer(it->second->layerID);
-        shapeAnnotations.erase(it);
+    if (auto symbol = symbolAnnotations.find(id); symbol != symbolAnnotations.end()) {
+        invalidate(symbol->second->annotation.geometry);
+        symbolTree.remove(symbol->second);
+        symbolAnnotations.erase(symbol);
+    } else if (auto shape = shapeAnnotations.find(id); shape != shapeAnnotations.end()) {
+        (void)*style.get().impl->removeLayer(shape->second->layerID);
+        shapeAnnotations.erase(shape);
+        invalidateAll();
     } else {
         assert(false); // Should never happen
     }
 }
 
+void AnnotationManager::invalidate(const Point<double>& position) {
+    if (!allTilesDirty) {
+        dirtyPositions.emplace_back(
+            std::clamp(position.y, -util::LATITUDE_MAX, util::LATITUDE_MAX), position.x, LatLng::Wrapped);
+    }
+}
+
+void AnnotationManager::invalidateAll() {
+    allTilesDirty = true;
+    dirtyPositions.clear();
+}
+
 std::unique_ptr<AnnotationTileData> AnnotationManager::getTileData(const CanonicalTileID& tileID) {
     if (symbolAnnotations.empty() && shapeAnnotations.empty()) return nullptr;
 
@@ -192,7 +253,7 @@ void AnnotationManager::updateStyle() {
         style.get().impl->addLayer(std::move(layer));
     }
 
-    std::scoped_lock lock(mutex);
+    std::unique_lock lock(mutex);
 
     for (const auto& shape : shapeAnnotations) {
         shape.second->updateStyle(*style.get().impl);
@@ -210,27 +271,100 @@ void AnnotationManager::updateStyle() {
     }
 }
 
+namespace {
+
+// Tiles at zoom level `z` whose bounds, extended as in getTileData(), contain `position`.
+template <class Fn>
+void forEachTileContaining(const LatLng& position, uint8_t z, Fn&& fn) {
+    constexpr double epsilon = 0.000000001;
+    const auto clampLatitude = [](double lat) {
+        return std::clamp(lat, -util::LATITUDE_MAX, util::LATITUDE_MAX);
+    };
+    // Tile bounds don't wrap either, wrapping would move a position at the antimeridian to the other edge.
+    const auto clampLongitude = [](double lon) {
+        return std::clamp(lon, -util::LONGITUDE_MAX, util::LONGITUDE_MAX);
+    };
+    const auto southwest = TileCoordinate::fromLatLng(
+        z, LatLng(clampLatitude(position.latitude() - epsilon), clampLongitude(position.longitude() - epsilon)));
+    const auto northeast = TileCoordinate::fromLatLng(
+        z, LatLng(clampLatitude(position.latitude() + epsilon), clampLongitude(position.longitude() + epsilon)));
+
+    const double maxIndex = std::pow(2.0, z) - 1;
+    const auto index = [&](double coordinate) {
+        return static_cast<uint32_t>(std::clamp(std::floor(coordinate), 0.0, maxIndex));
+    };
+    for (uint32_t x = index(southwest.p.x); x <= index(northeast.p.x); ++x) {
+        for (uint32_t y = index(northeast.p.y); y <= index(southwest.p.y); ++y) {
+            fn(CanonicalTileID(z, x, y));
+        }
+    }
+}
+
+} // namespace
+
 void AnnotationManager::updateData() {
     CHECK_ANNOTATIONS_ENABLED_AND_RETURN_NOARG();
-    std::scoped_lock lock(mutex);
-    if (dirty) {
-        for (auto& tile : tiles) {
-            tile->setData(getTileData(tile->id.canonical));
+    bool allTiles = false;
+    std::vector<LatLng> positions;
+    {
+        std::unique_lock lock(mutex);
+        if (!dirty) {
+            return;
         }
+        allTiles = allTilesDirty;
+        positions.swap(dirtyPositions);
         dirty = false;
+        allTilesDirty = false;
+    }
+
+    std::scoped_lock tilesLock(tilesMutex);
+
+    std::vector<AnnotationTile*> staleTiles;
+    if (allTiles) {
+        staleTiles.assign(tiles.begin(), tiles.end());
+    } else {
+        std::unordered_set<uint8_t> zooms;
+        for (const auto* tile : tiles) {
+            zooms.insert(tile->id.canonical.z);
+        }
+
+        std::unordered_set<CanonicalTileID> dirtyTiles;
+        for (const auto& position : positions) {
+            for (const uint8_t z : zooms) {
+                forEachTileContaining(position, z, [&](const CanonicalTileID& tileID) { dirtyTiles.insert(tileID); });
+            }
+        }
+
+        for (auto* tile : tiles) {
+            if (dirtyTiles.contains(tile->id.canonical)) {
+                staleTiles.push_back(tile);
+            }
+        }
+    }
+
+    // The lock is taken per tile, so that a long update doesn't hold off
+    // annotation changes made in the meantime.
+    for (auto* tile : staleTiles) {
+        std::unique_ptr<AnnotationTileData> data;
+        {
+            std::unique_lock lock(mutex);
+            data = getTileData(tile->id.canonical);
+        }
+        tile->setData(std::move(data));
     }
 }
 
 void AnnotationManager::addTile(AnnotationTile& tile) {
     CHECK_ANNOTATIONS_ENABLED_AND_RETURN_NOARG();
-    std::scoped_lock lock(mutex);
+    std::scoped_lock tilesLock(tilesMutex);
     tiles.insert(&tile);
+    std::unique_lock lock(mutex);
     tile.setData(getTileData(tile.id.canonical));
 }
 
 void AnnotationManager::removeTile(AnnotationTile& tile) {
     CHECK_ANNOTATIONS_ENABLED_AND_RETURN_NOARG();
-    std::scoped_lock lock(mutex);
+    std::scoped_lock tilesLock(tilesMutex);
     tiles.erase(&tile);
 }
 
@@ -246,7 +380,7 @@ std::string prefixedImageID(const std::string& id) {
 
 void AnnotationManager::addImage(std::unique_ptr<style::Image> image) {
     CHECK_ANNOTATIONS_ENABLED_AND_RETURN_NOARG();
-    std::scoped_lock lock(mutex);
+    std::unique_lock lock(mutex);
     const std::string id = prefixedImageID(image->getID());
     images.erase(id);
     auto inserted = images.emplace(id,
@@ -256,7 +390,7 @@ void AnnotationManager::addImage(std::unique_ptr<style::Image> image) {
 
 void AnnotationManager::removeImage(const std::string& id_) {
     CHECK_ANNOTATIONS_ENABLED_AND_RETURN_NOARG();
-    std::scoped_lock lock(mutex);
+    std::unique_lock lock(mutex);
     const std::string id = prefixedImageID(id_);
     images.erase(id);
     style.get().impl->removeImage(id);
@@ -264,7 +398,7 @@ void AnnotationManager::removeImage(const std::string& id_) {
 
 double AnnotationManager::getTopOffsetPixelsForImage(const std::string& id_) {
     CHECK_ANNOTATIONS_ENABLED_AND_RETURN(0.0);
-    std::scoped_lock lock(mutex);
+    std::shared_lock lock(mutex);
     const std::string id = prefixedImageID(id_);
     auto it = images.find(id);
     return it != images.end() ? -(it->second.getImage().size.height / it->second.getPixelRatio()) / 2 : 0.0;
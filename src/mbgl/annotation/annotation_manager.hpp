@@ -8,9 +8,12 @@
 #include <mapbox/std/weak.hpp>
 
 #include <mutex>
+#include <shared_mutex>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
+#include <vector>
 
 namespace mbgl {
 
@@ -34,6 +37,11 @@ public:
     bool updateAnnotation(const AnnotationID&, const Annotation&);
     void removeAnnotation(const AnnotationID&);
 
+    // Batched variants of the above, which take the lock only once.
+    AnnotationIDs addAnnotations(const std::vector<Annotation>&);
+    bool updateAnnotations(const std::vector<std::pair<AnnotationID, Annotation>>&);
+    void removeAnnotations(const AnnotationIDs&);
+
     void addImage(std::unique_ptr<style::Image>);
     void removeImage(const std::string&);
     double getTopOffsetPixelsForImage(const std::string&);
@@ -63,24 +71,38 @@ private:
 
     void remove(const AnnotationID&);
 
+    // Marks the tiles containing a symbol at the given position as needing
+    // new data, or all tiles for changes to shapes.
+    void invalidate(const Point<double>&);
+    void invalidateAll();
+
     void updateStyle();
 
+    // Requires `mutex` to be held exclusively
     std::unique_ptr<AnnotationTileData> getTileData(const CanonicalTileID&);
 
     std::reference_wrapper<style::Style> style;
 
-    std::mutex mutex;
+    // Guards the annotations, images and dirty state. Generating tile data
+    // takes it exclusively, as shape annotations build and cache their
+    // geojson-vt tiles lazily.
+    std::shared_mutex mutex;
+    // Guards `tiles`. When both are taken, this one is taken first.
+    std::mutex tilesMutex;
 
     bool dirty = false;
+    bool allTilesDirty = false;
+    std::vector<LatLng> dirtyPositions;
 
     AnnotationID nextID = 0;
 
     using SymbolAnnotationTree = boost::geometry::index::rtree<std::shared_ptr<const SymbolAnnotationImpl>,
                                                                boost::geometry::index::rstar<16, 4>>;
+    // Symbols are only ever looked up by ID; tile data is generated from the tree.
+    using SymbolAnnotationMap = std::unordered_map<AnnotationID, std::shared_ptr<SymbolAnnotationImpl>>;
     // Unlike std::unordered_map, std::map is guaranteed to sort by
     // AnnotationID, ensuring that older annotations are below newer
     // annotations. <https://github.com/mapbox/mapbox-gl-native/issues/5691>
-    using SymbolAnnotationMap = std::map<AnnotationID, std::shared_ptr<SymbolAnnotationImpl>>;
     using ShapeAnnotationMap = std::map<AnnotationID, std::unique_ptr<ShapeAnnotationImpl>>;
     using ImageMap = std::unordered_map<std::string, style::Image>;
 
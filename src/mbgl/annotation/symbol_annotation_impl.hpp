@@ -24,7 +24,9 @@ public:
     void updateLayer(const CanonicalTileID&, AnnotationTileLayer&) const;
 
     const AnnotationID id;
-    const SymbolAnnotation annotation;
+    // Only changed by AnnotationManager under its exclusive lock. The position
+    // is only changed while the annotation is out of the tree, which indexes it.
+    SymbolAnnotation annotation;
 };
 
 } // namespace mbgl
@@ -125,6 +125,42 @@ void FeatureIndex::insert(const GeometryCollection& geometries,
                           std::size_t index,
                           const std::string& sourceLayerName,
                           const std::string& bucketLeaderID) {
+    const auto& [emplacedLayerName, emplacedLeaderID] = emplaceNames(sourceLayerName, bucketLeaderID);
+
+    auto featureSortIndex = sortIndex++;
+    for (const auto& ring : geometries) {
+        insertEnvelope(envelope(ring),
+                       RefIndexedSubfeature(index, emplacedLayerName, emplacedLeaderID, featureSortIndex));
+    }
+}
+
+void FeatureIndex::insert(std::span<const RingEnvelope> envelopes,
+                          std::size_t index,
+                          const std::string& sourceLayerName,
+                          const std::string& bucketLeaderID) {
+    const auto& [emplacedLayerName, emplacedLeaderID] = emplaceNames(sourceLayerName, bucketLeaderID);
+
+    auto featureSortIndex = sortIndex++;
+    for (const auto& ringEnvelope : envelopes) {
+        insertEnvelope(ringEnvelope,
+                       RefIndexedSubfeature(index, emplacedLayerName, emplacedLeaderID, featureSortIndex));
+    }
+}
+
+FeatureIndex::RingEnvelope FeatureIndex::envelope(GeometryCoordinatesView ring) {
+    RingEnvelope result{{std::numeric_limits<int16_t>::max(), std::numeric_limits<int16_t>::max()},
+                        {std::numeric_limits<int16_t>::lowest(), std::numeric_limits<int16_t>::lowest()}};
+    for (const auto& point : ring) {
+        result.min.x = std::min(result.min.x, point.x);
+        result.min.y = std::min(result.min.y, point.y);
+        result.max.x = std::max(result.max.x, point.x);
+        result.max.y = std::max(result.max.y, point.y);
+    }
+    return result;
+}
+
+std::pair<const std::string&, const std::string&> FeatureIndex::emplaceNames(const std::string& sourceLayerName,
+                                                                             const std::string& bucketLeaderID) {
     if (uniqueLayerIDs.empty()) {
         uniqueLayerIDs.reserve(expectedUniqueLayerIDs);
     }
@@ -134,15 +170,14 @@ void FeatureIndex::insert(const GeometryCollection& geometries,
     }
     const std::string& emplacedLeaderID =
         bucketLayerIDs.insert(std::make_pair(bucketLeaderID, std::vector<std::string>{})).first->first;
+    return {emplacedLayerName, emplacedLeaderID};
+}
 
-    auto featureSortIndex = sortIndex++;
-    for (const auto& ring : geometries) {
-        const auto envelope = mapbox::geometry::envelope(ring);
-        if (envelope.min.x < util::EXTENT && envelope.min.y < util::EXTENT && envelope.max.x >= 0 &&
-            envelope.max.y >= 0) {
-            grid.insert(RefIndexedSubfeature(index, emplacedLayerName, emplacedLeaderID, featureSortIndex),
-                        {convertPoint<float>(envelope.min), convertPoint<float>(envelope.max)});
-        }
+void FeatureIndex::insertEnvelope(const RingEnvelope& ringEnvelope, RefIndexedSubfeature subfeature) {
+    if (ringEnvelope.min.x < util::EXTENT && ringEnvelope.min.y < util::EXTENT && ringEnvelope.max.x >= 0 &&
+        ringEnvelope.max.y >= 0) {
+        grid.insert(std::move(subfeature),
+                    {convertPoint<float>(ringEnvelope.min), convertPoint<float>(ringEnvelope.max)});
     }
 }
 
@@ -8,6 +8,7 @@
 #include <mbgl/util/grid_index.hpp>
 #include <mbgl/util/mat4.hpp>
 
+#include <span>
 #include <vector>
 #include <string>
 #include <unordered_map>
@@ -118,6 +119,14 @@ public:
                 const std::string& sourceLayerName,
                 const std::string& bucketLeaderID);
 
+    /// Same as above, for callers that computed the envelopes of the rings up front.
+    using RingEnvelope = mapbox::geometry::box<int16_t>;
+    static RingEnvelope envelope(GeometryCoordinatesView ring);
+    void insert(std::span<const RingEnvelope>,
+                std::size_t index,
+                const std::string& sourceLayerName,
+                const std::string& bucketLeaderID);
+
     void query(std::unordered_map<std::string, std::vector<Feature>>& result,
                const GeometryCoordinates& queryGeometry,
                const TransformState&,
@@ -146,6 +155,10 @@ public:
         const FeatureSortOrder& featureSortOrder) const;
 
 private:
+    std::pair<const std::string&, const std::string&> emplaceNames(const std::string& sourceLayerName,
+                                                                   const std::string& bucketLeaderID);
+    void insertEnvelope(const RingEnvelope&, RefIndexedSubfeature);
+
     void addFeature(std::unordered_map<std::string, std::vector<Feature>>& result,
                     const RefIndexedSubfeature&,
                     const RenderedQueryOptions& options,
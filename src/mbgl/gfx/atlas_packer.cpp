@@ -0,0 +1,263 @@
+#include <mbgl/gfx/atlas_packer.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <limits>
+
+namespace mbgl {
+namespace gfx {
+
+namespace {
+
+// Rectangles go into shelves up to half as high again, beyond that they open a shelf of their own
+bool acceptableWaste(uint16_t shelfHeight, uint16_t height) {
+    return shelfHeight - height <= height / 2;
+}
+
+std::size_t area(const Rect<uint16_t>& rect) {
+    return static_cast<std::size_t>(rect.w) * rect.h;
+}
+
+} // namespace
+
+AtlasPacker::AtlasPacker(Size size_)
+    : size(size_) {
+    assert(size.width <= std::numeric_limits<uint16_t>::max() && size.height <= std::numeric_limits<uint16_t>::max());
+}
+
+const AtlasPacker::Bin* AtlasPacker::pack(int32_t id, Size binSize) {
+    if (const auto it = bins.find(id); it != bins.end()) {
+        it->second.refcount++;
+        return &it->second;
+    }
+    if (binSize.isEmpty() || binSize.width > size.width || binSize.height > size.height) {
+        return nullptr;
+    }
+    const auto height = static_cast<uint16_t>(binSize.height);
+
+    // The shelf wasting the least height with room for the rectangle
+    const auto bestShelf = [&](bool anyWaste) -> Shelf* {
+        Shelf* best = nullptr;
+        for (auto& shelf : shelves) {
+            if (shelf.binCount == 0 || shelf.h < height || (!anyWaste && !acceptableWaste(shelf.h, height)) ||
+                (best && shelf.h >= best->h)) {
+                continue;
+            }
+            if (std::ranges::any_of(shelf.freeSpans, [&](const auto& span) { return span.second >= binSize.width; })) {
+                best = &shelf;
+            }
+        }
+        return best;
+    };
+
+    std::optional<Rect<uint16_t>> rect;
+    if (auto* shelf = bestShelf(false)) {
+        rect = packInShelf(*shelf, binSize);
+    } else if (const auto index = openShelf(height)) {
+        rect = packInShelf(shelves[*index], binSize);
+    } else if (auto* fallback = bestShelf(true)) {
+        // Out of space for new shelves, accept a higher one
+        rect = packInShelf(*fallback, binSize);
+    }
+    if (!rect) {
+        return nullptr;
+    }
+
+    usedArea += area(*rect);
+    auto& bin = bins[id];
+    bin = {.id = id, .rect = *rect, .refcount = 1};
+    return &bin;
+}
+
+const AtlasPacker::Bin* AtlasPacker::getBin(int32_t id) const {
+    const auto it = bins.find(id);
+    return it != bins.end() ? &it->second : nullptr;
+}
+
+uint32_t AtlasPacker::unref(int32_t id) {
+    const auto it = bins.find(id);
+    if (it == bins.end()) {
+        return 0;
+    }
+    if (--it->second.refcount > 0) {
+        return it->second.refcount;
+    }
+    release(it->second.rect);
+    bins.erase(it);
+    return 0;
+}
+
+double AtlasPacker::getOccupancy() const {
+    const auto total = static_cast<double>(size.area());
+    return total > 0 ? static_cast<double>(usedArea) / total : 0.0;
+}
+
+std::optional<Rect<uint16_t>> AtlasPacker::packInShelf(Shelf& shelf, Size binSize) {
+    const auto span = std::ranges::find_if(shelf.freeSpans,
+                                           [&](const auto& entry) { return entry.second >= binSize.width; });
+    if (span == shelf.freeSpans.end()) {
+        return std::nullopt;
+    }
+
+    const auto [x, width] = *span;
+    const auto binWidth = static_cast<uint16_t>(binSize.width);
+    shelf.freeSpans.erase(span);
+    if (width > binWidth) {
+        shelf.freeSpans.emplace(static_cast<uint16_t>(x + binWidth), static_cast<uint16_t>(width - binWidth));
+    }
+    shelf.binCount++;
+    return Rect<uint16_t>(x, shelf.y, binWidth, static_cast<uint16_t>(binSize.height));
+}
+
+std::optional<std::size_t> AtlasPacker::openShelf(uint16_t height) {
+    const auto width = static_cast<uint16_t>(size.width);
+
+    // Prefer the space of empty shelves, splitting off the part that isn't needed
+    std::optional<std::size_t> best;
+    for (std::size_t i = 0; i < shelves.size(); i++) {
+        if (shelves[i].binCount == 0 && shelves[i].h >= height && (!best || shelves[i].h < shelves[*best].h)) {
+            best = i;
+        }
+    }
+    if (best) {
+        auto& shelf = shelves[*best];
+        if (shelf.h > height) {
+            Shelf rest{.y = static_cast<uint16_t>(shelf.y + height),
+                       .h = static_cast<uint16_t>(shelf.h - height),
+                       .freeSpans = {{0, width}}};
+            shelf.h = height;
+            shelves.insert(shelves.begin() + static_cast<std::ptrdiff_t>(*best) + 1, std::move(rest));
+        }
+        return best;
+    }
+
+    const uint16_t top = shelves.empty() ? 0 : shelves.back().y + shelves.back().h;
+    if (size.height - top < height) {
+        return std::nullopt;
+    }
+    shelves.push_back({.y = top, .h = height, .freeSpans = {{0, width}}});
+    return shelves.size() - 1;
+}
+
+void AtlasPacker::release(const Rect<uint16_t>& rect) {
+    assert(usedArea >= area(rect));
+    usedArea -= area(rect);
+
+    auto shelf = std::ranges::upper_bound(shelves, rect.y, {}, &Shelf::y);
+    assert(shelf != shelves.begin());
+    --shelf;
+    assert(shelf->binCount > 0);
+    shelf->binCount--;
+
+    // Merge the span with the free ones on either side
+    auto x = rect.x;
+    auto width = rect.w;
+    auto next = shelf->freeSpans.lower_bound(x);
+    if (next != shelf->freeSpans.end() && x + width == next->first) {
+        width += next->second;
+        next = shelf->freeSpans.erase(next);
+    }
+    if (next != shelf->freeSpans.begin()) {
+        const auto previous = std::prev(next);
+        if (previous->first + previous->second == x) {
+            x = previous->first;
+            width += previous->second;
+            shelf->freeSpans.erase(previous);
+        }
+    }
+    shelf->freeSpans.emplace(x, width);
+
+    if (shelf->binCount > 0) {
+        return;
+    }
+
+    // Merge empty shelves, so that their space can be split again for rectangles of other heights
+    auto index = static_cast<std::size_t>(shelf - shelves.begin());
+    if (index + 1 < shelves.size() && shelves[index + 1].binCount == 0) {
+        shelves[index].h += shelves[index + 1].h;
+        shelves.erase(shelves.begin() + static_cast<std::ptrdiff_t>(index) + 1);
+    }
+    if (index > 0 && shelves[index - 1].binCount == 0) {
+        shelves[index - 1].h += shelves[index].h;
+        shelves.erase(shelves.begin() + static_cast<std::ptrdiff_t>(index));
+        index--;
+    }
+    // The space of the last shelf goes back to the unused space at the bottom
+    if (index + 1 == shelves.size()) {
+        shelves.pop_back();
+    }
+}
+
+std::vector<Rect<uint16_t>> mergeDirtyRects(std::vector<Rect<uint16_t>> rects, std::size_t uploadCost) {
+    struct Region {
+        uint32_t left;
+        uint32_t top;
+        uint32_t right;
+        uint32_t bottom;
+
+        std::size_t area() const { return static_cast<std::size_t>(right - left) * (bottom - top); }
+        std::size_t mergedArea(const Region& other) const {
+            return static_cast<std::size_t>(std::max(right, other.right) - std::min(left, other.left)) *
+                   (std::max(bottom, other.bottom) - std::min(top, other.top));
+        }
+        void merge(const Region& other) {
+            left = std::min(left, other.left);
+            top = std::min(top, other.top);
+            right = std::max(right, other.right);
+            bottom = std::max(bottom, other.bottom);
+        }
+    };
+
+    // Neighbouring rectangles of a shelf are visited one after the other
+    std::ranges::sort(rects, [](const auto& a, const auto& b) { return a.y != b.y ? a.y < b.y : a.x < b.x; });
+
+    // Merged when uploading the pixels in between costs less than another upload
+    const auto fits = [&](const Region& a, const Region& b) {
+        return a.mergedArea(b) <= a.area() + b.area() + uploadCost;
+    };
+
+    std::vector<Region> regions;
+    for (const auto& rect : rects) {
+        if (!rect.hasArea()) {
+            continue;
+        }
+        const Region region{.left = rect.x,
+                            .top = rect.y,
+                            .right = static_cast<uint32_t>(rect.x + rect.w),
+                            .bottom = static_cast<uint32_t>(rect.y + rect.h)};
+        const auto existing = std::ranges::find_if(regions, [&](const Region& other) { return fits(other, region); });
+        if (existing != regions.end()) {
+            existing->merge(region);
+        } else {
+            regions.push_back(region);
+        }
+    }
+
+    // Regions that grew may now be merged with each other
+    for (bool merged = true; merged;) {
+        merged = false;
+        for (std::size_t i = 0; i < regions.size() && !merged; i++) {
+            for (std::size_t j = i + 1; j < regions.size(); j++) {
+                if (fits(regions[i], regions[j])) {
+                    regions[i].merge(regions[j]);
+                    regions.erase(regions.begin() + static_cast<std::ptrdiff_t>(j));
+                    merged = true;
+                    break;
+                }
+            }
+        }
+    }
+
+    std::vector<Rect<uint16_t>> result;
+    result.reserve(regions.size());
+    for (const auto& region : regions) {
+        result.emplace_back(static_cast<uint16_t>(region.left),
+                            static_cast<uint16_t>(region.top),
+                            static_cast<uint16_t>(region.right - region.left),
+                            static_cast<uint16_t>(region.bottom - region.top));
+    }
+    return result;
+}
+
+} // namespace gfx
+} // namespace mbgl
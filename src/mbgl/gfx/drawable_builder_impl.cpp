@@ -51,10 +51,9 @@ DrawableBuilder::Impl::LineLayoutVertex DrawableBuilder::Impl::layoutVertex(
 void DrawableBuilder::Impl::addPolyline(gfx::DrawableBuilder& builder,
                                         const GeometryCoordinates& coordinates,
                                         const gfx::PolylineGeneratorOptions& options) {
-    using namespace std::placeholders;
-    gfx::PolylineGenerator<DrawableBuilder::Impl::LineLayoutVertex, std::unique_ptr<Drawable::DrawSegment>> generator(
+    using Generator = gfx::PolylineGenerator<LineLayoutVertex, std::unique_ptr<Drawable::DrawSegment>, &layoutVertex>;
+    Generator generator(
         polylineVertices,
-        std::bind(&DrawableBuilder::Impl::layoutVertex, this, _1, _2, _3, _4, _5, _6),
         segments,
         [&builder](std::size_t vertexOffset, std::size_t indexOffset) -> std::unique_ptr<Drawable::DrawSegment> {
             return builder.createSegment(gfx::Triangles(), SegmentBase(vertexOffset, indexOffset));
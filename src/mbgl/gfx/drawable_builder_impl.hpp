@@ -93,7 +93,7 @@ public:
     }
 
 private:
-    LineLayoutVertex layoutVertex(
+    static LineLayoutVertex layoutVertex(
         Point<int16_t> p, Point<double> e, bool round, bool up, int8_t dir, int32_t linesofar = 0);
 
     Mode mode{Mode::Custom};
@@ -2,14 +2,14 @@
 #include <mbgl/gfx/texture2d.hpp>
 #include <mbgl/gfx/context.hpp>
 
+#include <algorithm>
+#include <utility>
+
 namespace mbgl {
 namespace gfx {
 
-DynamicTexture::DynamicTexture(Context& context, Size size, TexturePixelType pixelType) {
-    mapbox::ShelfPack::ShelfPackOptions options;
-    options.autoResize = false;
-    shelfPack = mapbox::ShelfPack(size.width, size.height, options);
-
+DynamicTexture::DynamicTexture(Context& context, Size size, TexturePixelType pixelType)
+    : packer(size) {
     texture = context.createTexture2D();
     texture->setSize(size);
     texture->setFormat(pixelType, gfx::TextureChannelDataType::UnsignedByte);
@@ -33,11 +33,11 @@ bool DynamicTexture::isEmpty() const {
 
 std::optional<TextureHandle> DynamicTexture::reserveSize(const Size& size, int32_t uniqueId) {
     std::scoped_lock lock(mutex);
-    mapbox::Bin* bin = shelfPack.packOne(uniqueId, size.width, size.height);
+    const auto* bin = packer.pack(uniqueId, size);
     if (!bin) {
         return std::nullopt;
     }
-    if (bin->refcount() == 1) {
+    if (bin->refcount == 1) {
         numTextures++;
     }
     return TextureHandle(*bin);
@@ -59,17 +59,73 @@ void DynamicTexture::uploadImage(const uint8_t* /*pixelData*/, gfx::TextureHandl
 
 bool DynamicTexture::removeTexture(const TextureHandle& texHandle) {
     std::scoped_lock lock(mutex);
-    auto* bin = shelfPack.getBin(texHandle.getId());
-    if (!bin) {
+    if (!packer.getBin(texHandle.getId())) {
         return false;
     }
-    auto refcount = shelfPack.unref(*bin);
-    if (refcount == 0) {
+    if (packer.unref(texHandle.getId()) == 0) {
         numTextures--;
         return true;
     }
     return false;
 }
 
+double DynamicTexture::getOccupancy() const {
+    return packer.getOccupancy();
+}
+
+void DynamicTexture::stageImage(const uint8_t* pixelData, const Rect<uint16_t>& rect) {
+    const auto intersects = [&](const StagedRegion& image) {
+        return image.rect.x < rect.x + rect.w && rect.x < image.rect.x + image.rect.w &&
+               image.rect.y < rect.y + rect.h && rect.y < image.rect.y + image.rect.h;
+    };
+    std::erase_if(stagedImages, intersects);
+
+    const auto size = static_cast<std::size_t>(rect.w) * rect.h * texture->getPixelStride();
+    stagedImages.push_back({.rect = rect, .pixels = std::vector<uint8_t>(pixelData, pixelData + size)});
+}
+
+std::vector<DynamicTexture::StagedRegion> DynamicTexture::takeStagedRegions() {
+    auto images = std::exchange(stagedImages, {});
+    std::vector<Rect<uint16_t>> rects;
+    rects.reserve(images.size());
+    for (const auto& image : images) {
+        rects.push_back(image.rect);
+    }
+
+    // The staged images don't overlap, so regions without pixels in between them are exactly covered
+    // by images. Pixels in between would belong to images uploaded before, which aren't kept.
+    const auto regions = mergeDirtyRects(std::move(rects));
+
+    const auto stride = texture->getPixelStride();
+    std::vector<StagedRegion> result;
+    result.reserve(regions.size());
+    for (const auto& region : regions) {
+        auto& staged = result.emplace_back(StagedRegion{.rect = region, .pixels = {}});
+        for (auto& image : images) {
+            const auto& rect = image.rect;
+            if (rect.x < region.x || rect.y < region.y || rect.x + rect.w > region.x + region.w ||
+                rect.y + rect.h > region.y + region.h) {
+                continue;
+            }
+            if (rect == region) {
+                staged.pixels = std::move(image.pixels);
+                break;
+            }
+            if (staged.pixels.empty()) {
+                staged.pixels.resize(static_cast<std::size_t>(region.w) * region.h * stride);
+            }
+            const auto rowBytes = static_cast<std::size_t>(rect.w) * stride;
+            const auto x = static_cast<std::size_t>(rect.x - region.x);
+            const auto y = static_cast<std::size_t>(rect.y - region.y);
+            for (std::size_t row = 0; row < rect.h; row++) {
+                std::copy_n(image.pixels.data() + row * rowBytes,
+                            rowBytes,
+                            staged.pixels.data() + ((y + row) * region.w + x) * stride);
+            }
+        }
+    }
+    return result;
+}
+
 } // namespace gfx
 } // namespace mbgl
@@ -14,6 +14,7 @@
 
 #include <cassert>
 #include <limits>
+#include <type_traits>
 
 namespace mapbox {
 namespace util {
@@ -36,14 +37,14 @@ struct GeometryTooLongException : std::exception {};
 
 namespace {
 
-std::size_t addRingVertices(gfx::VertexVector<FillLayoutVertex>& vertices, const GeometryCoordinates& ring) {
+std::size_t addRingVertices(gfx::VertexVector<FillLayoutVertex>& vertices, std::span<const GeometryCoordinate> ring) {
     for (auto& point : ring) {
         vertices.emplace_back(FillBucket::layoutVertex(point));
     }
     return ring.size();
 }
 
-std::size_t totalVerticesCheck(const GeometryCollection& polygon) {
+std::size_t totalVerticesCheck(const PolygonView& polygon) {
     std::size_t totalVertices = 0;
     for (const auto& ring : polygon) {
         totalVertices += ring.size();
@@ -104,13 +105,96 @@ void addOutlineIndices(const std::size_t base,
     lineSegment.indexLength += nVertices * 2;
 }
 
+template <class Rings>
+void fillAndOutlineBuffers(const Rings& geometry,
+                           gfx::VertexVector<FillLayoutVertex>& vertices,
+                           gfx::IndexVector<gfx::Triangles>& fillIndexes,
+                           SegmentVector& fillSegments,
+                           gfx::IndexVector<gfx::Lines>& lineIndexes,
+                           SegmentVector& lineSegments) {
+    for (auto& polygon : classifyRingViews(geometry)) {
+        // Optimize polygons with many interior rings for earcut tesselation.
+        limitHoles(polygon, 500);
+
+        std::size_t totalVertices = totalVerticesCheck(polygon);
+        std::size_t startVertices = vertices.elements();
+
+        for (const auto& ring : polygon) {
+            std::size_t base = vertices.elements();
+            std::size_t nVertices = addRingVertices(vertices, ring);
+            addOutlineIndices(base, nVertices, lineSegments, lineIndexes);
+        }
+
+        std::vector<uint32_t> indices = mapbox::earcut(polygon);
+        addFillIndices(fillSegments, fillIndexes, indices, startVertices, totalVertices);
+    }
+}
+
+template <class Rings>
+void fillAndTriangulatedOutlineBuffers(const Rings& geometry,
+                                       gfx::VertexVector<FillLayoutVertex>& fillVertices,
+                                       gfx::IndexVector<gfx::Triangles>& fillIndexes,
+                                       SegmentVector& fillSegments,
+                                       gfx::VertexVector<LineLayoutVertex>& lineVertices,
+                                       gfx::IndexVector<gfx::Triangles>& lineIndexes,
+                                       SegmentVector& lineSegments,
+                                       gfx::IndexVector<gfx::Lines>& basicLineIndexes,
+                                       SegmentVector& basicLineSegments) {
+    gfx::PolylineGenerator<LineLayoutVertex, SegmentBase, &LineBucket::layoutVertex> lineGenerator(
+        lineVertices,
+        lineSegments,
+        [](std::size_t vertexOffset, std::size_t indexOffset) -> SegmentBase {
+            return SegmentBase(vertexOffset, indexOffset);
+        },
+        [](auto& seg) -> SegmentBase& { return seg; },
+        lineIndexes);
+
+    gfx::PolylineGeneratorOptions lineOptions;
+    lineOptions.type = FeatureType::Polygon;
+
+    // If we have pre-tessellated geometry, multi-polygons are tessellated
+    // together, so we need to add them to the fill segment all at once.
+    if constexpr (std::is_same_v<Rings, GeometryCollection>) {
+        if (!geometry.getTriangles().empty()) {
+            const std::size_t startVertices = fillVertices.elements();
+            std::size_t totalVertices = 0;
+            for (const auto& polygon : geometry) {
+                totalVertices += polygon.size();
+                addRingVertices(fillVertices, polygon);
+            }
+            addFillIndices(fillSegments, fillIndexes, geometry.getTriangles(), startVertices, totalVertices);
+            return;
+        }
+    }
+
+    for (auto& polygon : classifyRingViews(geometry)) {
+        // Optimize polygons with many interior rings for earcut tesselation.
+        limitHoles(polygon, 500);
+
+        const std::size_t totalVertices = totalVerticesCheck(polygon);
+        const std::size_t startVertices = fillVertices.elements();
+
+        for (const auto& ring : polygon) {
+            const std::size_t base = fillVertices.elements();
+            const std::size_t nVertices = addRingVertices(fillVertices, ring);
+            addOutlineIndices(base, nVertices, basicLineSegments, basicLineIndexes);
+            lineGenerator.generate(ring, lineOptions);
+        }
+
+        // tessellate, if no triangles are provided
+        std::vector<uint32_t> indices = mapbox::earcut(polygon);
+
+        addFillIndices(fillSegments, fillIndexes, indices, startVertices, totalVertices);
+    }
+}
+
 } // namespace
 
 void generateFillBuffers(const GeometryCollection& geometry,
                          gfx::VertexVector<FillLayoutVertex>& fillVertices,
                          gfx::IndexVector<Triangles>& fillIndexes,
                          SegmentVector& fillSegments) {
-    for (auto& polygon : classifyRings(geometry)) {
+    for (auto& polygon : classifyRingViews(geometry)) {
         // Optimize polygons with many interior rings for earcut tesselation.
         limitHoles(polygon, 500);
 
@@ -132,22 +216,16 @@ void generateFillAndOutineBuffers(const GeometryCollection& geometry,
                                   SegmentVector& fillSegments,
                                   gfx::IndexVector<gfx::Lines>& lineIndexes,
                                   SegmentVector& lineSegments) {
-    for (auto& polygon : classifyRings(geometry)) {
-        // Optimize polygons with many interior rings for earcut tesselation.
-        limitHoles(polygon, 500);
-
-        std::size_t totalVertices = totalVerticesCheck(polygon);
-        std::size_t startVertices = vertices.elements();
-
-        for (const auto& ring : polygon) {
-            std::size_t base = vertices.elements();
-            std::size_t nVertices = addRingVertices(vertices, ring);
-            addOutlineIndices(base, nVertices, lineSegments, lineIndexes);
-        }
+    fillAndOutlineBuffers(geometry, vertices, fillIndexes, fillSegments, lineIndexes, lineSegments);
+}
 
-        std::vector<uint32_t> indices = mapbox::earcut(polygon);
-        addFillIndices(fillSegments, fillIndexes, indices, startVertices, totalVertices);
-    }
+void generateFillAndOutineBuffers(GeometryRingsView geometry,
+                                  gfx::VertexVector<FillLayoutVertex>& vertices,
+                                  gfx::IndexVector<gfx::Triangles>& fillIndexes,
+                                  SegmentVector& fillSegments,
+                                  gfx::IndexVector<gfx::Lines>& lineIndexes,
+                                  SegmentVector& lineSegments) {
+    fillAndOutlineBuffers(geometry, vertices, fillIndexes, fillSegments, lineIndexes, lineSegments);
 }
 
 void generateFillAndOutineBuffers(const GeometryCollection& geometry,
@@ -157,9 +235,8 @@ void generateFillAndOutineBuffers(const GeometryCollection& geometry,
                                   gfx::VertexVector<LineLayoutVertex>& lineVertices,
                                   gfx::IndexVector<gfx::Triangles>& lineIndexes,
                                   SegmentVector& lineSegments) {
-    gfx::PolylineGenerator<LineLayoutVertex, SegmentBase> lineGenerator(
+    gfx::PolylineGenerator<LineLayoutVertex, SegmentBase, &LineBucket::layoutVertex> lineGenerator(
         lineVertices,
-        LineBucket::layoutVertex,
         lineSegments,
         [](std::size_t vertexOffset, std::size_t indexOffset) -> SegmentBase {
             return SegmentBase(vertexOffset, indexOffset);
@@ -170,7 +247,7 @@ void generateFillAndOutineBuffers(const GeometryCollection& geometry,
     gfx::PolylineGeneratorOptions lineOptions;
     lineOptions.type = FeatureType::Polygon;
 
-    for (auto& polygon : classifyRings(geometry)) {
+    for (auto& polygon : classifyRingViews(geometry)) {
         // Optimize polygons with many interior rings for earcut tesselation.
         limitHoles(polygon, 500);
 
@@ -196,51 +273,35 @@ void generateFillAndOutineBuffers(const GeometryCollection& geometry,
                                   SegmentVector& lineSegments,
                                   gfx::IndexVector<gfx::Lines>& basicLineIndexes,
                                   SegmentVector& basicLineSegments) {
-    gfx::PolylineGenerator<LineLayoutVertex, SegmentBase> lineGenerator(
-        lineVertices,
-        LineBucket::layoutVertex,
-        lineSegments,
-        [](std::size_t vertexOffset, std::size_t indexOffset) -> SegmentBase {
-            return SegmentBase(vertexOffset, indexOffset);
-        },
-        [](auto& seg) -> SegmentBase& { return seg; },
-        lineIndexes);
-
-    gfx::PolylineGeneratorOptions lineOptions;
-    lineOptions.type = FeatureType::Polygon;
-
-    // If we have pre-tessellated geometry, multi-polygons are tessellated
-    // together, so we need to add them to the fill segment all at once.
-    if (!geometry.getTriangles().empty()) {
-        const std::size_t startVertices = fillVertices.elements();
-        std::size_t totalVertices = 0;
-        for (const auto& polygon : geometry) {
-            totalVertices += polygon.size();
-            addRingVertices(fillVertices, polygon);
-        }
-        addFillIndices(fillSegments, fillIndexes, geometry.getTriangles(), startVertices, totalVertices);
-        return;
-    }
-
-    for (auto& polygon : classifyRings(geometry)) {
-        // Optimize polygons with many interior rings for earcut tesselation.
-        limitHoles(polygon, 500);
-
-        const std::size_t totalVertices = totalVerticesCheck(polygon);
-        const std::size_t startVertices = fillVertices.elements();
-
-        for (const auto& ring : polygon) {
-            const std::size_t base = fillVertices.elements();
-            const std::size_t nVertices = addRingVertices(fillVertices, ring);
-            addOutlineIndices(base, nVertices, basicLineSegments, basicLineIndexes);
-            lineGenerator.generate(ring, lineOptions);
-        }
-
-        // tessellate, if no triangles are provided
-        std::vector<uint32_t> indices = mapbox::earcut(polygon);
+    fillAndTriangulatedOutlineBuffers(geometry,
+                                      fillVertices,
+                                      fillIndexes,
+                                      fillSegments,
+                                      lineVertices,
+                                      lineIndexes,
+                                      lineSegments,
+                                      basicLineIndexes,
+                                      basicLineSegments);
+}
 
-        addFillIndices(fillSegments, fillIndexes, indices, startVertices, totalVertices);
-    }
+void generateFillAndOutineBuffers(GeometryRingsView geometry,
+                                  gfx::VertexVector<FillLayoutVertex>& fillVertices,
+                                  gfx::IndexVector<gfx::Triangles>& fillIndexes,
+                                  SegmentVector& fillSegments,
+                                  gfx::VertexVector<LineLayoutVertex>& lineVertices,
+                                  gfx::IndexVector<gfx::Triangles>& lineIndexes,
+                                  SegmentVector& lineSegments,
+                                  gfx::IndexVector<gfx::Lines>& basicLineIndexes,
+                                  SegmentVector& basicLineSegments) {
+    fillAndTriangulatedOutlineBuffers(geometry,
+                                      fillVertices,
+                                      fillIndexes,
+                                      fillSegments,
+                                      lineVertices,
+                                      lineIndexes,
+                                      lineSegments,
+                                      basicLineIndexes,
+                                      basicLineSegments);
 }
 
 } // namespace gfx
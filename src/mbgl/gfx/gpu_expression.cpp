@@ -87,16 +87,23 @@ UniqueGPUExpression GPUExpression::create(const Expression& expression, const Zo
                 return UniqueGPUExpression{};
             }
             auto expr = GPUExpression::create(outType, step->getStopCount());
+            if (!expr) {
+                return expr;
+            }
             expr->options = options;
             expr->interpolation = GPUInterpType::Step;
             step->eachStop(addStop(expr, outType, index));
             return expr;
         },
         [&](const Interpolate* interp) {
-            if (interp->getStopCount() > maxStops) {
+            // The shaders don't implement cubic-bezier, leave those to the CPU
+            if (interp->getStopCount() > maxStops || interp->getInterpolator().is<CubicBezierInterpolator>()) {
                 return UniqueGPUExpression{};
             }
             auto expr = GPUExpression::create(outType, interp->getStopCount());
+            if (!expr) {
+                return expr;
+            }
             expr->options = options;
             expr->interpolation = getInterpType(interp->getInterpolator());
             expr->interpOptions.exponential.base = getInterpBase(interp->getInterpolator());
@@ -48,6 +48,17 @@ public:
         dirty = true;
     }
 
+    /// Adds `offset` to every index from position `first` on, e.g. to move
+    /// indexes written relative to some vertex onto their segment.
+    void rebase(std::size_t first, uint16_t offset) {
+        assert(first <= v.size());
+        assert(!released);
+        for (auto it = v.begin() + first; it != v.end(); ++it) {
+            *it = static_cast<uint16_t>(*it + offset);
+        }
+        dirty = true;
+    }
+
     uint16_t& at(std::size_t n) {
         assert(n < v.size());
         assert(!released);
@@ -7,6 +7,8 @@
 #include <mbgl/gfx/drawable_builder_impl.hpp>
 #include <mbgl/gfx/drawable_impl.hpp>
 
+#include <algorithm>
+#include <array>
 #include <memory>
 #include <numbers>
 
@@ -33,6 +35,10 @@ constexpr float SHARP_CORNER_OFFSET = 15.0f;
 // Angle per triangle for approximating round line joins.
 constexpr float DEG_PER_TRIANGLE = 20.0f;
 
+// Fake round joins are only used up to a miter length of 2, i.e. for angles
+// of up to 120 degrees, which takes at most 6 slices.
+constexpr unsigned MAX_PIE_SLICES = 8;
+
 // The number of bits that is used to store the line distance in the buffer.
 constexpr int LINE_DISTANCE_BUFFER_BITS = 14;
 
@@ -55,32 +61,21 @@ double PolylineGeneratorDistances::scaleToMaxLineDistance(double tileDistance) c
     return (relativeTileDistance * (clipEnd - clipStart) + clipStart) * (MAX_LINE_DISTANCE - 1);
 }
 
-template <class PLV, class PS>
-struct PolylineGenerator<PLV, PS>::TriangleElement {
-    TriangleElement(uint16_t a_, uint16_t b_, uint16_t c_)
-        : a(a_),
-          b(b_),
-          c(c_) {}
-    uint16_t a, b, c;
-};
-
-template <class PLV, class PS>
-PolylineGenerator<PLV, PS>::PolylineGenerator(Vertices& polylineVertices,
-                                              LayoutVertexFunc layoutVertexFunc,
-                                              Segments& polylineSegments,
-                                              CreateSegmentFunc createSegmentFunc,
-                                              GetSegmentFunc getSegmentFunc,
-                                              Indexes& polylineIndexes)
+template <class PLV, class PS, auto layoutVertex>
+PolylineGenerator<PLV, PS, layoutVertex>::PolylineGenerator(Vertices& polylineVertices,
+                                                            Segments& polylineSegments,
+                                                            CreateSegmentFunc createSegmentFunc,
+                                                            GetSegmentFunc getSegmentFunc,
+                                                            Indexes& polylineIndexes)
     : vertices(polylineVertices),
-      layoutVertex(layoutVertexFunc),
       segments(polylineSegments),
       createSegment(createSegmentFunc),
       getSegment(getSegmentFunc),
       indexes(polylineIndexes) {}
 
-template <class PLV, class PS>
-void PolylineGenerator<PLV, PS>::generate(const GeometryCoordinates& coordinates,
-                                          const PolylineGeneratorOptions& options) {
+template <class PLV, class PS, auto layoutVertex>
+void PolylineGenerator<PLV, PS, layoutVertex>::generate(std::span<const GeometryCoordinate> coordinates,
+                                                        const PolylineGeneratorOptions& options) {
     const std::size_t len = [&coordinates] {
         std::size_t l = coordinates.size();
         // If the line has duplicate vertices at the end, adjust length to remove them.
@@ -135,12 +130,19 @@ void PolylineGenerator<PLV, PS>::generate(const GeometryCoordinates& coordinates
         nextNormal = util::perp(util::unit(convertPoint<double>(firstCoordinate - *currentCoordinate)));
     }
 
+    const PolylineGeneratorDistances* lineDistances = options.clipDistances ? &*options.clipDistances : nullptr;
+
+    // Triangles are written straight into the index buffer, relative to the
+    // first vertex of this line, and rebased onto their segment at the end.
     const std::size_t startVertex = vertices.elements();
-    std::vector<TriangleElement> triangleStore;
+    const std::size_t startIndex = indexes.elements();
 
-    // Pre-allocate for triangles based on measuring benchmark execution
+    // Pre-allocate based on measuring benchmark execution. Only the first line
+    // reserves, later ones rely on the amortized growth of the buffers.
     constexpr auto approxTrianglesPerSegment = 6;
-    triangleStore.reserve((len - first) * approxTrianglesPerSegment);
+    if (indexes.empty()) {
+        indexes.reserve((len - first) * approxTrianglesPerSegment * 3);
+    }
 
     // Vertex count depends on length rather than segment count, and two elements often generates
     // thousands of vertices, so we allocate some extra memory to skip the next 10 allocations.
@@ -236,8 +238,7 @@ void PolylineGenerator<PLV, PS>::generate(const GeometryCoordinates& coordinates
                                  0,
                                  false,
                                  startVertex,
-                                 triangleStore,
-                                 options.clipDistances);
+                                 lineDistances);
                 prevCoordinate = newPrevVertex;
             }
         }
@@ -288,8 +289,7 @@ void PolylineGenerator<PLV, PS>::generate(const GeometryCoordinates& coordinates
                              0,
                              false,
                              startVertex,
-                             triangleStore,
-                             options.clipDistances);
+                             lineDistances);
 
         } else if (middleVertex && currentJoin == style::LineJoinType::FlipBevel) {
             // miter is too big, flip the direction to make a beveled join
@@ -311,8 +311,7 @@ void PolylineGenerator<PLV, PS>::generate(const GeometryCoordinates& coordinates
                              0,
                              false,
                              startVertex,
-                             triangleStore,
-                             options.clipDistances);
+                             lineDistances);
 
             addCurrentVertex(*currentCoordinate,
                              distance,
@@ -321,8 +320,7 @@ void PolylineGenerator<PLV, PS>::generate(const GeometryCoordinates& coordinates
                              0,
                              false,
                              startVertex,
-                             triangleStore,
-                             options.clipDistances);
+                             lineDistances);
         } else if (middleVertex &&
                    (currentJoin == style::LineJoinType::Bevel || currentJoin == style::LineJoinType::FakeRound)) {
             const bool lineTurnsLeft = (prevNormal->x * nextNormal->y - prevNormal->y * nextNormal->x) > 0;
@@ -347,8 +345,7 @@ void PolylineGenerator<PLV, PS>::generate(const GeometryCoordinates& coordinates
                                  offsetB,
                                  false,
                                  startVertex,
-                                 triangleStore,
-                                 options.clipDistances);
+                                 lineDistances);
             }
 
             if (currentJoin == style::LineJoinType::FakeRound) {
@@ -360,26 +357,36 @@ void PolylineGenerator<PLV, PS>::generate(const GeometryCoordinates& coordinates
 
                 // Pick the number of triangles for approximating round join by
                 // based on the angle between normals.
-                const auto n = static_cast<unsigned>(::round((approxAngle * 180 / pi) / DEG_PER_TRIANGLE));
+                const auto n = std::min(
+                    static_cast<unsigned>(::round((approxAngle * 180 / pi) / DEG_PER_TRIANGLE)), MAX_PIE_SLICES);
+
+                // Compute all slice normals first. The loop has no branches or
+                // calls, so that compilers turn it into vector instructions.
+                // approximate spherical interpolation
+                // https://observablehq.com/@mourner/approximating-geometric-slerp
+                const double A = 1.0904 + cosAngle * (-3.2452 + cosAngle * (3.55645 - cosAngle * 1.43519));
+                const double B = 0.848013 + cosAngle * (-1.06021 + cosAngle * 0.215638);
+                std::array<double, MAX_PIE_SLICES> sliceX{};
+                std::array<double, MAX_PIE_SLICES> sliceY{};
+                for (unsigned m = 1; m < n; ++m) {
+                    const double t1 = static_cast<double>(m) / n;
+                    // The correction vanishes at t = 0.5, which therefore needs no special case.
+                    const double t2 = t1 - 0.5;
+                    const double t = t1 + t1 * t2 * (t1 - 1) * (A * t2 * t2 + B);
+                    const double x = prevNormal->x * (1.0 - t) + nextNormal->x * t;
+                    const double y = prevNormal->y * (1.0 - t) + nextNormal->y * t;
+                    const double magnitude = std::sqrt(x * x + y * y);
+                    sliceX[m] = magnitude == 0 ? x : x / magnitude;
+                    sliceY[m] = magnitude == 0 ? y : y / magnitude;
+                }
 
                 for (unsigned m = 1; m < n; ++m) {
-                    double t = static_cast<double>(m) / n;
-                    if (t != 0.5) {
-                        // approximate spherical interpolation
-                        // https://observablehq.com/@mourner/approximating-geometric-slerp
-                        const double t2 = t - 0.5;
-                        const double A = 1.0904 + cosAngle * (-3.2452 + cosAngle * (3.55645 - cosAngle * 1.43519));
-                        const double B = 0.848013 + cosAngle * (-1.06021 + cosAngle * 0.215638);
-                        t = t + t * t2 * (t - 1) * (A * t2 * t2 + B);
-                    }
-                    auto approxFractionalNormal = util::unit(*prevNormal * (1.0 - t) + *nextNormal * t);
                     addPieSliceVertex(*currentCoordinate,
                                       distance,
-                                      approxFractionalNormal,
+                                      {sliceX[m], sliceY[m]},
                                       lineTurnsLeft,
                                       startVertex,
-                                      triangleStore,
-                                      options.clipDistances);
+                                      lineDistances);
                 }
             }
 
@@ -392,8 +399,7 @@ void PolylineGenerator<PLV, PS>::generate(const GeometryCoordinates& coordinates
                                  -offsetB,
                                  false,
                                  startVertex,
-                                 triangleStore,
-                                 options.clipDistances);
+                                 lineDistances);
             }
 
         } else if (!middleVertex && currentCap == style::LineCapType::Butt) {
@@ -406,8 +412,7 @@ void PolylineGenerator<PLV, PS>::generate(const GeometryCoordinates& coordinates
                                  0,
                                  false,
                                  startVertex,
-                                 triangleStore,
-                                 options.clipDistances);
+                                 lineDistances);
             }
 
             // Start next segment with a butt
@@ -419,8 +424,7 @@ void PolylineGenerator<PLV, PS>::generate(const GeometryCoordinates& coordinates
                                  0,
                                  false,
                                  startVertex,
-                                 triangleStore,
-                                 options.clipDistances);
+                                 lineDistances);
             }
 
         } else if (!middleVertex && currentCap == style::LineCapType::Square) {
@@ -433,8 +437,7 @@ void PolylineGenerator<PLV, PS>::generate(const GeometryCoordinates& coordinates
                                  1,
                                  false,
                                  startVertex,
-                                 triangleStore,
-                                 options.clipDistances);
+                                 lineDistances);
 
                 // The segment is done. Unset vertices to disconnect segments.
                 e1 = e2 = -1;
@@ -449,8 +452,7 @@ void PolylineGenerator<PLV, PS>::generate(const GeometryCoordinates& coordinates
                                  -1,
                                  false,
                                  startVertex,
-                                 triangleStore,
-                                 options.clipDistances);
+                                 lineDistances);
             }
 
         } else if (middleVertex ? currentJoin == style::LineJoinType::Round : currentCap == style::LineCapType::Round) {
@@ -463,8 +465,7 @@ void PolylineGenerator<PLV, PS>::generate(const GeometryCoordinates& coordinates
                                  0,
                                  false,
                                  startVertex,
-                                 triangleStore,
-                                 options.clipDistances);
+                                 lineDistances);
 
                 // Add round cap or linejoin at end of segment
                 addCurrentVertex(*currentCoordinate,
@@ -474,8 +475,7 @@ void PolylineGenerator<PLV, PS>::generate(const GeometryCoordinates& coordinates
                                  1,
                                  true,
                                  startVertex,
-                                 triangleStore,
-                                 options.clipDistances);
+                                 lineDistances);
 
                 // The segment is done. Unset vertices to disconnect segments.
                 e1 = e2 = -1;
@@ -491,8 +491,7 @@ void PolylineGenerator<PLV, PS>::generate(const GeometryCoordinates& coordinates
                                  -1,
                                  true,
                                  startVertex,
-                                 triangleStore,
-                                 options.clipDistances);
+                                 lineDistances);
 
                 addCurrentVertex(*currentCoordinate,
                                  distance,
@@ -501,8 +500,7 @@ void PolylineGenerator<PLV, PS>::generate(const GeometryCoordinates& coordinates
                                  0,
                                  false,
                                  startVertex,
-                                 triangleStore,
-                                 options.clipDistances);
+                                 lineDistances);
             }
         }
 
@@ -521,8 +519,7 @@ void PolylineGenerator<PLV, PS>::generate(const GeometryCoordinates& coordinates
                                  0,
                                  false,
                                  startVertex,
-                                 triangleStore,
-                                 options.clipDistances);
+                                 lineDistances);
                 currentCoordinate = newCurrentVertex;
             }
         }
@@ -530,40 +527,40 @@ void PolylineGenerator<PLV, PS>::generate(const GeometryCoordinates& coordinates
         startOfLine = false;
     }
 
-    // add segment(s) and indices
+    // add segment(s) and rebase the indices onto it
     const std::size_t endVertex = vertices.elements();
     const std::size_t vertexCount = endVertex - startVertex;
+    const std::size_t indexCount = indexes.elements() - startIndex;
 
     if (segments.empty() ||
         getSegment(segments.back()).vertexLength + vertexCount > std::numeric_limits<uint16_t>::max()) {
-        segments.emplace_back(createSegment(startVertex, indexes.elements()));
+        segments.emplace_back(createSegment(startVertex, startIndex));
     }
 
     auto& segment = getSegment(segments.back());
     assert(segment.vertexLength <= std::numeric_limits<uint16_t>::max());
-    const uint16_t index = static_cast<uint16_t>(segment.vertexLength);
-
-    if (indexes.empty()) {
-        indexes.reserve(triangleStore.size() * 3);
-    }
-    for (const auto& triangle : triangleStore) {
-        indexes.emplace_back(index + triangle.a, index + triangle.b, index + triangle.c);
-    }
+    indexes.rebase(startIndex, static_cast<uint16_t>(segment.vertexLength));
 
     segment.vertexLength += vertexCount;
-    segment.indexLength += triangleStore.size() * 3;
+    segment.indexLength += indexCount;
 }
 
-template <class PLV, class PS>
-void PolylineGenerator<PLV, PS>::addCurrentVertex(const GeometryCoordinate& currentCoordinate,
-                                                  double& distance,
-                                                  const Point<double>& normal,
-                                                  double endLeft,
-                                                  double endRight,
-                                                  bool round,
-                                                  std::size_t startVertex,
-                                                  std::vector<TriangleElement>& triangleStore,
-                                                  std::optional<PolylineGeneratorDistances> lineDistances) {
+template <class PLV, class PS, auto layoutVertex>
+void PolylineGenerator<PLV, PS, layoutVertex>::addTriangle() {
+    if (e1 >= 0 && e2 >= 0) {
+        indexes.emplace_back(static_cast<uint16_t>(e1), static_cast<uint16_t>(e2), static_cast<uint16_t>(e3));
+    }
+}
+
+template <class PLV, class PS, auto layoutVertex>
+void PolylineGenerator<PLV, PS, layoutVertex>::addCurrentVertex(const GeometryCoordinate& currentCoordinate,
+                                                                double& distance,
+                                                                const Point<double>& normal,
+                                                                double endLeft,
+                                                                double endRight,
+                                                                bool round,
+                                                                std::size_t startVertex,
+                                                                const PolylineGeneratorDistances* lineDistances) {
     Point<double> extrude = normal;
     const double scaledDistance = lineDistances ? lineDistances->scaleToMaxLineDistance(distance) : distance;
 
@@ -575,9 +572,7 @@ void PolylineGenerator<PLV, PS>::addCurrentVertex(const GeometryCoordinate& curr
                                        static_cast<int8_t>(endLeft),
                                        static_cast<int32_t>(scaledDistance * LINE_DISTANCE_SCALE)));
     e3 = vertices.elements() - 1 - startVertex;
-    if (e1 >= 0 && e2 >= 0) {
-        triangleStore.emplace_back(static_cast<uint16_t>(e1), static_cast<uint16_t>(e2), static_cast<uint16_t>(e3));
-    }
+    addTriangle();
     e1 = e2;
     e2 = e3;
 
@@ -590,9 +585,7 @@ void PolylineGenerator<PLV, PS>::addCurrentVertex(const GeometryCoordinate& curr
                                        static_cast<int8_t>(-endRight),
                                        static_cast<int32_t>(scaledDistance * LINE_DISTANCE_SCALE)));
     e3 = vertices.elements() - 1 - startVertex;
-    if (e1 >= 0 && e2 >= 0) {
-        triangleStore.emplace_back(static_cast<uint16_t>(e1), static_cast<uint16_t>(e2), static_cast<uint16_t>(e3));
-    }
+    addTriangle();
     e1 = e2;
     e2 = e3;
 
@@ -602,19 +595,17 @@ void PolylineGenerator<PLV, PS>::addCurrentVertex(const GeometryCoordinate& curr
     // the number of bits we allocate to `linesofar`.
     if (distance > MAX_LINE_DISTANCE / 2.0f && !lineDistances) {
         distance = 0.0;
-        addCurrentVertex(
-            currentCoordinate, distance, normal, endLeft, endRight, round, startVertex, triangleStore, lineDistances);
+        addCurrentVertex(currentCoordinate, distance, normal, endLeft, endRight, round, startVertex, lineDistances);
     }
 }
 
-template <class PLV, class PS>
-void PolylineGenerator<PLV, PS>::addPieSliceVertex(const GeometryCoordinate& currentVertex,
-                                                   double distance,
-                                                   const Point<double>& extrude,
-                                                   bool lineTurnsLeft,
-                                                   std::size_t startVertex,
-                                                   std::vector<TriangleElement>& triangleStore,
-                                                   std::optional<PolylineGeneratorDistances> lineDistances) {
+template <class PLV, class PS, auto layoutVertex>
+void PolylineGenerator<PLV, PS, layoutVertex>::addPieSliceVertex(const GeometryCoordinate& currentVertex,
+                                                                 double distance,
+                                                                 const Point<double>& extrude,
+                                                                 bool lineTurnsLeft,
+                                                                 std::size_t startVertex,
+                                                                 const PolylineGeneratorDistances* lineDistances) {
     Point<double> flippedExtrude = extrude * (lineTurnsLeft ? -1.0 : 1.0);
     if (lineDistances) {
         distance = lineDistances->scaleToMaxLineDistance(distance);
@@ -623,9 +614,7 @@ void PolylineGenerator<PLV, PS>::addPieSliceVertex(const GeometryCoordinate& cur
     vertices.emplace_back(layoutVertex(
         currentVertex, flippedExtrude, false, lineTurnsLeft, 0, static_cast<int32_t>(distance * LINE_DISTANCE_SCALE)));
     e3 = vertices.elements() - 1 - startVertex;
-    if (e1 >= 0 && e2 >= 0) {
-        triangleStore.emplace_back(static_cast<uint16_t>(e1), static_cast<uint16_t>(e2), static_cast<uint16_t>(e3));
-    }
+    addTriangle();
 
     if (lineTurnsLeft) {
         e2 = e3;
@@ -635,9 +624,10 @@ void PolylineGenerator<PLV, PS>::addPieSliceVertex(const GeometryCoordinate& cur
 }
 
 template class PolylineGenerator<gfx::DrawableBuilder::Impl::LineLayoutVertex,
-                                 std::unique_ptr<gfx::Drawable::DrawSegment>>;
+                                 std::unique_ptr<gfx::Drawable::DrawSegment>,
+                                 &gfx::DrawableBuilder::Impl::layoutVertex>;
 
-template class PolylineGenerator<LineLayoutVertex, SegmentBase>;
+template class PolylineGenerator<LineLayoutVertex, SegmentBase, &LineBucket::layoutVertex>;
 
 } // namespace gfx
 } // namespace mbgl
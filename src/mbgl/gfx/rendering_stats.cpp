@@ -19,21 +19,28 @@ bool RenderingStats::isZero() const {
                                 numVertexBuffers,
                                 numIndexBuffers,
                                 numUniformBuffers,
+                                numPooledBuffers,
+                                numBufferPages,
                                 numFrameBuffers,
                                 memTextures,
                                 memBuffers,
                                 memIndexBuffers,
                                 memVertexBuffers,
-                                memUniformBuffers};
+                                memUniformBuffers,
+                                memBufferPages};
     return std::ranges::all_of(expectedZeros, [](auto x) { return x == 0; });
 }
 
 RenderingStats& RenderingStats::operator+=(const RenderingStats& r) {
     encodingTime += r.encodingTime;
     renderingTime += r.renderingTime;
+    orchestrationTime += r.orchestrationTime;
+    placementTime += r.placementTime;
+    uploadTime += r.uploadTime;
     numFrames += r.numFrames;
     numDrawCalls += r.numDrawCalls;
     totalDrawCalls += r.totalDrawCalls;
+    numParallelRecordedBatches += r.numParallelRecordedBatches;
     numCreatedTextures += r.numCreatedTextures;
     numActiveTextures += r.numActiveTextures;
     numTextureBindings += r.numTextureBindings;
@@ -50,6 +57,12 @@ RenderingStats& RenderingStats::operator+=(const RenderingStats& r) {
     indexUpdateBytes += r.indexUpdateBytes;
     numVertexBuffers += r.numVertexBuffers;
     vertexUpdateBytes += r.vertexUpdateBytes;
+    numPooledBuffers += r.numPooledBuffers;
+    numBufferPages += r.numBufferPages;
+    memBufferPages += r.memBufferPages;
+    numVertexArrayBinds += r.numVertexArrayBinds;
+    numProgramBinds += r.numProgramBinds;
+    numTextureBinds += r.numTextureBinds;
     numUniformBuffers += r.numUniformBuffers;
     numUniformUpdates += r.numUniformUpdates;
     uniformUpdateBytes += r.uniformUpdateBytes;
@@ -60,6 +73,12 @@ RenderingStats& RenderingStats::operator+=(const RenderingStats& r) {
     memUniformBuffers += r.memUniformBuffers;
     stencilClears += r.stencilClears;
     stencilUpdates += r.stencilUpdates;
+    numAbandonedTileParses += r.numAbandonedTileParses;
+    numSkippedTileParses += r.numSkippedTileParses;
+    abandonedTileParseTime += r.abandonedTileParseTime;
+    numShapingCacheHits += r.numShapingCacheHits;
+    numShapingCacheMisses += r.numShapingCacheMisses;
+    shapingCacheSize += r.shapingCacheSize;
     return *this;
 }
 
@@ -77,9 +96,13 @@ std::string RenderingStats::toString(std::string_view sep) const {
 
     optionalStatLine(ss, encodingTime, "encodingTime", sep);
     optionalStatLine(ss, renderingTime, "renderingTime", sep);
+    optionalStatLine(ss, orchestrationTime, "orchestrationTime", sep);
+    optionalStatLine(ss, placementTime, "placementTime", sep);
+    optionalStatLine(ss, uploadTime, "uploadTime", sep);
     optionalStatLine(ss, numFrames, "numFrames", sep);
     optionalStatLine(ss, numDrawCalls, "numDrawCalls", sep);
     optionalStatLine(ss, totalDrawCalls, "totalDrawCalls", sep);
+    optionalStatLine(ss, numParallelRecordedBatches, "numParallelRecordedBatches", sep);
     optionalStatLine(ss, numCreatedTextures, "numCreatedTextures", sep);
     optionalStatLine(ss, numActiveTextures, "numActiveTextures", sep);
     optionalStatLine(ss, numTextureBindings, "numTextureBindings", sep);
@@ -96,6 +119,12 @@ std::string RenderingStats::toString(std::string_view sep) const {
     optionalStatLine(ss, indexUpdateBytes, "indexUpdateBytes", sep);
     optionalStatLine(ss, numVertexBuffers, "numVertexBuffers", sep);
     optionalStatLine(ss, vertexUpdateBytes, "vertexUpdateBytes", sep);
+    optionalStatLine(ss, numPooledBuffers, "numPooledBuffers", sep);
+    optionalStatLine(ss, numBufferPages, "numBufferPages", sep);
+    optionalStatLine(ss, memBufferPages, "memBufferPages", sep);
+    optionalStatLine(ss, numVertexArrayBinds, "numVertexArrayBinds", sep);
+    optionalStatLine(ss, numProgramBinds, "numProgramBinds", sep);
+    optionalStatLine(ss, numTextureBinds, "numTextureBinds", sep);
     optionalStatLine(ss, numUniformBuffers, "numUniformBuffers", sep);
     optionalStatLine(ss, numUniformUpdates, "numUniformUpdates", sep);
     optionalStatLine(ss, uniformUpdateBytes, "uniformUpdateBytes", sep);
@@ -106,6 +135,12 @@ std::string RenderingStats::toString(std::string_view sep) const {
     optionalStatLine(ss, memUniformBuffers, "memUniformBuffers", sep);
     optionalStatLine(ss, stencilClears, "stencilClears", sep);
     optionalStatLine(ss, stencilUpdates, "stencilUpdates", sep);
+    optionalStatLine(ss, numAbandonedTileParses, "numAbandonedTileParses", sep);
+    optionalStatLine(ss, numSkippedTileParses, "numSkippedTileParses", sep);
+    optionalStatLine(ss, abandonedTileParseTime, "abandonedTileParseTime", sep);
+    optionalStatLine(ss, numShapingCacheHits, "numShapingCacheHits", sep);
+    optionalStatLine(ss, numShapingCacheMisses, "numShapingCacheMisses", sep);
+    optionalStatLine(ss, shapingCacheSize, "shapingCacheSize", sep);
     return ss.str();
 }
 #endif
@@ -0,0 +1,194 @@
+#include <mbgl/gfx/shader_binary_cache.hpp>
+
+#include <mbgl/util/io.hpp>
+#include <mbgl/util/logging.hpp>
+#include <mbgl/util/string.hpp>
+
+#include <cstdio>
+#include <cstring>
+#include <exception>
+#include <random>
+#include <sstream>
+
+namespace mbgl {
+namespace gfx {
+
+namespace {
+
+constexpr std::string_view magic = "MLNSHBIN";
+constexpr uint32_t formatVersion = 1;
+
+// FNV-1a, which unlike std::hash gives the same keys in every run and on every platform
+uint64_t fnv1a(std::string_view data, uint64_t seed = 0xcbf29ce484222325ULL) {
+    for (const char c : data) {
+        seed ^= static_cast<uint8_t>(c);
+        seed *= 0x100000001b3ULL;
+    }
+    return seed;
+}
+
+template <typename T>
+void append(std::string& out, T value) {
+    out.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+// Reads values from the file, failing once it runs out of data
+class Reader {
+public:
+    explicit Reader(std::string_view data_)
+        : data(data_) {}
+
+    template <typename T>
+    bool read(T& value) {
+        if (data.size() < sizeof(T)) {
+            return false;
+        }
+        std::memcpy(&value, data.data(), sizeof(T));
+        data.remove_prefix(sizeof(T));
+        return true;
+    }
+
+    bool read(std::string_view& value, uint64_t size) {
+        if (data.size() < size) {
+            return false;
+        }
+        value = data.substr(0, static_cast<std::size_t>(size));
+        data.remove_prefix(static_cast<std::size_t>(size));
+        return true;
+    }
+
+private:
+    std::string_view data;
+};
+
+std::string cachePath(const std::string& directory, const std::string& driverID) {
+    std::ostringstream name;
+    name << directory << "/shaders-" << std::hex << fnv1a(driverID) << ".bin";
+    return name.str();
+}
+
+} // namespace
+
+ShaderBinaryCache::ShaderBinaryCache(const std::string& directory, std::string driverID_)
+    : path(cachePath(directory, driverID_)),
+      driverID(std::move(driverID_)),
+      loading(std::async(std::launch::async, &ShaderBinaryCache::load, path, driverID)) {}
+
+ShaderBinaryCache::~ShaderBinaryCache() {
+    if (loading.valid()) {
+        loading.wait();
+    }
+}
+
+uint64_t ShaderBinaryCache::hash(const std::vector<std::string_view>& sources) {
+    uint64_t result = fnv1a({});
+    for (const auto& source : sources) {
+        result = fnv1a(source, result);
+        // Separate the sources, so that moving text from one to the next changes the key
+        result = fnv1a(std::string_view("\0", 1), result);
+    }
+    return result;
+}
+
+ShaderBinaryCache::Binaries ShaderBinaryCache::load(const std::string& path, const std::string& driverID) {
+    Binaries result;
+    const auto file = util::readFile(path);
+    if (!file) {
+        return result;
+    }
+
+    Reader reader(*file);
+    std::string_view fileMagic;
+    uint32_t version = 0;
+    uint32_t driverIDSize = 0;
+    std::string_view fileDriverID;
+    uint32_t count = 0;
+    if (!reader.read(fileMagic, magic.size()) || fileMagic != magic || !reader.read(version) ||
+        version != formatVersion || !reader.read(driverIDSize) || !reader.read(fileDriverID, driverIDSize) ||
+        fileDriverID != driverID || !reader.read(count)) {
+        // Written by another version or driver, it's replaced with the binaries of this one
+        return result;
+    }
+
+    for (uint32_t i = 0; i < count; i++) {
+        uint64_t key = 0;
+        uint64_t size = 0;
+        uint64_t checksum = 0;
+        std::string_view binary;
+        if (!reader.read(key) || !reader.read(size) || !reader.read(checksum) || !reader.read(binary, size) ||
+            fnv1a(binary) != checksum) {
+            Log::Warning(Event::Shader, "Ignoring damaged shader cache " + path);
+            return {};
+        }
+        result.emplace(key, std::string(binary));
+    }
+    return result;
+}
+
+ShaderBinaryCache::Binaries& ShaderBinaryCache::getBinaries() {
+    if (loading.valid()) {
+        try {
+            binaries = loading.get();
+        } catch (const std::exception& e) {
+            Log::Warning(Event::Shader, std::string("Failed to read shader cache: ") + e.what());
+        }
+    }
+    return binaries;
+}
+
+std::optional<std::string> ShaderBinaryCache::get(uint64_t key) {
+    const auto& loaded = getBinaries();
+    const auto it = loaded.find(key);
+    if (it == loaded.end()) {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
+void ShaderBinaryCache::put(uint64_t key, std::string binary) {
+    getBinaries()[key] = std::move(binary);
+    modified = true;
+}
+
+void ShaderBinaryCache::remove(uint64_t key) {
+    modified |= getBinaries().erase(key) > 0;
+}
+
+void ShaderBinaryCache::save() {
+    if (!modified) {
+        return;
+    }
+    modified = false;
+
+    std::string file(magic);
+    append(file, formatVersion);
+    append(file, static_cast<uint32_t>(driverID.size()));
+    file.append(driverID);
+    append(file, static_cast<uint32_t>(binaries.size()));
+    for (const auto& [key, binary] : binaries) {
+        append(file, key);
+        append(file, static_cast<uint64_t>(binary.size()));
+        append(file, fnv1a(binary));
+        file.append(binary);
+    }
+
+    // Replace the file at once, so that other processes never read a partially written one. Other
+    // processes may write the same cache at the same time, each to a temporary file of its own.
+    std::random_device random;
+    const auto suffix = (static_cast<uint64_t>(random()) << 32) | random();
+    const auto temporaryPath = path + "." + util::toHex(suffix) + ".tmp";
+    try {
+        util::write_file(temporaryPath, file);
+        // Windows doesn't rename over an existing file
+        if (std::rename(temporaryPath.c_str(), path.c_str()) != 0 &&
+            (std::remove(path.c_str()) != 0 || std::rename(temporaryPath.c_str(), path.c_str()) != 0)) {
+            util::deleteFile(temporaryPath);
+            Log::Warning(Event::Shader, "Failed to replace shader cache " + path);
+        }
+    } catch (const std::exception& e) {
+        Log::Warning(Event::Shader, std::string("Failed to write shader cache: ") + e.what());
+    }
+}
+
+} // namespace gfx
+} // namespace mbgl
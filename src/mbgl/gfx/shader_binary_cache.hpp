@@ -0,0 +1,52 @@
+#pragma once
+
+#include <mbgl/util/noncopyable.hpp>
+
+#include <cstdint>
+#include <future>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace mbgl {
+namespace gfx {
+
+/// Compiled shader programs kept on disk between runs, so that they don't have to be compiled from
+/// source again. The binaries of a driver are stored together in one file of the cache directory,
+/// which is read on a background thread from construction on. Files written by other drivers or
+/// damaged ones are ignored, and binaries the driver rejects are removed with `remove()`.
+class ShaderBinaryCache : private util::noncopyable {
+public:
+    /// `driverID` identifies the driver and device, whose binaries aren't usable by any other
+    ShaderBinaryCache(const std::string& directory, std::string driverID);
+    ~ShaderBinaryCache();
+
+    /// Hashes the sources of a program into a key that stays the same from one run to the next
+    static uint64_t hash(const std::vector<std::string_view>& sources);
+
+    std::optional<std::string> get(uint64_t key);
+    void put(uint64_t key, std::string binary);
+    void remove(uint64_t key);
+
+    const std::string& getPath() const { return path; }
+
+    /// Writes the file if binaries were added or removed since it was read or last written
+    void save();
+
+private:
+    using Binaries = std::unordered_map<uint64_t, std::string>;
+
+    Binaries& getBinaries();
+    static Binaries load(const std::string& path, const std::string& driverID);
+
+    const std::string path;
+    const std::string driverID;
+    std::future<Binaries> loading;
+    Binaries binaries;
+    bool modified = false;
+};
+
+} // namespace gfx
+} // namespace mbgl
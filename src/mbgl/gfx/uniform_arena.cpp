@@ -0,0 +1,215 @@
+#include <mbgl/gfx/uniform_arena.hpp>
+
+#include <mbgl/util/instrumentation.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <iterator>
+
+namespace mbgl {
+namespace gfx {
+
+UniformArena::Block::Block(UniformArena& arena_, const void* data, std::size_t size)
+    : arena(arena_),
+      contents(size) {
+    if (data) {
+        std::memcpy(contents.data(), data, size);
+    }
+    arena.append(*this);
+}
+
+UniformArena::Block::Block(const Block& other)
+    : arena(other.arena),
+      contents(other.contents) {
+    arena.append(*this);
+}
+
+UniformArena::Block::Block(Block&& other) noexcept
+    : arena(other.arena),
+      contents(std::move(other.contents)),
+      region(other.region),
+      offset(other.offset),
+      slot(other.slot) {
+    if (slot != noSlot) {
+        arena.blocks[region][slot] = this;
+    }
+    // The moved-from block no longer owns an allocation
+    other.slot = noSlot;
+}
+
+UniformArena::Block::~Block() {
+    if (slot != noSlot) {
+        arena.remove(*this);
+    }
+}
+
+void UniformArena::Block::write(const void* data, std::size_t size) {
+    assert(size <= contents.size());
+    std::memcpy(contents.data(), data, std::min(size, contents.size()));
+    arena.remove(*this);
+    arena.append(*this);
+}
+
+std::size_t UniformArena::Block::getBindingOffset() const {
+    arena.flush();
+    return region * arena.capacity + offset;
+}
+
+UniformArena::UniformArena(std::size_t alignment_, std::size_t initialCapacity_)
+    : alignment(std::max<std::size_t>(alignment_, 1)),
+      initialCapacity(initialCapacity_) {}
+
+UniformArena::~UniformArena() {
+    assert(std::ranges::all_of(blocks, [](const auto& list) {
+        return std::ranges::all_of(list, [](const Block* block) { return block == nullptr; });
+    }));
+}
+
+void UniformArena::beginFrame() {
+    MLN_TRACE_FUNC();
+
+    flush();
+
+    frameNumber++;
+    currentRegion = (currentRegion + 1) % frameCount;
+    waitForRegion(currentRegion);
+    cursor = 0;
+    flushed = 0;
+
+    // Blocks not written since the region was last used would be overwritten. They weren't
+    // written for as long as there are frames in flight, so move them where they can stay.
+    auto carried = std::move(blocks[currentRegion]);
+    blocks[currentRegion].clear();
+    for (Block* block : carried) {
+        if (block) {
+            makeStable(*block);
+        }
+    }
+    flush();
+}
+
+void UniformArena::endFrame() {
+    MLN_TRACE_FUNC();
+
+    flush();
+    fenceRegion(currentRegion);
+}
+
+void UniformArena::flush() {
+    if (cursor == flushed && pendingStable.empty()) {
+        return;
+    }
+    MLN_TRACE_FUNC();
+
+    if (cursor > capacity || stableEnd > stableCapacity) {
+        // The new buffer holds none of the regions, move every block into the current one
+        std::vector<Block*> live;
+        for (std::size_t region = 0; region < frameCount; ++region) {
+            auto& list = blocks[region];
+            std::ranges::copy_if(list, std::back_inserter(live), [](const Block* block) { return block != nullptr; });
+            list.clear();
+        }
+        cursor = 0;
+        flushed = 0;
+        staging.clear();
+        for (Block* block : live) {
+            append(*block);
+        }
+
+        // Lay out the stable area again, without the ranges waiting to be reused
+        stableFree.clear();
+        stableEnd = 0;
+        for (Block* block : blocks[stableRegion]) {
+            block->offset = stableEnd;
+            stableEnd += alignedSize(block->contents.size());
+        }
+        pendingStable = blocks[stableRegion];
+
+        auto newCapacity = std::max({capacity, initialCapacity, alignment});
+        while (newCapacity < cursor) {
+            newCapacity *= 2;
+        }
+        capacity = newCapacity;
+
+        if (stableEnd > stableCapacity) {
+            auto newStableCapacity = std::max({stableCapacity, initialCapacity, alignment});
+            while (newStableCapacity < stableEnd) {
+                newStableCapacity *= 2;
+            }
+            stableCapacity = newStableCapacity;
+        }
+        resize(capacity, stableCapacity);
+    }
+
+    if (cursor > flushed) {
+        upload(currentRegion, flushed, staging.data(), staging.size());
+        flushed = cursor;
+        staging.clear();
+    }
+
+    for (const Block* block : pendingStable) {
+        upload(stableRegion, block->offset, block->contents.data(), block->contents.size());
+    }
+    pendingStable.clear();
+}
+
+void UniformArena::append(Block& block) {
+    const auto offset = cursor;
+    const auto size = block.contents.size();
+
+    // Offsets in the staging data are relative to the part already uploaded
+    staging.resize(cursor + alignedSize(size) - flushed);
+    if (size > 0) {
+        std::memcpy(staging.data() + (offset - flushed), block.contents.data(), size);
+    }
+    cursor += alignedSize(size);
+
+    block.region = currentRegion;
+    block.offset = offset;
+    block.slot = blocks[currentRegion].size();
+    blocks[currentRegion].push_back(&block);
+}
+
+void UniformArena::makeStable(Block& block) {
+    const auto size = alignedSize(block.contents.size());
+
+    // Reuse a range that no frame in flight binds anymore, or extend the area
+    std::size_t offset = stableEnd;
+    const auto free = stableFree.find(size);
+    if (free != stableFree.end() && free->second.front().frame + frameCount <= frameNumber) {
+        offset = free->second.front().offset;
+        free->second.pop_front();
+        if (free->second.empty()) {
+            stableFree.erase(free);
+        }
+    } else {
+        stableEnd += size;
+    }
+
+    block.region = stableRegion;
+    block.offset = offset;
+    block.slot = blocks[stableRegion].size();
+    blocks[stableRegion].push_back(&block);
+    pendingStable.push_back(&block);
+}
+
+void UniformArena::remove(const Block& block) {
+    auto& list = blocks[block.region];
+    assert(list[block.slot] == &block);
+    if (block.region != stableRegion) {
+        list[block.slot] = nullptr;
+        return;
+    }
+
+    // Frames in flight may still bind the range
+    stableFree[alignedSize(block.contents.size())].push_back({block.offset, frameNumber});
+
+    Block* last = list.back();
+    list[block.slot] = last;
+    last->slot = block.slot;
+    list.pop_back();
+}
+
+} // namespace gfx
+} // namespace mbgl
@@ -0,0 +1,137 @@
+#pragma once
+
+#include <mbgl/util/noncopyable.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <vector>
+
+namespace mbgl {
+namespace gfx {
+
+/// Streams uniform data into one buffer split into a region for each frame in flight, instead of
+/// a buffer object for every drawable. Writes are appended to the region of the current frame and
+/// bound with their offset into the buffer. A region is written again once the GPU finished the
+/// frame that last used it, which the backend waits for.
+///
+/// The blocks still living in a region then haven't been written for `frameCount` frames. They
+/// move to a stable area after the regions, where they stay without being uploaded again until
+/// they're written or destroyed. Space they leave there is reused once no frame in flight can
+/// read from it anymore.
+///
+/// Backends implement the buffer, uploads and synchronization with the virtual methods.
+class UniformArena : private util::noncopyable {
+public:
+    static constexpr std::size_t frameCount = 3;
+
+    /// Uniform data allocated from the arena, which keeps a copy of the contents
+    class Block {
+    public:
+        Block(UniformArena&, const void* data, std::size_t size);
+        Block(const Block&);
+        Block(Block&&) noexcept;
+        Block& operator=(const Block&) = delete;
+        Block& operator=(Block&&) = delete;
+        ~Block();
+
+        /// Replaces the first `size` bytes of the contents and appends them to the current region,
+        /// previously bound offsets stay valid for the draw calls already made with them.
+        void write(const void* data, std::size_t size);
+
+        const std::vector<uint8_t>& getContents() const { return contents; }
+        std::size_t getSize() const { return contents.size(); }
+
+        /// Offset of the contents in the arena's buffer. Uploads pending writes first, which may
+        /// replace the buffer, so the buffer must be queried after this.
+        std::size_t getBindingOffset() const;
+
+    private:
+        friend class UniformArena;
+
+        static constexpr std::size_t noSlot = static_cast<std::size_t>(-1);
+
+        UniformArena& arena;
+        std::vector<uint8_t> contents;
+        std::size_t region = 0;
+        std::size_t offset = 0;
+        // Index in the list of blocks of the region
+        std::size_t slot = 0;
+    };
+
+    /// `alignment` of offsets the backend can bind, `initialCapacity` of each region in bytes
+    UniformArena(std::size_t alignment, std::size_t initialCapacity);
+    virtual ~UniformArena();
+
+    /// Moves on to the region of the next frame, waiting until the GPU no longer reads from it
+    void beginFrame();
+    /// Marks the region of the current frame as used by the commands submitted for it
+    void endFrame();
+
+    /// Uploads the writes made since the last flush, growing the buffer if the region ran out of
+    /// space. Done before binding blocks.
+    void flush();
+
+    std::size_t getCapacity() const { return capacity; }
+    std::size_t getAlignment() const { return alignment; }
+    std::size_t getCurrentRegion() const { return currentRegion; }
+    /// Bytes written to the current region
+    std::size_t getUsedBytes() const { return cursor; }
+    /// Size of the stable area, and the part of it holding blocks or waiting to be reused
+    std::size_t getStableCapacity() const { return stableCapacity; }
+    std::size_t getStableUsedBytes() const { return stableEnd; }
+
+protected:
+    /// Blocks until the GPU finished the frame that last used the region
+    virtual void waitForRegion(std::size_t region) = 0;
+    /// Records that the commands submitted since the region was last waited for read from it
+    virtual void fenceRegion(std::size_t region) = 0;
+    /// Replaces the buffer with one holding `frameCount` regions of `newCapacity` bytes each,
+    /// followed by `stableSize` bytes of stable area. The contents don't need to be preserved, the
+    /// current region and the stable area are uploaded again right after.
+    virtual void resize(std::size_t newCapacity, std::size_t stableSize) = 0;
+    /// Copies data into the buffer at `offset` bytes from the start of the region. The stable area
+    /// is uploaded as region `frameCount`.
+    virtual void upload(std::size_t region, std::size_t offset, const void* data, std::size_t size) = 0;
+
+private:
+    static constexpr std::size_t stableRegion = frameCount;
+
+    std::size_t alignedSize(std::size_t size) const { return (size + alignment - 1) / alignment * alignment; }
+    void append(Block&);
+    void makeStable(Block&);
+    void remove(const Block&);
+
+    const std::size_t alignment;
+    const std::size_t initialCapacity;
+    std::size_t capacity = 0;
+    std::size_t currentRegion = 0;
+    // End of the data written to the current region, and of the part of it already uploaded
+    std::size_t cursor = 0;
+    std::size_t flushed = 0;
+    // Data written to the current region since the last flush
+    std::vector<uint8_t> staging;
+    // Blocks with their contents in each region, destroyed or rewritten ones are left null. The
+    // last list is the stable area, which is kept compact instead.
+    std::array<std::vector<Block*>, frameCount + 1> blocks;
+
+    // Frames begun so far
+    std::size_t frameNumber = 0;
+    std::size_t stableCapacity = 0;
+    // End of the allocated part of the stable area
+    std::size_t stableEnd = 0;
+    struct FreeRange {
+        std::size_t offset;
+        // Frame in which the range was last bound, at the latest
+        std::size_t frame;
+    };
+    // Ranges of the stable area left by blocks, by size, oldest first
+    std::map<std::size_t, std::deque<FreeRange>> stableFree;
+    // Blocks made stable since the last flush, only ever pending within `beginFrame`
+    std::vector<Block*> pendingStable;
+};
+
+} // namespace gfx
+} // namespace mbgl
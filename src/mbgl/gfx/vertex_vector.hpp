@@ -3,6 +3,8 @@
 #include <mbgl/util/ignore.hpp>
 #include <mbgl/util/monotonic_timer.hpp>
 
+#include <algorithm>
+#include <cassert>
 #include <memory>
 #include <vector>
 
@@ -20,7 +22,9 @@ public:
     VertexVectorBase(VertexVectorBase&& other)
         : buffer(std::move(other.buffer)),
           dirty(other.dirty),
-          released(other.released) {}
+          released(other.released),
+          modifiedRanges(std::move(other.modifiedRanges)),
+          fullyModified(other.fullyModified) {}
     virtual ~VertexVectorBase() = default;
 
     virtual const void* getRawData() const = 0;
@@ -37,17 +41,73 @@ public:
         if (dirty || force) {
             lastModified = util::MonotonicTimer::now();
             dirty = false;
+            fullyModified = true;
+            modifiedRanges.clear();
         }
     }
 
+    /// A range of bytes in the raw data, `[begin, end)`
+    struct Range {
+        std::size_t begin;
+        std::size_t end;
+    };
+
+    /// Marks only the bytes in `[begin, end)` as modified, so that the next upload can be limited
+    /// to the modified ranges unless the whole vector was modified since the last one.
+    void updateModifiedRange(std::size_t begin, std::size_t end) {
+        if (dirty) {
+            updateModified();
+            return;
+        }
+        if (begin >= end) {
+            return;
+        }
+        lastModified = util::MonotonicTimer::now();
+        if (fullyModified) {
+            return;
+        }
+        for (auto& range : modifiedRanges) {
+            if (begin <= range.end && range.begin <= end) {
+                range = {.begin = std::min(begin, range.begin), .end = std::max(end, range.end)};
+                return;
+            }
+        }
+        if (modifiedRanges.size() < maxModifiedRanges) {
+            modifiedRanges.push_back({.begin = begin, .end = end});
+            return;
+        }
+        // Too many ranges to upload one by one, use a single one covering all of them instead
+        for (const auto& range : modifiedRanges) {
+            begin = std::min(begin, range.begin);
+            end = std::max(end, range.end);
+        }
+        modifiedRanges.assign(1, {.begin = begin, .end = end});
+    }
+
+    /// Byte ranges modified since the last upload, or empty if the whole vector needs uploading.
+    const std::vector<Range>& getModifiedRanges() const { return fullyModified ? noRanges : modifiedRanges; }
+
+    /// Called by the upload pass once the modifications have been uploaded.
+    void resetModifiedRanges() {
+        fullyModified = false;
+        modifiedRanges.clear();
+    }
+
     // Indicates that the owner/producer will not modify this again
     bool isReleased() const { return released; }
 
 protected:
+    static constexpr std::size_t maxModifiedRanges = 16;
+    static inline const std::vector<Range> noRanges{};
+
     std::unique_ptr<VertexBufferBase> buffer;
     bool dirty = true;
     bool released = false;
 
+    std::vector<Range> modifiedRanges;
+    // Set until the first upload and whenever the vector is modified without a range
+    bool fullyModified = true;
+
     std::chrono::duration<double> lastModified = util::MonotonicTimer::now();
 };
 using VertexVectorBasePtr = std::shared_ptr<VertexVectorBase>;
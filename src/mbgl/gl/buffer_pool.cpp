@@ -0,0 +1,169 @@
+#include <mbgl/gl/buffer_pool.hpp>
+#include <mbgl/gl/context.hpp>
+#include <mbgl/gl/defines.hpp>
+#include <mbgl/gl/fence.hpp>
+#include <mbgl/util/instrumentation.hpp>
+
+#include <cassert>
+#include <iterator>
+
+namespace mbgl {
+namespace gl {
+
+using namespace platform;
+
+namespace {
+
+std::size_t align(std::size_t size) {
+    return (size + BufferPool::alignment - 1) / BufferPool::alignment * BufferPool::alignment;
+}
+
+} // namespace
+
+BufferPool::Allocation::~Allocation() {
+    if (pool) {
+        pool->release(*page, offset, size);
+    }
+}
+
+BufferPool::BufferPool(Context& context_, Target target_)
+    : context(context_),
+      target(target_) {}
+
+BufferPool::~BufferPool() {
+    const auto count = static_cast<int>(pages.size());
+    auto& stats = context.renderingStats();
+    stats.numBufferPages -= count;
+    stats.memBufferPages -= count * static_cast<int>(pageSize);
+    stats.memBuffers -= count * static_cast<int>(pageSize);
+}
+
+std::optional<BufferPool::Allocation> BufferPool::allocate(const void* data, std::size_t size) {
+    MLN_TRACE_FUNC();
+
+    if (size == 0 || size > maxAllocationSize) {
+        return std::nullopt;
+    }
+    const std::size_t alignedSize = align(size);
+
+    // First fit, preferring the pages created first so that later ones are more likely to empty out
+    Page* page = nullptr;
+    std::size_t offset = 0;
+    for (const auto& candidate : pages) {
+        for (const auto& [regionOffset, regionSize] : candidate->freeRegions) {
+            if (regionSize >= alignedSize) {
+                page = candidate.get();
+                offset = regionOffset;
+                break;
+            }
+        }
+        if (page) {
+            break;
+        }
+    }
+
+    if (!page) {
+        BufferID id = 0;
+        MBGL_CHECK_ERROR(glGenBuffers(1, &id));
+        // NOLINTNEXTLINE(performance-move-const-arg)
+        UniqueBuffer buffer{std::move(id), {context}};
+        bind(buffer.get());
+        MBGL_CHECK_ERROR(glBufferData(target == Target::Vertex ? GL_ARRAY_BUFFER : GL_ELEMENT_ARRAY_BUFFER,
+                                      pageSize,
+                                      nullptr,
+                                      GL_STATIC_DRAW));
+        pages.push_back(std::make_unique<Page>(Page{.buffer = std::move(buffer), .freeRegions = {{0, pageSize}}}));
+        page = pages.back().get();
+        offset = 0;
+
+        auto& stats = context.renderingStats();
+        stats.numBufferPages++;
+        stats.memBufferPages += static_cast<int>(pageSize);
+        stats.numBuffers++;
+        stats.totalBuffers++;
+        stats.memBuffers += static_cast<int>(pageSize);
+    }
+
+    // Take the allocation from the start of the region
+    const auto region = page->freeRegions.find(offset);
+    const std::size_t remaining = region->second - alignedSize;
+    page->freeRegions.erase(region);
+    if (remaining > 0) {
+        page->freeRegions.emplace(offset + alignedSize, remaining);
+    }
+    page->usedBytes += alignedSize;
+
+    bind(page->buffer.get());
+    MBGL_CHECK_ERROR(glBufferSubData(target == Target::Vertex ? GL_ARRAY_BUFFER : GL_ELEMENT_ARRAY_BUFFER,
+                                     static_cast<GLintptr>(offset),
+                                     static_cast<GLsizeiptr>(size),
+                                     data));
+
+    context.renderingStats().numPooledBuffers++;
+    return Allocation{*this, *page, offset, alignedSize};
+}
+
+void BufferPool::defragment() {
+    MLN_TRACE_FUNC();
+
+    std::erase_if(pendingRegions, [&](const PendingRegion& region) {
+        if (region.fence && !region.fence->isSignaled()) {
+            return false;
+        }
+        reclaim(*region.page, region.offset, region.size);
+        return true;
+    });
+
+    std::size_t emptyPages = 0;
+    auto& stats = context.renderingStats();
+    std::erase_if(pages, [&](const std::unique_ptr<Page>& page) {
+        if (page->usedBytes != 0 || ++emptyPages <= maxEmptyPages) {
+            return false;
+        }
+        stats.numBufferPages--;
+        stats.memBufferPages -= static_cast<int>(pageSize);
+        stats.memBuffers -= static_cast<int>(pageSize);
+        return true;
+    });
+}
+
+void BufferPool::release(Page& page, std::size_t offset, std::size_t size) {
+    context.renderingStats().numPooledBuffers--;
+
+    // Draw calls of frames still in flight may read the region, keep it until they're done
+    pendingRegions.push_back({.page = &page, .offset = offset, .size = size, .fence = context.getCurrentFrameFence()});
+}
+
+void BufferPool::reclaim(Page& page, std::size_t offset, std::size_t size) {
+    assert(page.usedBytes >= size);
+    page.usedBytes -= size;
+
+    auto next = page.freeRegions.lower_bound(offset);
+    // Merge with the free region that follows
+    if (next != page.freeRegions.end() && offset + size == next->first) {
+        size += next->second;
+        next = page.freeRegions.erase(next);
+    }
+    // And with the one that precedes it
+    if (next != page.freeRegions.begin()) {
+        const auto previous = std::prev(next);
+        if (previous->first + previous->second == offset) {
+            previous->second += size;
+            return;
+        }
+    }
+    page.freeRegions.emplace_hint(next, offset, size);
+}
+
+void BufferPool::bind(BufferID id) {
+    if (target == Target::Vertex) {
+        context.vertexBuffer = id;
+    } else {
+        // Don't change the index buffer of another vertex array object
+        context.bindVertexArray = 0;
+        context.globalVertexArrayState.indexBuffer = id;
+    }
+}
+
+} // namespace gl
+} // namespace mbgl
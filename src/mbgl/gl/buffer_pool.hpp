@@ -0,0 +1,109 @@
+#pragma once
+
+#include <mbgl/gl/object.hpp>
+#include <mbgl/util/noncopyable.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace mbgl {
+namespace gl {
+
+class Context;
+class Fence;
+
+/// Sub-allocates vertex or index data from a few large buffers, so that drawables don't need a
+/// buffer object each. Allocations never move once made, as vertex array objects capture their
+/// offsets. Instead, the regions they release are merged with adjacent free ones, and buffers
+/// left empty, e.g. after tiles were evicted, are deleted by `defragment()`.
+class BufferPool : private util::noncopyable {
+public:
+    enum class Target : uint8_t {
+        Vertex,
+        Index
+    };
+
+    /// Size of the buffers allocations are made from
+    static constexpr std::size_t pageSize = 4 * 1024 * 1024;
+    /// Data larger than this gets a buffer of its own
+    static constexpr std::size_t maxAllocationSize = pageSize / 8;
+    /// Offsets are aligned for any vertex attribute or index type
+    static constexpr std::size_t alignment = 16;
+    /// Empty pages kept for future allocations when defragmenting
+    static constexpr std::size_t maxEmptyPages = 1;
+
+private:
+    struct Page {
+        UniqueBuffer buffer;
+        // Sizes of the free regions, by offset
+        std::map<std::size_t, std::size_t> freeRegions;
+        // Bytes allocated or released but possibly still in use by the GPU
+        std::size_t usedBytes = 0;
+    };
+
+public:
+    /// A region of one of the pool's buffers, released when destroyed.
+    class Allocation {
+    public:
+        Allocation(BufferPool& pool_, Page& page_, std::size_t offset_, std::size_t size_)
+            : pool(&pool_),
+              page(&page_),
+              offset(offset_),
+              size(size_) {}
+        Allocation(Allocation&& other) noexcept
+            : pool(std::exchange(other.pool, nullptr)),
+              page(other.page),
+              offset(other.offset),
+              size(other.size) {}
+        Allocation& operator=(Allocation&&) = delete;
+        Allocation(const Allocation&) = delete;
+        ~Allocation();
+
+        BufferID getBuffer() const { return page->buffer.get(); }
+        std::size_t getOffset() const { return offset; }
+
+    private:
+        BufferPool* pool;
+        Page* page;
+        std::size_t offset;
+        std::size_t size;
+    };
+
+    BufferPool(Context&, Target);
+    ~BufferPool();
+
+    /// Copies `data` into a free region of one of the buffers, creating a new one if none fits.
+    /// Returns nothing if `size` exceeds `maxAllocationSize`.
+    std::optional<Allocation> allocate(const void* data, std::size_t size);
+
+    /// Makes the regions released before the GPU finished with them available again, and
+    /// deletes the buffers left empty beyond `maxEmptyPages`.
+    void defragment();
+
+private:
+    void release(Page&, std::size_t offset, std::size_t size);
+    // Makes a released region available for allocations again
+    void reclaim(Page&, std::size_t offset, std::size_t size);
+    void bind(BufferID);
+
+    struct PendingRegion {
+        Page* page;
+        std::size_t offset;
+        std::size_t size;
+        std::shared_ptr<Fence> fence;
+    };
+
+    Context& context;
+    const Target target;
+    std::vector<std::unique_ptr<Page>> pages;
+    // Released regions that may still be read by frames in flight
+    std::vector<PendingRegion> pendingRegions;
+};
+
+} // namespace gl
+} // namespace mbgl
@@ -1,6 +1,8 @@
 #include <mbgl/gl/context.hpp>
 
+#include <mbgl/gfx/shader_binary_cache.hpp>
 #include <mbgl/gfx/shader_registry.hpp>
+#include <mbgl/gl/buffer_pool.hpp>
 #include <mbgl/gl/command_encoder.hpp>
 #include <mbgl/gl/defines.hpp>
 #include <mbgl/gl/draw_scope_resource.hpp>
@@ -28,6 +30,7 @@
 
 #include <cstring>
 #include <iterator>
+#include <string_view>
 
 namespace mbgl {
 namespace gl {
@@ -92,7 +95,10 @@ constexpr size_t renderBufferByteSize(const gfx::RenderbufferPixelType type, con
 Context::Context(RendererBackend& backend_)
     : gfx::Context(/*maximumVertexBindingCount=*/getMaxVertexAttribs()),
       backend(backend_) {
-    uboAllocator = std::make_unique<gl::UniformBufferAllocator>();
+    uniformArena = std::make_unique<UniformArenaGL>(*this);
+    vertexBufferPool = std::make_unique<BufferPool>(*this, BufferPool::Target::Vertex);
+    indexBufferPool = std::make_unique<BufferPool>(*this, BufferPool::Target::Index);
+    readbackQueue = std::make_unique<ReadbackQueue>(*this);
 
     texturePool = std::make_unique<Texture2DPool>(this);
 }
@@ -107,11 +113,23 @@ Context::~Context() noexcept {
             globalUniformBuffers.set(i, nullptr);
         }
 
+        // Hand over the images still being read
+        readbackQueue->process(/*wait=*/true);
+
+        // Abandon the pooled buffers so that `reset()` deletes them
+        vertexBufferPool.reset();
+        indexBufferPool.reset();
+        uniformArena.reset();
+        readbackQueue.reset();
+
         reset();
 
+        if (shaderBinaryCache) {
+            shaderBinaryCache->save();
+        }
+
         // Delete all pooled resources while the context is still valid
         texturePool.reset();
-        uboAllocator.reset();
 
 #if !defined(NDEBUG)
         Log::Debug(Event::General, "Rendering Stats:\n" + stats.toString("\n"));
@@ -125,13 +143,18 @@ void Context::beginFrame() {
 
     backend.getThreadPool().runRenderJobs();
 
+    // Hand over the images of previous frames the GPU is done with
+    readbackQueue->process(/*wait=*/false);
+
     frameInFlightFence = std::make_shared<gl::Fence>();
+    uniformArena->beginFrame();
 
     // Run allocator defragmentation on this frame interval.
     constexpr auto defragFreq = 4;
 
     if (frameNum == defragFreq) {
-        uboAllocator->defragment(frameInFlightFence);
+        vertexBufferPool->defragment();
+        indexBufferPool->defragment();
         frameNum = 0;
     } else {
         frameNum++;
@@ -145,6 +168,7 @@ void Context::endFrame() {
         return;
     }
 
+    uniformArena->endFrame();
     frameInFlightFence->insert();
 }
 
@@ -180,6 +204,9 @@ void Context::initializeExtensions(const std::function<gl::ProcAddress(const cha
 #endif
     }
     MLN_TRACE_GL_CONTEXT();
+
+    // Start reading the stored program binaries while the first frame is prepared
+    (void)getShaderBinaryCache();
 }
 
 void Context::enableDebugging() {
@@ -242,6 +269,89 @@ UniqueProgram Context::createProgram(ShaderID vertexShader, ShaderID fragmentSha
     return result;
 }
 
+UniqueProgram Context::createProgram(const std::initializer_list<const char*>& vertexSources,
+                                     const std::initializer_list<const char*>& fragmentSources,
+                                     const char* location0AttribName) {
+    MLN_TRACE_FUNC();
+
+    auto* cache = getShaderBinaryCache();
+    if (!cache) {
+        return createProgram(createShader(ShaderType::Vertex, vertexSources),
+                             createShader(ShaderType::Fragment, fragmentSources),
+                             location0AttribName);
+    }
+
+    std::vector<std::string_view> sources(vertexSources.begin(), vertexSources.end());
+    sources.emplace_back(location0AttribName);
+    sources.insert(sources.end(), fragmentSources.begin(), fragmentSources.end());
+    const auto key = gfx::ShaderBinaryCache::hash(sources);
+
+    // The binary is stored after its format
+    if (const auto binary = cache->get(key); binary && binary->size() > sizeof(GLenum)) {
+        GLenum format = 0;
+        std::memcpy(&format, binary->data(), sizeof(format));
+
+        UniqueProgram result{MBGL_CHECK_ERROR(glCreateProgram()), {this}};
+        MBGL_CHECK_ERROR(glProgramBinary(result,
+                                         format,
+                                         binary->data() + sizeof(format),
+                                         static_cast<GLsizei>(binary->size() - sizeof(format))));
+        GLint status = GL_FALSE;
+        MBGL_CHECK_ERROR(glGetProgramiv(result, GL_LINK_STATUS, &status));
+        if (status == GL_TRUE) {
+            return result;
+        }
+
+        // Drivers reject binaries of an older version, it's compiled again and replaced
+        cache->remove(key);
+    }
+
+    auto vertexShader = createShader(ShaderType::Vertex, vertexSources);
+    auto fragmentShader = createShader(ShaderType::Fragment, fragmentSources);
+
+    UniqueProgram result{MBGL_CHECK_ERROR(glCreateProgram()), {this}};
+    MBGL_CHECK_ERROR(glProgramParameteri(result, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE));
+    MBGL_CHECK_ERROR(glAttachShader(result, vertexShader));
+    MBGL_CHECK_ERROR(glAttachShader(result, fragmentShader));
+    MBGL_CHECK_ERROR(glBindAttribLocation(result, 0, location0AttribName));
+    linkProgram(result);
+
+    GLint length = 0;
+    MBGL_CHECK_ERROR(glGetProgramiv(result, GL_PROGRAM_BINARY_LENGTH, &length));
+    if (length > 0) {
+        std::string binary(sizeof(GLenum) + static_cast<std::size_t>(length), '\0');
+        GLenum format = 0;
+        MBGL_CHECK_ERROR(glGetProgramBinary(result, length, &length, &format, binary.data() + sizeof(format)));
+        std::memcpy(binary.data(), &format, sizeof(format));
+        binary.resize(sizeof(format) + static_cast<std::size_t>(length));
+        cache->put(key, std::move(binary));
+    }
+
+    return result;
+}
+
+gfx::ShaderBinaryCache* Context::getShaderBinaryCache() {
+    if (!shaderBinaryCacheChecked) {
+        shaderBinaryCacheChecked = true;
+
+        GLint formats = 0;
+        MBGL_CHECK_ERROR(glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats));
+        if (!backend.getShaderCacheDirectory().empty() && formats > 0) {
+            // Binaries are only valid for the driver that created them
+            std::string driverID;
+            for (const GLenum name : {GL_VENDOR, GL_RENDERER, GL_VERSION}) {
+                if (const auto* value = reinterpret_cast<const char*>(MBGL_CHECK_ERROR(glGetString(name)))) {
+                    driverID.append(value);
+                }
+                driverID.push_back('\n');
+            }
+            shaderBinaryCache = std::make_unique<gfx::ShaderBinaryCache>(backend.getShaderCacheDirectory(),
+                                                                         std::move(driverID));
+        }
+    }
+    return shaderBinaryCache.get();
+}
+
 void Context::linkProgram(ProgramID program_) {
     MLN_TRACE_FUNC();
 
@@ -348,6 +458,10 @@ std::unique_ptr<uint8_t[]> Context::readFramebuffer(const Size size,
     return data;
 }
 
+void Context::processReadbacks(bool wait) {
+    readbackQueue->process(wait);
+}
+
 namespace {
 
 void checkFramebuffer() {
@@ -546,7 +660,7 @@ gfx::UniformBufferPtr Context::createUniformBuffer(const void* data,
                                                    bool /*ssbo*/) {
     MLN_TRACE_FUNC();
 
-    return std::make_shared<gl::UniformBufferGL>(*this, data, size, *uboAllocator);
+    return std::make_shared<gl::UniformBufferGL>(*this, data, size, *uniformArena);
 }
 
 gfx::UniqueUniformBufferArray Context::createLayerUniformBufferArray() {
@@ -638,6 +752,9 @@ void Context::clear(std::optional<mbgl::Color> color, std::optional<float> depth
     MBGL_CHECK_ERROR(glClear(mask));
 
     stats.numDrawCalls = 0;
+    stats.numVertexArrayBinds = 0;
+    stats.numProgramBinds = 0;
+    stats.numTextureBinds = 0;
     stats.numFrames++;
 }
 
@@ -17,15 +17,20 @@
 #include <mbgl/util/noncopyable.hpp>
 
 #include <mbgl/gl/fence.hpp>
-#include <mbgl/gl/buffer_allocator.hpp>
+#include <mbgl/gl/uniform_arena_gl.hpp>
 #include <mbgl/gfx/texture2d.hpp>
 #include <mbgl/gl/uniform_buffer_gl.hpp>
+#include <mbgl/gl/readback_queue.hpp>
 
 #include <array>
 #include <functional>
 #include <vector>
 
 namespace mbgl {
+namespace gfx {
+class ShaderBinaryCache;
+} // namespace gfx
+
 namespace gl {
 
 using ProcAddress = void (*)();
@@ -33,6 +38,7 @@ class RendererBackend;
 
 namespace extension {
 class VertexArray;
+class BufferPool;
 class Debugging;
 } // namespace extension
 
@@ -56,6 +62,11 @@ public:
 
     UniqueShader createShader(ShaderType type, const std::initializer_list<const char*>& sources);
     UniqueProgram createProgram(ShaderID vertexShader, ShaderID fragmentShader, const char* location0AttribName);
+    /// Compiles and links a program from sources, or loads it from the backend's shader cache
+    /// when it was linked in an earlier run
+    UniqueProgram createProgram(const std::initializer_list<const char*>& vertexSources,
+                                const std::initializer_list<const char*>& fragmentSources,
+                                const char* location0AttribName);
     void verifyProgramLinkage(ProgramID);
     void linkProgram(ProgramID);
     UniqueTexture createUniqueTexture(const Size& size, gfx::TexturePixelType format, gfx::TextureChannelDataType type);
@@ -72,6 +83,22 @@ public:
         return {size, readFramebuffer(size, format, flip)};
     }
 
+    /// Reads the bound framebuffer like `readFramebuffer`, without waiting for the GPU to finish
+    /// rendering. `callback` gets the image from `processReadbacks()` or the start of a later frame.
+    template <typename Image,
+              gfx::TexturePixelType format = Image::channels == 4 ? gfx::TexturePixelType::RGBA
+                                                                  : gfx::TexturePixelType::Alpha>
+    void readFramebufferAsync(const Size size, std::function<void(Image)> callback, bool flip = true) {
+        static_assert(Image::channels == (format == gfx::TexturePixelType::RGBA ? 4 : 1), "image format mismatch");
+        readbackQueue->read(
+            size, format, flip, [size, callback_ = std::move(callback)](std::unique_ptr<uint8_t[]> data) {
+                callback_(Image{size, std::move(data)});
+            });
+    }
+
+    /// Calls the callbacks of the asynchronous reads the GPU has completed, or waits for all of them.
+    void processReadbacks(bool wait = false);
+
     void clear(std::optional<mbgl::Color> color, std::optional<float> depth, std::optional<int32_t> stencil);
 
     void setDepthMode(const gfx::DepthMode&);
@@ -158,6 +185,9 @@ public:
     void setDirtyState() override;
 
     Texture2DPool& getTexturePool();
+    BufferPool& getVertexBufferPool() { return *vertexBufferPool; }
+    BufferPool& getIndexBufferPool() { return *indexBufferPool; }
+    UniformArenaGL& getUniformArena() { return *uniformArena; }
 
 private:
     RendererBackend& backend;
@@ -165,10 +195,14 @@ private:
 
     std::unique_ptr<extension::Debugging> debugging;
     std::shared_ptr<gl::Fence> frameInFlightFence;
-    std::unique_ptr<gl::UniformBufferAllocator> uboAllocator;
+    std::unique_ptr<UniformArenaGL> uniformArena;
     size_t frameNum = 0;
     UniformBufferArrayGL globalUniformBuffers;
 
+    gfx::ShaderBinaryCache* getShaderBinaryCache();
+    std::unique_ptr<gfx::ShaderBinaryCache> shaderBinaryCache;
+    bool shaderBinaryCacheChecked = false;
+
 public:
     State<value::ActiveTextureUnit> activeTextureUnit;
     State<value::BindFramebuffer> bindFramebuffer;
@@ -242,6 +276,10 @@ private:
     std::vector<RenderbufferID> abandonedRenderbuffers;
 
     std::unique_ptr<Texture2DPool> texturePool;
+    // Declared after the lists of abandoned objects, as destroying these abandons their buffers
+    std::unique_ptr<BufferPool> vertexBufferPool;
+    std::unique_ptr<BufferPool> indexBufferPool;
+    std::unique_ptr<ReadbackQueue> readbackQueue;
 
 public:
 #if !defined(NDEBUG)
@@ -0,0 +1,48 @@
+#include <mbgl/gl/draw_list.hpp>
+
+#include <mbgl/gl/drawable_gl.hpp>
+#include <mbgl/util/hash.hpp>
+#include <mbgl/util/instrumentation.hpp>
+
+#include <algorithm>
+#include <tuple>
+
+namespace mbgl {
+namespace gl {
+
+void DrawList::clear() {
+    entries.clear();
+    tileCounts.clear();
+}
+
+void DrawList::add(DrawableGL& drawable) {
+    std::size_t tileIndex = 0;
+    if (const auto& tileID = drawable.getTileID()) {
+        tileIndex = tileCounts[*tileID]++;
+    }
+
+    std::size_t textures = 0;
+    for (std::size_t id = 0; id < shaders::maxTextureCountPerShader; id++) {
+        util::hash_combine(textures, drawable.getTexture(id).get());
+    }
+
+    entries.push_back({.drawable = &drawable,
+                       .priority = drawable.getDrawPriority(),
+                       .tileIndex = tileIndex,
+                       .shader = reinterpret_cast<std::uintptr_t>(drawable.getShader().get()),
+                       .textures = textures});
+}
+
+void DrawList::sort() {
+    MLN_TRACE_FUNC();
+
+    // The layer group's order is by priority, the index in the tile keeps the order within tiles.
+    // Drawables that are equal in all of these stay in the layer group's order.
+    std::stable_sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) {
+        return std::tie(a.priority, a.tileIndex, a.shader, a.textures) <
+               std::tie(b.priority, b.tileIndex, b.shader, b.textures);
+    });
+}
+
+} // namespace gl
+} // namespace mbgl
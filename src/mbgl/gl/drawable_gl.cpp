@@ -1,5 +1,6 @@
 #include <mbgl/gl/drawable_gl.hpp>
 #include <mbgl/gl/drawable_gl_impl.hpp>
+#include <mbgl/gl/index_buffer_resource.hpp>
 #include <mbgl/gl/texture2d.hpp>
 #include <mbgl/gl/upload_pass.hpp>
 #include <mbgl/gl/vertex_array.hpp>
@@ -10,6 +11,8 @@
 #include <mbgl/util/instrumentation.hpp>
 #include <mbgl/util/logging.hpp>
 
+#include <algorithm>
+
 namespace mbgl {
 namespace gl {
 
@@ -21,7 +24,21 @@ DrawableGL::~DrawableGL() {
     impl->attributeBuffers.clear();
 }
 
+struct IndexBufferGL : public gfx::IndexBufferBase {
+    IndexBufferGL(std::unique_ptr<gfx::IndexBuffer>&& buffer_)
+        : buffer(std::move(buffer_)) {}
+    ~IndexBufferGL() override = default;
+
+    std::unique_ptr<mbgl::gfx::IndexBuffer> buffer;
+};
+
 void DrawableGL::draw(PaintParameters& parameters) const {
+    Bindings bindings;
+    draw(parameters, bindings);
+    unbind(parameters, bindings);
+}
+
+void DrawableGL::draw(PaintParameters& parameters, Bindings& bindings) const {
     MLN_TRACE_FUNC();
 
     if (isCustom) {
@@ -30,13 +47,8 @@ void DrawableGL::draw(PaintParameters& parameters) const {
 
     auto& context = static_cast<gl::Context&>(parameters.context);
 
-    if (shader) {
-        const auto& shaderGL = static_cast<const ShaderProgramGL&>(*shader);
-        if (shaderGL.getGLProgramID() != context.program.getCurrentValue()) {
-            context.program = shaderGL.getGLProgramID();
-        }
-    }
-    if (!shader || context.program.getCurrentValue() == 0) {
+    const auto* previous = bindings.last;
+    if (!bindProgram(context)) {
         mbgl::Log::Warning(Event::General, "Missing shader for drawable " + util::toString(getID()) + "/" + getName());
         assert(false);
         return;
@@ -62,22 +74,64 @@ void DrawableGL::draw(PaintParameters& parameters) const {
 
     context.setScissorTest(parameters.scissorRect);
 
+    // The uniform buffers of the previous drawable are replaced rather than unbound
     impl->uniformBuffers.bind();
-    bindTextures();
+    for (std::size_t id = 0; id < impl->uniformBuffers.allocatedSize() && id < bindings.uniformBuffers.size(); id++) {
+        if (impl->uniformBuffers.get(id)) {
+            bindings.uniformBuffers.set(id);
+        }
+    }
+
+    // Sampler uniforms belong to the program, the textures can only be kept for the same one
+    const bool keepTextures = previous && previous->shader == shader;
+    bindings.textureUnits = std::max(bindings.textureUnits, bindTextures(context, keepTextures));
+    bindings.last = this;
+
+    // Index data may be sub-allocated from a shared buffer, the segment offsets are relative to its start
+    std::size_t indexBase = 0;
+    if (impl->indexes && impl->indexes->getBuffer()) {
+        const auto& indexBuffer = static_cast<const IndexBufferGL&>(*impl->indexes->getBuffer());
+        indexBase = indexBuffer.buffer->getResource<gl::IndexBufferResource>().getIndexOffset();
+    }
 
     for (const auto& seg : impl->segments) {
         const auto& glSeg = static_cast<DrawSegmentGL&>(*seg);
         const auto& mlSeg = glSeg.getSegment();
         if (mlSeg.indexLength > 0 && glSeg.getVertexArray().isValid()) {
-            context.bindVertexArray = glSeg.getVertexArray().getID();
-            context.draw(glSeg.getMode(), mlSeg.indexOffset, mlSeg.indexLength);
+            const auto vertexArrayID = glSeg.getVertexArray().getID();
+            if (context.bindVertexArray != vertexArrayID) {
+                context.bindVertexArray = vertexArrayID;
+                context.renderingStats().numVertexArrayBinds++;
+            }
+            context.draw(glSeg.getMode(), indexBase + mlSeg.indexOffset, mlSeg.indexLength);
         }
     }
+}
+
+void DrawableGL::unbind(PaintParameters& parameters, const Bindings& bindings) {
+    if (!bindings.last) {
+        return;
+    }
+
+    auto& context = static_cast<gl::Context&>(parameters.context);
+
     // Unbind the VAO so that future buffer commands outside Drawable do not change the current VAO state
     context.bindVertexArray = value::BindVertexArray::Default;
 
-    unbindTextures();
-    impl->uniformBuffers.unbind();
+    // Also clear the units that only drawables before the last one used
+    bindings.last->unbindTextures();
+    for (int32_t unit = 0; unit < bindings.textureUnits; unit++) {
+        if (context.texture[static_cast<std::size_t>(unit)].getCurrentValue() != 0) {
+            context.activeTextureUnit = static_cast<uint8_t>(unit);
+            context.texture[static_cast<std::size_t>(unit)] = 0;
+        }
+    }
+
+    for (std::size_t id = 0; id < bindings.uniformBuffers.size(); id++) {
+        if (bindings.uniformBuffers.test(id)) {
+            MBGL_CHECK_ERROR(glBindBufferBase(GL_UNIFORM_BUFFER, static_cast<GLuint>(id), 0));
+        }
+    }
 }
 
 void DrawableGL::setIndexData(gfx::IndexVectorBasePtr indexes, std::vector<UniqueDrawSegment> segments) {
@@ -133,14 +187,6 @@ void DrawableGL::setVertexAttrId(const size_t id) {
     impl->vertexAttrId = id;
 }
 
-struct IndexBufferGL : public gfx::IndexBufferBase {
-    IndexBufferGL(std::unique_ptr<gfx::IndexBuffer>&& buffer_)
-        : buffer(std::move(buffer_)) {}
-    ~IndexBufferGL() override = default;
-
-    std::unique_ptr<mbgl::gfx::IndexBuffer> buffer;
-};
-
 void DrawableGL::upload(gfx::UploadPass& uploadPass) {
     if (isCustom) {
         return;
@@ -261,15 +307,34 @@ void DrawableGL::uploadTextures() const {
     }
 }
 
-void DrawableGL::bindTextures() const {
+bool DrawableGL::bindProgram(gl::Context& context) const {
+    if (!shader) {
+        return false;
+    }
+    const auto programID = static_cast<const ShaderProgramGL&>(*shader).getGLProgramID();
+    if (programID != context.program.getCurrentValue()) {
+        context.program = programID;
+        context.renderingStats().numProgramBinds++;
+    }
+    return programID != 0;
+}
+
+int32_t DrawableGL::bindTextures(gl::Context& context, bool keepBound) const {
     int32_t unit = 0;
     for (size_t id = 0; id < textures.size(); id++) {
         if (const auto& texture = textures[id]) {
             if (const auto& location = shader->getSamplerLocation(id)) {
-                static_cast<gl::Texture2D&>(*texture).bind(static_cast<int32_t>(*location), unit++);
+                auto& textureGL = static_cast<gl::Texture2D&>(*texture);
+                const auto locationGL = static_cast<int32_t>(*location);
+                if (!keepBound || !textureGL.isBound(locationGL, unit)) {
+                    textureGL.bind(locationGL, unit);
+                    context.renderingStats().numTextureBinds++;
+                }
+                unit++;
             }
         }
     }
+    return unit;
 }
 
 void DrawableGL::unbindTextures() const {
@@ -12,13 +12,7 @@ DynamicTexture::DynamicTexture(Context& context, Size size, gfx::TexturePixelTyp
 
 void DynamicTexture::uploadImage(const uint8_t* pixelData, gfx::TextureHandle& texHandle) {
     std::scoped_lock lock(mutex);
-    const auto& rect = texHandle.getRectangle();
-    const auto imageSize = Size(rect.w, rect.h);
-
-    auto size = imageSize.area() * texture->getPixelStride();
-    auto imageData = std::make_unique<uint8_t[]>(size);
-    std::copy(pixelData, pixelData + size, imageData.get());
-    imagesToUpload.emplace(texHandle, std::move(imageData));
+    stageImage(pixelData, texHandle.getRectangle());
 
     gfx::DynamicTexture::uploadImage(pixelData, texHandle);
 }
@@ -29,20 +23,10 @@ void DynamicTexture::uploadDeferredImages() {
         texture->create();
         deferredCreation = false;
     }
-    for (const auto& pair : imagesToUpload) {
-        const auto& rect = pair.first.getRectangle();
-        texture->uploadSubRegion(pair.second.get(), Size(rect.w, rect.h), rect.x, rect.y);
-    }
-    imagesToUpload.clear();
-}
-
-bool DynamicTexture::removeTexture(const gfx::TextureHandle& texHandle) {
-    if (gfx::DynamicTexture::removeTexture(texHandle)) {
-        std::scoped_lock lock(mutex);
-        imagesToUpload.erase(texHandle);
-        return true;
+    // Images packed next to each other are uploaded together
+    for (const auto& [region, pixels] : takeStagedRegions()) {
+        texture->uploadSubRegion(pixels.data(), Size(region.w, region.h), region.x, region.y);
     }
-    return false;
 }
 
 } // namespace gl
@@ -13,6 +13,8 @@ public:
 
     void insert() noexcept;
     bool isSignaled() const;
+    /// Blocks until the commands before the fence completed, returns at once if it wasn't inserted
+    void wait() const;
 
 private:
     platform::GLsync fence{nullptr};
@@ -6,12 +6,13 @@ namespace mbgl {
 namespace gl {
 
 IndexBufferResource::IndexBufferResource(UniqueBuffer&& buffer_, int byteSize_)
-    : buffer(std::move(buffer_)),
-      byteSize(byteSize_) {
-    MLN_TRACE_ALLOC_INDEX_BUFFER(buffer.get(), byteSize);
+    : byteSize(byteSize_),
+      context(buffer_.get_deleter().context),
+      buffer(std::move(buffer_)) {
+    MLN_TRACE_ALLOC_INDEX_BUFFER(buffer->get(), byteSize);
 
-    if (buffer) {
-        auto& stats = buffer.get_deleter().context.renderingStats();
+    if (*buffer) {
+        auto& stats = context.renderingStats();
         stats.numIndexBuffers++;
         stats.memIndexBuffers += byteSize;
 
@@ -21,11 +22,28 @@ IndexBufferResource::IndexBufferResource(UniqueBuffer&& buffer_, int byteSize_)
     }
 }
 
+IndexBufferResource::IndexBufferResource(Context& context_, BufferPool::Allocation&& allocation_, int byteSize_)
+    : byteSize(byteSize_),
+      context(context_),
+      allocation(std::move(allocation_)) {
+    // The pool accounts for the memory of the buffer the data is in
+    auto& stats = context.renderingStats();
+    stats.numIndexBuffers++;
+    stats.memIndexBuffers += byteSize;
+}
+
 IndexBufferResource::~IndexBufferResource() noexcept {
-    MLN_TRACE_FREE_INDEX_BUFFER(buffer.get());
+    if (allocation) {
+        auto& stats = context.renderingStats();
+        stats.numIndexBuffers--;
+        stats.memIndexBuffers -= byteSize;
+        return;
+    }
+
+    MLN_TRACE_FREE_INDEX_BUFFER(buffer->get());
 
-    if (buffer) {
-        auto& stats = buffer.get_deleter().context.renderingStats();
+    if (*buffer) {
+        auto& stats = context.renderingStats();
         stats.numIndexBuffers--;
         stats.memIndexBuffers -= byteSize;
         stats.memBuffers -= byteSize;
@@ -1,18 +1,33 @@
 #pragma once
 
 #include <mbgl/gfx/index_buffer.hpp>
+#include <mbgl/gl/buffer_pool.hpp>
 #include <mbgl/gl/object.hpp>
 
+#include <cstdint>
+#include <optional>
+
 namespace mbgl {
 namespace gl {
 
 class IndexBufferResource : public gfx::IndexBufferResource {
 public:
     IndexBufferResource(UniqueBuffer&& buffer_, int byteSize_);
+    /// Data in a region of a pooled buffer
+    IndexBufferResource(Context&, BufferPool::Allocation&& allocation_, int byteSize_);
     ~IndexBufferResource() noexcept override;
 
-    UniqueBuffer buffer;
+    /// The buffer object holding the data, which is shared with other resources if pooled
+    BufferID getBuffer() const { return allocation ? allocation->getBuffer() : buffer->get(); }
+    /// Offset of the data in the buffer object, in indexes
+    std::size_t getIndexOffset() const { return allocation ? allocation->getOffset() / sizeof(uint16_t) : 0; }
+
     int byteSize;
+
+private:
+    Context& context;
+    std::optional<UniqueBuffer> buffer;
+    std::optional<BufferPool::Allocation> allocation;
 };
 
 } // namespace gl
@@ -99,12 +99,27 @@ void TileLayerGroupGL::render(RenderOrchestrator&, PaintParameters& parameters)
     const auto debugGroupRender = parameters.encoder->createDebugGroup(label_render.c_str());
 #endif
 
-    bool bindUBOs = false;
+    // Drawables clipped to their tiles don't overlap those of other tiles, which allows grouping
+    // the drawables of all the tiles by program and textures
+    bool clipped = !features3d && stencilTiles && !stencilTiles->empty();
+    drawList.clear();
     visitDrawables([&](gfx::Drawable& drawable) {
-        if (!drawable.getEnabled() || !drawable.hasRenderPass(parameters.pass)) {
-            return;
+        if (drawable.getEnabled() && drawable.hasRenderPass(parameters.pass)) {
+            clipped = clipped && drawable.getEnableStencil() && drawable.getTileID() && !drawable.getIs3D();
+            drawList.add(static_cast<gl::DrawableGL&>(drawable));
         }
+    });
+    if (drawList.empty()) {
+        return;
+    }
+    if (clipped) {
+        drawList.sort();
+    }
+
+    uniformBuffers.bind();
 
+    DrawableGL::Bindings bindings;
+    drawList.visitDrawables([&](gl::DrawableGL& drawable) {
 #if !defined(NDEBUG)
         std::string label_tile;
         if (const auto& tileID = drawable.getTileID()) {
@@ -115,11 +130,6 @@ void TileLayerGroupGL::render(RenderOrchestrator&, PaintParameters& parameters)
         const auto debugGroupTile = parameters.encoder->createDebugGroup(labelPtr);
 #endif
 
-        if (!bindUBOs) {
-            uniformBuffers.bind();
-            bindUBOs = true;
-        }
-
         for (const auto& tweaker : drawable.getTweakers()) {
             tweaker->execute(drawable, parameters);
         }
@@ -131,12 +141,11 @@ void TileLayerGroupGL::render(RenderOrchestrator&, PaintParameters& parameters)
             context.setStencilMode(drawable.getEnableStencil() ? stencilMode3d : gfx::StencilMode::disabled());
         }
 
-        drawable.draw(parameters);
+        drawable.draw(parameters, bindings);
     });
+    DrawableGL::unbind(parameters, bindings);
 
-    if (bindUBOs) {
-        uniformBuffers.unbind();
-    }
+    uniformBuffers.unbind();
 }
 
 LayerGroupGL::LayerGroupGL(int32_t layerIndex_, std::size_t initialCapacity, std::string name_)
@@ -168,6 +177,7 @@ void LayerGroupGL::render(RenderOrchestrator&, PaintParameters& parameters) {
     }
 
     bool bindUBOs = false;
+    DrawableGL::Bindings bindings;
     visitDrawables([&](gfx::Drawable& drawable) {
         if (!drawable.getEnabled() || !drawable.hasRenderPass(parameters.pass)) {
             return;
@@ -185,8 +195,9 @@ void LayerGroupGL::render(RenderOrchestrator&, PaintParameters& parameters) {
             tweaker->execute(drawable, parameters);
         }
 
-        drawable.draw(parameters);
+        static_cast<gl::DrawableGL&>(drawable).draw(parameters, bindings);
     });
+    DrawableGL::unbind(parameters, bindings);
 
     if (bindUBOs) {
         uniformBuffers.unbind();
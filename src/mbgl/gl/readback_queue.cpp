@@ -0,0 +1,136 @@
+#include <mbgl/gl/readback_queue.hpp>
+#include <mbgl/gl/context.hpp>
+#include <mbgl/gl/defines.hpp>
+#include <mbgl/gl/enum.hpp>
+#include <mbgl/gl/fence.hpp>
+#include <mbgl/util/instrumentation.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+
+namespace mbgl {
+namespace gl {
+
+using namespace platform;
+
+ReadbackQueue::ReadbackQueue(Context& context_)
+    : context(context_) {}
+
+ReadbackQueue::~ReadbackQueue() {
+    // Abandon the buffers of reads never processed along with the idle ones
+    auto& stats = context.renderingStats();
+    for (const auto& readback : pending) {
+        stats.memBuffers -= static_cast<int>(readback.buffer.byteSize);
+    }
+    for (const auto& buffer : idleBuffers) {
+        stats.memBuffers -= static_cast<int>(buffer.byteSize);
+    }
+}
+
+void ReadbackQueue::read(const Size size, const gfx::TexturePixelType format, const bool flip, Callback&& callback) {
+    MLN_TRACE_FUNC();
+    MLN_TRACE_FUNC_GL();
+
+    const std::size_t stride = size.width * (format == gfx::TexturePixelType::RGBA ? 4 : 1);
+    auto buffer = acquireBuffer(stride * size.height);
+
+    context.pixelStorePack = {1};
+    MBGL_CHECK_ERROR(glBindBuffer(GL_PIXEL_PACK_BUFFER, buffer.buffer));
+    // With a pixel pack buffer bound, the pointer is an offset into it and the call returns right away
+    MBGL_CHECK_ERROR(glReadPixels(
+        0, 0, size.width, size.height, Enum<gfx::TexturePixelType>::to(format), GL_UNSIGNED_BYTE, nullptr));
+    MBGL_CHECK_ERROR(glBindBuffer(GL_PIXEL_PACK_BUFFER, 0));
+
+    auto fence = std::make_unique<Fence>();
+    fence->insert();
+
+    pending.push_back({.buffer = std::move(buffer),
+                       .size = size,
+                       .stride = stride,
+                       .flip = flip,
+                       .fence = std::move(fence),
+                       .callback = std::move(callback)});
+}
+
+void ReadbackQueue::process(const bool wait) {
+    MLN_TRACE_FUNC();
+
+    // Complete them in order, so that callbacks see the frames in the order they were rendered
+    const auto end = wait ? pending.end() : std::ranges::find_if(pending, [](const Readback& readback) {
+        return !readback.fence->isSignaled();
+    });
+    if (end == pending.begin()) {
+        return;
+    }
+
+    // Callbacks may start new reads, take the completed ones out of the queue first
+    std::vector<Readback> completed{std::make_move_iterator(pending.begin()), std::make_move_iterator(end)};
+    pending.erase(pending.begin(), end);
+
+    auto& stats = context.renderingStats();
+    for (auto& readback : completed) {
+        auto data = copyPixels(readback);
+        if (idleBuffers.size() < maxIdleBuffers) {
+            idleBuffers.push_back(std::move(readback.buffer));
+        } else {
+            stats.memBuffers -= static_cast<int>(readback.buffer.byteSize);
+        }
+        readback.callback(std::move(data));
+    }
+}
+
+ReadbackQueue::Buffer ReadbackQueue::acquireBuffer(const std::size_t byteSize) {
+    const auto it = std::ranges::find(idleBuffers, byteSize, &Buffer::byteSize);
+    if (it != idleBuffers.end()) {
+        auto buffer = std::move(*it);
+        idleBuffers.erase(it);
+        return buffer;
+    }
+
+    BufferID id = 0;
+    MBGL_CHECK_ERROR(glGenBuffers(1, &id));
+    // NOLINTNEXTLINE(performance-move-const-arg)
+    UniqueBuffer buffer{std::move(id), {context}};
+    MBGL_CHECK_ERROR(glBindBuffer(GL_PIXEL_PACK_BUFFER, buffer));
+    MBGL_CHECK_ERROR(glBufferData(GL_PIXEL_PACK_BUFFER, byteSize, nullptr, GL_STREAM_READ));
+    MBGL_CHECK_ERROR(glBindBuffer(GL_PIXEL_PACK_BUFFER, 0));
+
+    auto& stats = context.renderingStats();
+    stats.numBuffers++;
+    stats.totalBuffers++;
+    stats.memBuffers += static_cast<int>(byteSize);
+
+    return {.buffer = std::move(buffer), .byteSize = byteSize};
+}
+
+std::unique_ptr<uint8_t[]> ReadbackQueue::copyPixels(const Readback& readback) {
+    MLN_TRACE_FUNC();
+    MLN_TRACE_FUNC_GL();
+
+    const auto byteSize = readback.buffer.byteSize;
+    auto data = std::make_unique<uint8_t[]>(byteSize);
+
+    MBGL_CHECK_ERROR(glBindBuffer(GL_PIXEL_PACK_BUFFER, readback.buffer.buffer));
+    const auto* mapped = static_cast<const uint8_t*>(
+        MBGL_CHECK_ERROR(glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, byteSize, GL_MAP_READ_BIT)));
+    if (mapped) {
+        // The only copy of the pixels, which also flips the rows
+        if (readback.flip) {
+            for (uint32_t row = 0; row < readback.size.height; ++row) {
+                std::memcpy(data.get() + row * readback.stride,
+                            mapped + (readback.size.height - 1 - row) * readback.stride,
+                            readback.stride);
+            }
+        } else {
+            std::memcpy(data.get(), mapped, byteSize);
+        }
+        MBGL_CHECK_ERROR(glUnmapBuffer(GL_PIXEL_PACK_BUFFER));
+    }
+    MBGL_CHECK_ERROR(glBindBuffer(GL_PIXEL_PACK_BUFFER, 0));
+
+    return data;
+}
+
+} // namespace gl
+} // namespace mbgl
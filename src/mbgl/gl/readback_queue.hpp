@@ -0,0 +1,68 @@
+#pragma once
+
+#include <mbgl/gfx/types.hpp>
+#include <mbgl/gl/object.hpp>
+#include <mbgl/util/noncopyable.hpp>
+#include <mbgl/util/size.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace mbgl {
+namespace gl {
+
+class Context;
+class Fence;
+
+/// Reads framebuffers into pixel pack buffers without stalling on `glReadPixels`. The pixels are
+/// copied out once a fence inserted after the read has signalled, which lets the next frame be
+/// encoded while the GPU finishes the previous one.
+class ReadbackQueue : private util::noncopyable {
+public:
+    using Callback = std::function<void(std::unique_ptr<uint8_t[]>)>;
+
+    /// Pixel buffers kept for later reads once their readback completed
+    static constexpr std::size_t maxIdleBuffers = 2;
+
+    explicit ReadbackQueue(Context&);
+    ~ReadbackQueue();
+
+    /// Starts reading the bound framebuffer. `callback` gets the tightly packed pixels, with the
+    /// rows flipped if `flip`, from a later call to `process()`.
+    void read(Size, gfx::TexturePixelType, bool flip, Callback&& callback);
+
+    /// Calls the callbacks of the reads the GPU has completed, in the order they were started. If
+    /// `wait`, blocks until all of them are done.
+    void process(bool wait);
+
+    bool empty() const { return pending.empty(); }
+
+private:
+    struct Buffer {
+        UniqueBuffer buffer;
+        std::size_t byteSize;
+    };
+
+    struct Readback {
+        Buffer buffer;
+        Size size;
+        std::size_t stride;
+        bool flip;
+        std::unique_ptr<Fence> fence;
+        Callback callback;
+    };
+
+    Buffer acquireBuffer(std::size_t byteSize);
+    // Copies the pixels out of the buffer of a completed read
+    std::unique_ptr<uint8_t[]> copyPixels(const Readback&);
+
+    Context& context;
+    std::vector<Readback> pending;
+    std::vector<Buffer> idleBuffers;
+};
+
+} // namespace gl
+} // namespace mbgl
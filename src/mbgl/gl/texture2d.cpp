@@ -156,6 +156,12 @@ void Texture2D::unbind() noexcept {
     }
 }
 
+bool Texture2D::isBound(int32_t location, int32_t textureUnit) const noexcept {
+    // A pending sampler update is only applied by `bind`
+    return texture && !samplerStateDirty && boundLocation == location && boundTextureUnit == textureUnit &&
+           context.texture[static_cast<size_t>(textureUnit)].getCurrentValue() == getTextureID();
+}
+
 void Texture2D::upload(const void* pixelData, const Size& size_) noexcept {
     if (!texture || storageDirty || size_ == Size{0, 0} || size_ != size) {
         size = size_;
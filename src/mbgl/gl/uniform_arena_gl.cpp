@@ -0,0 +1,102 @@
+#include <mbgl/gl/uniform_arena_gl.hpp>
+#include <mbgl/gl/context.hpp>
+#include <mbgl/gl/defines.hpp>
+#include <mbgl/gl/fence.hpp>
+#include <mbgl/util/instrumentation.hpp>
+
+#include <cassert>
+#include <cstring>
+
+namespace mbgl {
+namespace gl {
+
+using namespace platform;
+
+namespace {
+
+std::size_t getUniformBufferOffsetAlignment() {
+    GLint value = 0;
+    MBGL_CHECK_ERROR(glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &value));
+    return static_cast<std::size_t>(value);
+}
+
+} // namespace
+
+UniformArenaGL::UniformArenaGL(Context& context_)
+    : UniformArena(getUniformBufferOffsetAlignment(), initialCapacity),
+      context(context_) {}
+
+UniformArenaGL::~UniformArenaGL() {
+    context.renderingStats().memBuffers -= static_cast<int>(bufferSize);
+}
+
+void UniformArenaGL::waitForRegion(std::size_t region) {
+    MLN_TRACE_FUNC();
+
+    const auto fence = std::move(fences[region]);
+#ifndef __EMSCRIPTEN__
+    // WebGL can't block on fences, but its buffer updates are synchronized with draw calls anyway
+    if (fence) {
+        fence->wait();
+    }
+#endif
+}
+
+void UniformArenaGL::fenceRegion(std::size_t region) {
+    // Inserted by the context at the end of the frame
+    fences[region] = context.getCurrentFrameFence();
+}
+
+void UniformArenaGL::resize(std::size_t newCapacity, std::size_t stableSize) {
+    MLN_TRACE_FUNC();
+
+    // Draw calls already made keep reading from the old buffer, it's deleted once they're done
+    BufferID id = 0;
+    MBGL_CHECK_ERROR(glGenBuffers(1, &id));
+    // NOLINTNEXTLINE(performance-move-const-arg)
+    buffer.emplace(std::move(id), detail::BufferDeleter{context});
+
+    auto& stats = context.renderingStats();
+    stats.memBuffers -= static_cast<int>(bufferSize);
+    bufferSize = newCapacity * frameCount + stableSize;
+    stats.numBuffers++;
+    stats.totalBuffers++;
+    stats.memBuffers += static_cast<int>(bufferSize);
+
+    MBGL_CHECK_ERROR(glBindBuffer(GL_UNIFORM_BUFFER, buffer->get()));
+    MBGL_CHECK_ERROR(glBufferData(GL_UNIFORM_BUFFER, bufferSize, nullptr, GL_DYNAMIC_DRAW));
+    MBGL_CHECK_ERROR(glBindBuffer(GL_UNIFORM_BUFFER, 0));
+}
+
+void UniformArenaGL::upload(std::size_t region, std::size_t offset, const void* data, std::size_t size) {
+    MLN_TRACE_FUNC();
+    assert(buffer);
+
+    const auto bufferOffset = static_cast<GLintptr>(region * getCapacity() + offset);
+    MBGL_CHECK_ERROR(glBindBuffer(GL_UNIFORM_BUFFER, buffer->get()));
+#ifdef __EMSCRIPTEN__
+    // WebGL has no glMapBufferRange
+    MBGL_CHECK_ERROR(glBufferSubData(GL_UNIFORM_BUFFER, bufferOffset, size, data));
+#else
+    // Nothing reads from the range since the region was waited for, no need to synchronize
+    auto* mapped = MBGL_CHECK_ERROR(glMapBufferRange(GL_UNIFORM_BUFFER,
+                                                     bufferOffset,
+                                                     size,
+                                                     GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT |
+                                                         GL_MAP_WRITE_BIT));
+    assert(mapped);
+    if (mapped) {
+        std::memcpy(mapped, data, size);
+        MBGL_CHECK_ERROR(glUnmapBuffer(GL_UNIFORM_BUFFER));
+    }
+#endif
+    MBGL_CHECK_ERROR(glBindBuffer(GL_UNIFORM_BUFFER, 0));
+
+    auto& stats = context.renderingStats();
+    stats.bufferUpdates++;
+    stats.bufferObjUpdates++;
+    stats.bufferUpdateBytes += size;
+}
+
+} // namespace gl
+} // namespace mbgl
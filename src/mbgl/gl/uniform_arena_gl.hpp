@@ -0,0 +1,45 @@
+#pragma once
+
+#include <mbgl/gfx/uniform_arena.hpp>
+#include <mbgl/gl/object.hpp>
+
+#include <array>
+#include <memory>
+#include <optional>
+
+namespace mbgl {
+namespace gl {
+
+class Context;
+class Fence;
+
+/// Uniform arena in a single `GL_UNIFORM_BUFFER`. OpenGL ES 3.0 can't map buffers persistently,
+/// so the data is uploaded at each flush into a range the GPU doesn't read from, which doesn't
+/// need to be synchronized with the draw calls using the rest of the buffer.
+class UniformArenaGL final : public gfx::UniformArena {
+public:
+    /// Size of each region, and of the stable area, before it first grows
+    static constexpr std::size_t initialCapacity = 64 * 1024;
+
+    explicit UniformArenaGL(Context&);
+    ~UniformArenaGL() override;
+
+    /// The buffer blocks are bound from, which changes when the arena grows
+    BufferID getBuffer() const { return buffer ? buffer->get() : 0; }
+
+protected:
+    void waitForRegion(std::size_t region) override;
+    void fenceRegion(std::size_t region) override;
+    void resize(std::size_t newCapacity, std::size_t stableSize) override;
+    void upload(std::size_t region, std::size_t offset, const void* data, std::size_t size) override;
+
+private:
+    Context& context;
+    std::optional<UniqueBuffer> buffer;
+    std::size_t bufferSize = 0;
+    // Fence of the frame that last used each region
+    std::array<std::shared_ptr<Fence>, frameCount> fences;
+};
+
+} // namespace gl
+} // namespace mbgl
@@ -6,8 +6,8 @@
 #include <mbgl/util/logging.hpp>
 
 #include <atomic>
-#include <vector>
 #include <cassert>
+#include <cstring>
 
 namespace mbgl {
 namespace gl {
@@ -26,39 +26,17 @@ int64_t generateDebugId() noexcept {
 
 } // namespace
 
-UniformBufferGL::UniformBufferGL(Context& context_, const void* data_, std::size_t size_, IBufferAllocator& allocator_)
+UniformBufferGL::UniformBufferGL(Context& context_, const void* data_, std::size_t size_, gfx::UniformArena& arena)
     : UniformBuffer(size_),
       context(context_),
 #ifdef MLN_TRACY_ENABLE
       uniqueDebugId(generateDebugId()),
 #endif
-      managedBuffer(allocator_, this) {
-
+      block(arena, data_, size_) {
     context.renderingStats().numUniformBuffers++;
     context.renderingStats().memUniformBuffers += size;
 
-    context.renderingStats().totalBuffers++;
-    context.renderingStats().numBuffers++;
-    context.renderingStats().memBuffers += size;
-
-#ifdef __EMSCRIPTEN__
-    constexpr bool forceDisableManagedAllocation{true};
-#else
-    constexpr bool forceDisableManagedAllocation{false};
-#endif
-
     MLN_TRACE_ALLOC_CONST_BUFFER(uniqueDebugId, size_);
-    if (forceDisableManagedAllocation || size_ > managedBuffer.allocator.pageSize()) {
-        // Buffer is very large, won't fit in the provided allocator
-        MBGL_CHECK_ERROR(glGenBuffers(1, &localID));
-        MBGL_CHECK_ERROR(glBindBuffer(GL_UNIFORM_BUFFER, localID));
-        MBGL_CHECK_ERROR(glBufferData(GL_UNIFORM_BUFFER, size, data_, GL_DYNAMIC_DRAW));
-        MBGL_CHECK_ERROR(glBindBuffer(GL_UNIFORM_BUFFER, 0));
-        return;
-    }
-
-    isManagedAllocation = true;
-    managedBuffer.allocate(data_, size_);
 }
 
 UniformBufferGL::UniformBufferGL(UniformBufferGL&& rhs) noexcept
@@ -67,10 +45,9 @@ UniformBufferGL::UniformBufferGL(UniformBufferGL&& rhs) noexcept
 #ifdef MLN_TRACY_ENABLE
       uniqueDebugId(rhs.uniqueDebugId),
 #endif
-      isManagedAllocation(rhs.isManagedAllocation),
-      localID(rhs.localID),
-      managedBuffer(std::move(rhs.managedBuffer)) {
-    managedBuffer.setOwner(this);
+      block(std::move(rhs.block)) {
+    context.renderingStats().numUniformBuffers++;
+    context.renderingStats().memUniformBuffers += size;
 #ifdef MLN_TRACY_ENABLE
     rhs.uniqueDebugId = -1;
 #endif
@@ -82,77 +59,47 @@ UniformBufferGL::UniformBufferGL(const UniformBufferGL& other)
 #ifdef MLN_TRACY_ENABLE
       uniqueDebugId(generateDebugId()),
 #endif
-      managedBuffer(other.managedBuffer.allocator, this) {
+      block(other.block) {
+    context.renderingStats().numUniformBuffers++;
+    context.renderingStats().memUniformBuffers += size;
+
     MLN_TRACE_ALLOC_CONST_BUFFER(uniqueDebugId, other.size);
-    managedBuffer.setOwner(this);
-    if (other.isManagedAllocation) {
-        managedBuffer.allocate(other.managedBuffer.getContents().data(), other.size);
-    } else {
-        MBGL_CHECK_ERROR(glGenBuffers(1, &localID));
-        MBGL_CHECK_ERROR(glCopyBufferSubData(other.localID, localID, 0, 0, size));
-        MBGL_CHECK_ERROR(glBindBuffer(GL_COPY_READ_BUFFER, other.localID));
-        MBGL_CHECK_ERROR(glBindBuffer(GL_COPY_WRITE_BUFFER, localID));
-        MBGL_CHECK_ERROR(glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 0, 0, size));
-    }
 }
 
 UniformBufferGL::~UniformBufferGL() {
-#ifdef MLN_TRACY_ENABLE
-    assert(uniqueDebugId > 0);
-#endif
-
     context.renderingStats().numUniformBuffers--;
     context.renderingStats().memUniformBuffers -= size;
 
-    context.renderingStats().numBuffers--;
-    context.renderingStats().memBuffers -= size;
-
-    MLN_TRACE_FREE_CONST_BUFFER(uniqueDebugId);
-    if (isManagedAllocation) {
-        return;
-    }
-
-    if (localID) {
-        MBGL_CHECK_ERROR(glDeleteBuffers(1, &localID));
-        localID = 0;
+#ifdef MLN_TRACY_ENABLE
+    if (uniqueDebugId > 0) {
+        MLN_TRACE_FREE_CONST_BUFFER(uniqueDebugId);
     }
+#endif
 }
 
 BufferID UniformBufferGL::getID() const {
-    if (isManagedAllocation) {
-        return managedBuffer.getBufferID();
-    } else {
-        return localID;
-    }
+    return context.getUniformArena().getBuffer();
 }
 
 void UniformBufferGL::update(const void* data, std::size_t dataSize) {
-    assert(isManagedAllocation ? dataSize <= managedBuffer.getContents().size() : dataSize <= size);
+    assert(dataSize <= size);
 
-    if (dataSize > size || (isManagedAllocation && dataSize > managedBuffer.getContents().size())) {
+    if (dataSize > size) {
         Log::Error(Event::General,
                    "Mismatched size given to UBO update, expected max " + std::to_string(size) + ", got " +
                        std::to_string(dataSize));
         return;
     }
 
-    if (std::memcmp(data, managedBuffer.getContents().data(), dataSize) == 0) {
+    if (std::memcmp(data, block.getContents().data(), dataSize) == 0) {
         return;
     }
 
-    if (isManagedAllocation) {
-        managedBuffer.allocate(data, dataSize);
-    } else {
-        MBGL_CHECK_ERROR(glBindBuffer(GL_UNIFORM_BUFFER, localID));
-        MBGL_CHECK_ERROR(glBufferSubData(GL_UNIFORM_BUFFER, 0, dataSize, data));
-        MBGL_CHECK_ERROR(glBindBuffer(GL_UNIFORM_BUFFER, 0));
-    }
+    // Appended to the arena, which uploads it along with the other updates before the next binding
+    block.write(data, dataSize);
 
     context.renderingStats().numUniformUpdates++;
-    context.renderingStats().bufferUpdates++;
-    context.renderingStats().bufferObjUpdates++;
     context.renderingStats().uniformUpdateBytes += dataSize;
-    context.renderingStats().bufferUpdateBytes += dataSize;
 }
 
 void UniformBufferArrayGL::bind() const {
@@ -163,10 +110,12 @@ void UniformBufferArrayGL::bind() const {
         if (!uniformBuffer) continue;
         GLint binding = static_cast<GLint>(id);
         const auto& uniformBufferGL = static_cast<const UniformBufferGL&>(*uniformBuffer);
+        // Flushes the arena, which may replace its buffer
+        const auto offset = uniformBufferGL.getBindingOffset();
         MBGL_CHECK_ERROR(glBindBufferRange(GL_UNIFORM_BUFFER,
                                            binding,
                                            uniformBufferGL.getID(),
-                                           uniformBufferGL.getManagedBuffer().getBindingOffset(),
+                                           offset,
                                            uniformBufferGL.getSize()));
     }
 }
@@ -29,19 +29,35 @@ std::unique_ptr<gfx::VertexBufferResource> UploadPass::createVertexBufferResourc
                                                                                   const std::size_t size,
                                                                                   const gfx::BufferUsageType usage,
                                                                                   bool /*persistent*/) {
+    auto& context = commandEncoder.context;
+    if (usage == gfx::BufferUsageType::StaticDraw) {
+        if (auto allocation = context.getVertexBufferPool().allocate(data, size)) {
+            return std::make_unique<gl::VertexBufferResource>(context, std::move(*allocation), static_cast<int>(size));
+        }
+    }
+
     BufferID id = 0;
     MBGL_CHECK_ERROR(glGenBuffers(1, &id));
 
     // NOLINTNEXTLINE(performance-move-const-arg)
-    UniqueBuffer result{std::move(id), {commandEncoder.context}};
-    commandEncoder.context.vertexBuffer = result;
+    UniqueBuffer result{std::move(id), {context}};
+    context.vertexBuffer = result;
     MBGL_CHECK_ERROR(glBufferData(GL_ARRAY_BUFFER, size, data, Enum<gfx::BufferUsageType>::to(usage)));
     return std::make_unique<gl::VertexBufferResource>(std::move(result), static_cast<int>(size));
 }
 
 void UploadPass::updateVertexBufferResource(gfx::VertexBufferResource& resource, const void* data, std::size_t size) {
-    commandEncoder.context.vertexBuffer = static_cast<gl::VertexBufferResource&>(resource).getBuffer();
-    MBGL_CHECK_ERROR(glBufferSubData(GL_ARRAY_BUFFER, 0, size, data));
+    updateVertexBufferRange(resource, data, 0, size);
+}
+
+void UploadPass::updateVertexBufferRange(gfx::VertexBufferResource& resource,
+                                         const void* data,
+                                         std::size_t offset,
+                                         std::size_t size) {
+    auto& glResource = static_cast<gl::VertexBufferResource&>(resource);
+    commandEncoder.context.vertexBuffer = glResource.getBuffer();
+    MBGL_CHECK_ERROR(glBufferSubData(
+        GL_ARRAY_BUFFER, glResource.getOffset() + offset, size, static_cast<const uint8_t*>(data) + offset));
 
     commandEncoder.context.renderingStats().vertexUpdateBytes += size;
     commandEncoder.context.renderingStats().bufferUpdateBytes += size;
@@ -53,13 +69,20 @@ std::unique_ptr<gfx::IndexBufferResource> UploadPass::createIndexBufferResource(
                                                                                 std::size_t size,
                                                                                 const gfx::BufferUsageType usage,
                                                                                 bool /*persistent*/) {
+    auto& context = commandEncoder.context;
+    if (usage == gfx::BufferUsageType::StaticDraw) {
+        if (auto allocation = context.getIndexBufferPool().allocate(data, size)) {
+            return std::make_unique<gl::IndexBufferResource>(context, std::move(*allocation), static_cast<int>(size));
+        }
+    }
+
     BufferID id = 0;
     MBGL_CHECK_ERROR(glGenBuffers(1, &id));
 
     // NOLINTNEXTLINE(performance-move-const-arg)
-    UniqueBuffer result{std::move(id), {commandEncoder.context}};
-    commandEncoder.context.bindVertexArray = 0;
-    commandEncoder.context.globalVertexArrayState.indexBuffer = result;
+    UniqueBuffer result{std::move(id), {context}};
+    context.bindVertexArray = 0;
+    context.globalVertexArrayState.indexBuffer = result;
     MBGL_CHECK_ERROR(glBufferData(GL_ELEMENT_ARRAY_BUFFER, size, data, Enum<gfx::BufferUsageType>::to(usage)));
     return std::make_unique<gl::IndexBufferResource>(std::move(result), static_cast<int>(size));
 }
@@ -68,8 +91,10 @@ void UploadPass::updateIndexBufferResource(gfx::IndexBufferResource& resource, c
     // Be sure to unbind any existing vertex array object before binding the
     // index buffer so that we don't mess up another VAO
     commandEncoder.context.bindVertexArray = 0;
-    commandEncoder.context.globalVertexArrayState.indexBuffer = static_cast<gl::IndexBufferResource&>(resource).buffer;
-    MBGL_CHECK_ERROR(glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, size, data));
+    const auto& glResource = static_cast<gl::IndexBufferResource&>(resource);
+    commandEncoder.context.globalVertexArrayState.indexBuffer = glResource.getBuffer();
+    MBGL_CHECK_ERROR(
+        glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, glResource.getIndexOffset() * sizeof(uint16_t), size, data));
 
     commandEncoder.context.renderingStats().indexUpdateBytes += size;
     commandEncoder.context.renderingStats().bufferUpdateBytes += size;
@@ -100,7 +125,16 @@ const gfx::UniqueVertexBufferResource& UploadPass::getBuffer(const gfx::VertexVe
             if (rawBufSize <= resource.getByteSize()) {
                 // If the source changed, update the buffer contents
                 if (vec->isModifiedAfter(resource.getLastUpdated())) {
-                    updateVertexBufferResource(resource, rawBufPtr, rawBufSize);
+                    const auto& ranges = vec->getModifiedRanges();
+                    if (ranges.empty()) {
+                        updateVertexBufferResource(resource, rawBufPtr, rawBufSize);
+                    } else {
+                        // Only parts of the vector changed, e.g., the vertices of features whose state was set
+                        for (const auto& range : ranges) {
+                            updateVertexBufferRange(resource, rawBufPtr, range.begin, range.end - range.begin);
+                        }
+                    }
+                    vec->resetModifiedRanges();
                     resource.setLastUpdated(vec->getLastModified());
                 }
                 return rawData->resource;
@@ -111,6 +145,7 @@ const gfx::UniqueVertexBufferResource& UploadPass::getBuffer(const gfx::VertexVe
             auto buffer = std::make_unique<VertexBufferGL>();
             buffer->resource = createVertexBufferResource(rawBufPtr, rawBufSize, usage, /*persistent=*/false);
             vec->setBuffer(std::move(buffer));
+            vec->resetModifiedRanges();
             return static_cast<VertexBufferGL*>(vec->getBuffer())->resource;
         }
     }
@@ -36,6 +36,8 @@ public:
                                                                           gfx::BufferUsageType,
                                                                           bool persistent) override;
     void updateVertexBufferResource(gfx::VertexBufferResource&, const void* data, std::size_t size) override;
+    /// Updates `size` bytes of the buffer starting at `offset` from the same offset of `data`.
+    void updateVertexBufferRange(gfx::VertexBufferResource&, const void* data, std::size_t offset, std::size_t size);
 
     std::unique_ptr<gfx::IndexBufferResource> createIndexBufferResource(const void* data,
                                                                         std::size_t size,
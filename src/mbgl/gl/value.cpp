@@ -611,8 +611,8 @@ void VertexAttribute::Set(const Type& binding, Context& context, AttributeLocati
     MLN_TRACE_ZONE(VertexAttribute::Set);
     MLN_TRACE_FUNC_GL();
     if (binding && binding->vertexBufferResource) {
-        context.vertexBuffer =
-            reinterpret_cast<const gl::VertexBufferResource&>(*binding->vertexBufferResource).getBuffer();
+        const auto& resource = reinterpret_cast<const gl::VertexBufferResource&>(*binding->vertexBufferResource);
+        context.vertexBuffer = resource.getBuffer();
         MBGL_CHECK_ERROR(glEnableVertexAttribArray(location));
         MBGL_CHECK_ERROR(glVertexAttribPointer(
             location,
@@ -620,7 +620,8 @@ void VertexAttribute::Set(const Type& binding, Context& context, AttributeLocati
             vertexType(binding->attribute.dataType),
             static_cast<GLboolean>(false),
             static_cast<GLsizei>(binding->vertexStride),
-            reinterpret_cast<GLvoid*>(binding->attribute.offset + (binding->vertexStride * binding->vertexOffset))));
+            reinterpret_cast<GLvoid*>(resource.getOffset() + binding->attribute.offset +
+                                     (binding->vertexStride * binding->vertexOffset))));
     } else {
         MBGL_CHECK_ERROR(glDisableVertexAttribArray(location));
     }
@@ -6,12 +6,13 @@ namespace mbgl {
 namespace gl {
 
 VertexBufferResource::VertexBufferResource(UniqueBuffer&& buffer_, int byteSize_)
-    : buffer(std::move(buffer_)),
+    : context(buffer_.get_deleter().context),
+      buffer(std::move(buffer_)),
       byteSize(byteSize_) {
-    MLN_TRACE_ALLOC_VERTEX_BUFFER(buffer.get(), byteSize);
+    MLN_TRACE_ALLOC_VERTEX_BUFFER(buffer->get(), byteSize);
 
-    if (buffer) {
-        auto& stats = buffer.get_deleter().context.renderingStats();
+    if (*buffer) {
+        auto& stats = context.renderingStats();
         stats.numVertexBuffers++;
         stats.memVertexBuffers += byteSize;
 
@@ -21,11 +22,28 @@ VertexBufferResource::VertexBufferResource(UniqueBuffer&& buffer_, int byteSize_
     }
 }
 
+VertexBufferResource::VertexBufferResource(Context& context_, BufferPool::Allocation&& allocation_, int byteSize_)
+    : context(context_),
+      allocation(std::move(allocation_)),
+      byteSize(byteSize_) {
+    // The pool accounts for the memory of the buffer the data is in
+    auto& stats = context.renderingStats();
+    stats.numVertexBuffers++;
+    stats.memVertexBuffers += byteSize;
+}
+
 VertexBufferResource::~VertexBufferResource() noexcept {
-    MLN_TRACE_FREE_VERTEX_BUFFER(buffer.get());
+    if (allocation) {
+        auto& stats = context.renderingStats();
+        stats.numVertexBuffers--;
+        stats.memVertexBuffers -= byteSize;
+        return;
+    }
+
+    MLN_TRACE_FREE_VERTEX_BUFFER(buffer->get());
 
-    if (buffer) {
-        auto& stats = buffer.get_deleter().context.renderingStats();
+    if (*buffer) {
+        auto& stats = context.renderingStats();
         stats.numVertexBuffers--;
         stats.memVertexBuffers -= byteSize;
         stats.memBuffers -= byteSize;
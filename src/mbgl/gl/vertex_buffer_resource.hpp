@@ -1,26 +1,36 @@
 #pragma once
 
 #include <mbgl/gfx/vertex_buffer.hpp>
+#include <mbgl/gl/buffer_pool.hpp>
 #include <mbgl/gl/object.hpp>
 #include <mbgl/util/monotonic_timer.hpp>
 
+#include <optional>
+
 namespace mbgl {
 namespace gl {
 
 class VertexBufferResource : public gfx::VertexBufferResource {
 public:
     VertexBufferResource(UniqueBuffer&& buffer_, int byteSize_);
+    /// Data in a region of a pooled buffer
+    VertexBufferResource(Context&, BufferPool::Allocation&& allocation_, int byteSize_);
     ~VertexBufferResource() noexcept override;
 
     int getByteSize() const { return byteSize; }
 
-    const UniqueBuffer& getBuffer() const { return buffer; }
+    /// The buffer object holding the data, which is shared with other resources if pooled
+    BufferID getBuffer() const { return allocation ? allocation->getBuffer() : buffer->get(); }
+    /// Offset of the data in the buffer object
+    std::size_t getOffset() const { return allocation ? allocation->getOffset() : 0; }
 
     std::chrono::duration<double> getLastUpdated() const { return lastUpdated; }
     void setLastUpdated(std::chrono::duration<double> time) { lastUpdated = time; }
 
 protected:
-    UniqueBuffer buffer;
+    Context& context;
+    std::optional<UniqueBuffer> buffer;
+    std::optional<BufferPool::Allocation> allocation;
     int byteSize;
     std::chrono::duration<double> lastUpdated = util::MonotonicTimer::now();
 };
@@ -16,6 +16,10 @@ class FeatureIndex;
 class LayerRenderData;
 class GlyphManager;
 
+namespace util {
+class CancellationToken;
+} // namespace util
+
 class Layout {
 public:
     virtual ~Layout() = default;
@@ -45,6 +49,8 @@ public:
     GlyphDependencies& glyphDependencies;
     ImageDependencies& imageDependencies;
     std::set<std::string>& availableImages;
+    /// Polled by long-running layouts, which stop early once it is cancelled.
+    const util::CancellationToken* cancellation = nullptr;
 };
 
 } // namespace mbgl
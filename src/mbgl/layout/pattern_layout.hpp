@@ -7,6 +7,7 @@
 #include <mbgl/style/properties.hpp>
 #include <mbgl/style/layer_properties.hpp>
 #include <mbgl/util/containers.hpp>
+#include <mbgl/util/monotonic_arena.hpp>
 
 #include <list>
 
@@ -189,6 +190,7 @@ public:
                       const CanonicalTileID& canonical) override {
         auto bucket = std::make_shared<BucketType>(layout, layerPropertiesMap, zoom, overscaling);
         for (auto& patternFeature : features) {
+            const util::MonotonicArena::Checkpoint featureCheckpoint;
             const auto i = patternFeature.i;
             std::unique_ptr<GeometryTileFeature> feature = std::move(patternFeature.feature);
             const PatternLayerMap& patterns = patternFeature.getPatterns();
@@ -7,15 +7,18 @@
 #include <mbgl/renderer/layers/render_symbol_layer.hpp>
 #include <mbgl/text/get_anchors.hpp>
 #include <mbgl/text/shaping.hpp>
+#include <mbgl/text/shaping_cache.hpp>
 #include <mbgl/text/glyph_manager.hpp>
 #include <mbgl/tile/geometry_tile_data.hpp>
 #include <mbgl/tile/tile.hpp>
+#include <mbgl/util/cancellation_token.hpp>
 #include <mbgl/util/utf.hpp>
 #include <mbgl/util/constants.hpp>
 #include <mbgl/util/string.hpp>
 #include <mbgl/util/i18n.hpp>
 #include <mbgl/util/platform.hpp>
 #include <mbgl/util/containers.hpp>
+#include <mbgl/util/monotonic_arena.hpp>
 
 #include <mapbox/polylabel.hpp>
 
@@ -127,6 +130,7 @@ SymbolLayout::SymbolLayout(const BucketParameters& parameters,
       pixelRatio(parameters.pixelRatio),
       tileSize(static_cast<uint32_t>(util::tileSize_D * overscaling)),
       tilePixelRatio(static_cast<float>(util::EXTENT) / tileSize),
+      cancellation(layoutParameters.cancellation),
       layout(createLayout(toSymbolLayerProperties(layers.at(0)).layerImpl().layout, zoom)) {
     const SymbolLayer::Impl& leader = toSymbolLayerProperties(layers.at(0)).layerImpl();
 
@@ -168,7 +172,7 @@ SymbolLayout::SymbolLayout(const BucketParameters& parameters,
 
     // Determine glyph dependencies
     const size_t featureCount = sourceLayer->featureCount();
-    for (size_t i = 0; i < featureCount; ++i) {
+    for (size_t i = 0; i < featureCount && !isCancelled(); ++i) {
         auto feature = sourceLayer->getFeature(i);
         if (!leader.filter(expression::EvaluationContext(this->zoom, feature.get())
                                .withCanonicalTileID(&parameters.tileID.canonical)))
@@ -392,6 +396,10 @@ bool SymbolLayout::hasSymbolInstances() const {
     return !symbolInstances.empty();
 }
 
+bool SymbolLayout::isCancelled() const {
+    return cancellation && cancellation->isCancelled();
+}
+
 namespace {
 
 // The radial offset is to the edge of the text box
@@ -590,9 +598,15 @@ void SymbolLayout::prepareSymbols(const GlyphMap& glyphMap,
     const bool textAlongLine = layout->get<TextRotationAlignment>() == AlignmentType::Map && !isPointPlacement;
 
     for (auto it = features.begin(); it != features.end(); ++it) {
+        if (isCancelled()) {
+            return;
+        }
+
         auto& feature = *it;
         if (feature.geometry.empty()) continue;
 
+        // Line breaking scratch space, the shapings themselves outlive the feature
+        const util::MonotonicArena::Checkpoint featureCheckpoint;
         ShapedTextOrientations shapedTextOrientations;
         std::optional<PositionedIcon> shapedIcon;
         std::array<float, 2> textOffset{{0.0f, 0.0f}};
@@ -611,7 +625,7 @@ void SymbolLayout::prepareSymbols(const GlyphMap& glyphMap,
                                     WritingModeType writingMode,
                                     SymbolAnchorType textAnchor,
                                     TextJustifyType textJustify) {
-                Shaping result = getShaping(
+                Shaping result = ShapingCache::get().getShaping(
                     /* string */ formattedText,
                     /* maxWidth: ems */
                     isPointPlacement ? layout->evaluate<TextMaxWidth>(zoom, feature, canonicalID) * util::ONE_EM : 0.0f,
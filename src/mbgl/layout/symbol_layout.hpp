@@ -133,6 +133,10 @@ private:
     const uint32_t tileSize;
     const float tilePixelRatio;
 
+    // Optional, owned by the tile worker which outlives this layout.
+    const util::CancellationToken* const cancellation;
+    bool isCancelled() const;
+
     bool iconsNeedLinear = false;
     bool sortFeaturesByY = false;
     bool sortFeaturesByKey = false;
@@ -505,6 +505,30 @@ void Map::removeAnnotation(AnnotationID annotation) {
     }
 }
 
+AnnotationIDs Map::addAnnotations(const std::vector<Annotation>& annotations) {
+    if (LayerManager::annotationsEnabled) {
+        auto result = impl->annotationManager.addAnnotations(annotations);
+        impl->onUpdate();
+        return result;
+    }
+    return {};
+}
+
+void Map::updateAnnotations(const std::vector<std::pair<AnnotationID, Annotation>>& annotations) {
+    if (LayerManager::annotationsEnabled) {
+        if (impl->annotationManager.updateAnnotations(annotations)) {
+            impl->onUpdate();
+        }
+    }
+}
+
+void Map::removeAnnotations(const AnnotationIDs& annotations) {
+    if (LayerManager::annotationsEnabled) {
+        impl->annotationManager.removeAnnotations(annotations);
+        impl->onUpdate();
+    }
+}
+
 // MARK: - Toggles
 
 void Map::setDebug(MapDebugOptions debugOptions) {
@@ -119,6 +119,7 @@ void Map::Impl::onUpdate() {
                                .debugOptions = debugOptions,
                                .timePoint = timePoint,
                                .transformState = transform.getState(),
+                               .predictedTransformStates = transform.getPredictedStates(timePoint),
                                .glyphURL = style->impl->getGlyphURL(),
                                .fontFaces = style->impl->getFontFaces(),
                                .spriteLoaded = style->impl->areSpritesLoaded(),
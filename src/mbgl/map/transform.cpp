@@ -12,6 +12,7 @@
 #include <mbgl/util/logging.hpp>
 #include <mbgl/util/platform.hpp>
 
+#include <array>
 #include <cstdio>
 #include <utility>
 #include <numbers>
@@ -40,6 +41,19 @@ double _normalizeAngle(double angle, double anchorAngle) {
 
     return angle;
 }
+
+// Number of states sampled along each animated transition.
+constexpr std::size_t transitionPathSamples = 8;
+
+// How far ahead gestures are extrapolated.
+constexpr std::array<Duration, 3> gesturePredictionHorizons = {Milliseconds(250), Milliseconds(500), Milliseconds(1000)};
+// A gesture that hasn't moved the camera for this long is considered at rest.
+constexpr Duration gestureSampleTimeout = Milliseconds(100);
+// Weight of the newest sample in the smoothed gesture velocity.
+constexpr double gestureVelocitySmoothing = 0.5;
+// Below these speeds (screen pixels and zoom levels per second), gestures aren't extrapolated.
+constexpr double minGestureSpeed = 50;
+constexpr double minGestureZoomSpeed = 0.1;
 } // namespace
 
 Transform::Transform(TransformObserver& observer_, ConstrainMode constrainMode, ViewportMode viewportMode)
@@ -593,6 +607,23 @@ void Transform::startTransition(const CameraOptions& camera,
     transitionStart = Clock::now();
     transitionDuration = duration;
 
+    // Sample the path ahead of time so that tiles along it can be fetched
+    // before the camera gets there. The samples are taken on the live state,
+    // which is restored afterwards.
+    transitionPath.clear();
+    if (isAnimated) {
+        const util::UnitBezier ease = animation.easing ? *animation.easing : util::DEFAULT_TRANSITION_EASE;
+        const TransformState startState = state;
+        transitionPath.reserve(transitionPathSamples);
+        for (std::size_t i = 1; i <= transitionPathSamples; ++i) {
+            const float t = static_cast<float>(i) / transitionPathSamples;
+            frame(i == transitionPathSamples ? 1.0 : ease.solve(t, 0.001));
+            if (anchor) state.moveLatLng(anchorLatLng, *anchor);
+            transitionPath.emplace_back(t, state);
+        }
+        state = startState;
+    }
+
     transitionFrameFn = [isAnimated, animation, frame, anchor, anchorLatLng, this](const TimePoint now) {
         float t = isAnimated ? (std::chrono::duration<float>(now - transitionStart) / transitionDuration) : 1.0f;
         if (t >= 1.0) {
@@ -618,6 +649,7 @@ void Transform::startTransition(const CameraOptions& camera,
     };
 
     transitionFinishFn = [isAnimated, animation, this] {
+        transitionPath.clear();
         state.setProperties(
             TransformStateProperties().withPanningInProgress(false).withScalingInProgress(false).withRotatingInProgress(
                 false));
@@ -645,6 +677,8 @@ bool Transform::inTransition() const {
 }
 
 void Transform::updateTransitions(const TimePoint& now) {
+    trackGesture(now);
+
     // Use a temporary function to ensure that the transitionFrameFn lambda is
     // called only once per update.
 
@@ -689,6 +723,7 @@ void Transform::cancelTransitions() {
     if (transitionFinishFn) {
         transitionFinishFn();
     }
+    transitionPath.clear();
 
     transitionFrameFn = nullptr;
     transitionFinishFn = nullptr;
@@ -698,6 +733,67 @@ void Transform::setGestureInProgress(bool inProgress) {
     state.setGestureInProgress(inProgress);
 }
 
+// MARK: - Prediction
+
+std::vector<TransformState> Transform::getPredictedStates(const TimePoint& now) const {
+    std::vector<TransformState> predicted;
+
+    if (transitionFrameFn && !transitionPath.empty()) {
+        const float t = std::chrono::duration<float>(now - transitionStart) / transitionDuration;
+        for (const auto& [sampleTime, sampleState] : transitionPath) {
+            if (sampleTime > t) {
+                predicted.push_back(sampleState);
+            }
+        }
+    } else if (lastGestureSample && now - lastGestureSample->time <= gestureSampleTimeout) {
+        const double speed = std::hypot(gesturePanVelocity.x, gesturePanVelocity.y) * state.getScale();
+        if (speed < minGestureSpeed && std::abs(gestureZoomVelocity) < minGestureZoomSpeed) {
+            return predicted;
+        }
+
+        for (const auto horizon : gesturePredictionHorizons) {
+            const double seconds = std::chrono::duration<double>(horizon).count();
+            const Point<double> point = lastGestureSample->point + gesturePanVelocity * seconds;
+            const double zoom = util::clamp(
+                lastGestureSample->zoom + gestureZoomVelocity * seconds, state.getMinZoom(), state.getMaxZoom());
+
+            TransformState predictedState = state;
+            predictedState.setLatLngZoom(Projection::unproject(point, 1.0), zoom);
+            predicted.push_back(std::move(predictedState));
+        }
+    }
+
+    return predicted;
+}
+
+void Transform::trackGesture(const TimePoint& now) {
+    if (!isGestureInProgress()) {
+        lastGestureSample.reset();
+        gesturePanVelocity = {};
+        gestureZoomVelocity = 0;
+        return;
+    }
+
+    const GestureSample sample{
+        .time = now, .point = Projection::project(getLatLng(LatLng::Unwrapped), 1.0), .zoom = state.getZoom()};
+
+    if (lastGestureSample) {
+        const double dt = std::chrono::duration<double>(now - lastGestureSample->time).count();
+        if (dt <= 0) {
+            return;
+        }
+
+        // Smooth over a few updates so that a single jittery event doesn't
+        // send the prediction off in the wrong direction.
+        const Point<double> panVelocity = (sample.point - lastGestureSample->point) / dt;
+        const double zoomVelocity = (sample.zoom - lastGestureSample->zoom) / dt;
+        gesturePanVelocity = util::interpolate(gesturePanVelocity, panVelocity, gestureVelocitySmoothing);
+        gestureZoomVelocity = util::interpolate(gestureZoomVelocity, zoomVelocity, gestureVelocitySmoothing);
+    }
+
+    lastGestureSample = sample;
+}
+
 // MARK: Conversion and projection
 
 ScreenCoordinate Transform::latLngToScreenCoordinate(const LatLng& latLng) const {
@@ -8,11 +8,13 @@
 #include <mbgl/util/chrono.hpp>
 #include <mbgl/util/geo.hpp>
 #include <mbgl/util/noncopyable.hpp>
+#include <mbgl/util/geometry.hpp>
 
 #include <cstdint>
 #include <cmath>
 #include <functional>
 #include <optional>
+#include <vector>
 
 namespace mbgl {
 
@@ -117,6 +119,12 @@ public:
     Duration getTransitionDuration() const { return transitionDuration; }
     void cancelTransitions();
 
+    /** Returns the camera states the map is expected to pass through after
+        `now`, nearest first: samples of the running transition, or an
+        extrapolation of the gesture in progress. Empty when the camera is
+        expected to stay put. */
+    std::vector<TransformState> getPredictedStates(const TimePoint& now) const;
+
     // Gesture
     void setGestureInProgress(bool);
     bool isGestureInProgress() const { return state.isGestureInProgress(); }
@@ -147,6 +155,9 @@ private:
                          const std::function<void(double)>&,
                          const Duration&);
 
+    // Records the camera position during gestures to estimate its velocity.
+    void trackGesture(const TimePoint& now);
+
     // We don't want to show horizon: limit max pitch based on edge insets.
     double getMaxPitchForEdgeInsets(const EdgeInsets& insets) const;
 
@@ -154,6 +165,19 @@ private:
     Duration transitionDuration;
     std::function<bool(const TimePoint)> transitionFrameFn;
     std::function<void()> transitionFinishFn;
+
+    // States along the running transition, keyed by the fraction of its duration.
+    std::vector<std::pair<float, TransformState>> transitionPath;
+
+    struct GestureSample {
+        TimePoint time;
+        Point<double> point;
+        double zoom;
+    };
+    std::optional<GestureSample> lastGestureSample;
+    // World coordinates at zoom 0 and zoom levels per second.
+    Point<double> gesturePanVelocity;
+    double gestureZoomVelocity = 0;
 };
 
 } // namespace mbgl
@@ -105,7 +105,20 @@ const gfx::UniqueVertexBufferResource& UploadPass::getBuffer(const gfx::VertexVe
             if (rawBufSize <= resource.getSizeInBytes()) {
                 // If the source changed, update the buffer contents
                 if (forceUpdate || vec->isModifiedAfter(resource.getLastUpdated())) {
-                    updateVertexBufferResource(resource, rawBufPtr, rawBufSize);
+                    const auto& ranges = vec->getModifiedRanges();
+                    if (forceUpdate || ranges.empty()) {
+                        updateVertexBufferResource(resource, rawBufPtr, rawBufSize);
+                    } else {
+                        // Updating replaces the whole buffer, so do it once for all the modified ranges
+                        std::size_t begin = rawBufSize;
+                        std::size_t end = 0;
+                        for (const auto& range : ranges) {
+                            begin = std::min(begin, range.begin);
+                            end = std::max(end, range.end);
+                        }
+                        resource.get().update(static_cast<const uint8_t*>(rawBufPtr) + begin, end - begin, begin);
+                    }
+                    vec->resetModifiedRanges();
                     resource.setLastUpdated(vec->getLastModified());
                 }
                 return rawData->resource;
@@ -116,6 +129,7 @@ const gfx::UniqueVertexBufferResource& UploadPass::getBuffer(const gfx::VertexVe
             auto buffer_ = std::make_unique<VertexBuffer>();
             buffer_->resource = createVertexBufferResource(rawBufPtr, rawBufSize, usage, /*persistent=*/false);
             vec->setBuffer(std::move(buffer_));
+            vec->resetModifiedRanges();
             return static_cast<VertexBuffer*>(vec->getBuffer())->resource;
         }
     }
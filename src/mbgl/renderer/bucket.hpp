@@ -42,6 +42,18 @@ public:
                             std::size_t,
                             const CanonicalTileID&) {}
 
+    // Buckets returning true are populated through `addFeatureRings` while a
+    // tile is parsed, with the geometry streamed from the feature (see
+    // GeometryTileFeature::visitGeometries) instead of being materialized.
+    virtual bool supportsRingStreaming() const { return false; }
+
+    virtual void addFeatureRings(const GeometryTileFeature&,
+                                 GeometryRingsView,
+                                 const ImagePositions&,
+                                 const PatternLayerMap&,
+                                 std::size_t,
+                                 const CanonicalTileID&) {}
+
     virtual void update(const FeatureStates&, const GeometryTileLayer&, const std::string&, const ImagePositions&) {}
 
     // As long as this bucket has a Prepare render pass, this function is
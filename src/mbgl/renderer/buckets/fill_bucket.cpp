@@ -23,15 +23,34 @@ FillBucket::~FillBucket() {
     sharedVertices->release();
 }
 
-// MLN_TRIANGULATE_FILL_OUTLINES is defined in fill_bucket.hpp
-#if MLN_TRIANGULATE_FILL_OUTLINES
 void FillBucket::addFeature(const GeometryTileFeature& feature,
                             const GeometryCollection& geometry,
                             const ImagePositions& patternPositions,
                             const PatternLayerMap& patternDependencies,
                             std::size_t index,
                             const CanonicalTileID& canonical) {
+    addFeatureGeometry(feature, geometry, patternPositions, patternDependencies, index, canonical);
+}
+
+void FillBucket::addFeatureRings(const GeometryTileFeature& feature,
+                                 GeometryRingsView rings,
+                                 const ImagePositions& patternPositions,
+                                 const PatternLayerMap& patternDependencies,
+                                 std::size_t index,
+                                 const CanonicalTileID& canonical) {
+    addFeatureGeometry(feature, rings, patternPositions, patternDependencies, index, canonical);
+}
+
+template <class Rings>
+void FillBucket::addFeatureGeometry(const GeometryTileFeature& feature,
+                                    const Rings& geometry,
+                                    const ImagePositions& patternPositions,
+                                    const PatternLayerMap& patternDependencies,
+                                    std::size_t index,
+                                    const CanonicalTileID& canonical) {
     // generate buffers
+    // MLN_TRIANGULATE_FILL_OUTLINES is defined in fill_bucket.hpp
+#if MLN_TRIANGULATE_FILL_OUTLINES
     gfx::generateFillAndOutineBuffers(geometry,
                                       vertices,
                                       triangles,
@@ -41,26 +60,9 @@ void FillBucket::addFeature(const GeometryTileFeature& feature,
                                       lineSegments,
                                       basicLines,
                                       basicLineSegments);
-
-    for (auto& pair : paintPropertyBinders) {
-        const auto it = patternDependencies.find(pair.first);
-        if (it != patternDependencies.end()) {
-            pair.second.populateVertexVectors(
-                feature, vertices.elements(), index, patternPositions, it->second, canonical);
-        } else {
-            pair.second.populateVertexVectors(feature, vertices.elements(), index, patternPositions, {}, canonical);
-        }
-    }
-}
-#else  // MLN_TRIANGULATE_FILL_OUTLINES
-void FillBucket::addFeature(const GeometryTileFeature& feature,
-                            const GeometryCollection& geometry,
-                            const ImagePositions& patternPositions,
-                            const PatternLayerMap& patternDependencies,
-                            std::size_t index,
-                            const CanonicalTileID& canonical) {
-    // generate buffers
+#else
     gfx::generateFillAndOutineBuffers(geometry, vertices, triangles, triangleSegments, basicLines, basicLineSegments);
+#endif // MLN_TRIANGULATE_FILL_OUTLINES
 
     for (auto& pair : paintPropertyBinders) {
         const auto it = patternDependencies.find(pair.first);
@@ -72,7 +74,6 @@ void FillBucket::addFeature(const GeometryTileFeature& feature,
         }
     }
 }
-#endif // MLN_TRIANGULATE_FILL_OUTLINES
 
 void FillBucket::upload([[maybe_unused]] gfx::UploadPass& uploadPass) {
     uploaded = true;
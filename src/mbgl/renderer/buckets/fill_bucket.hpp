@@ -44,6 +44,15 @@ public:
                     std::size_t,
                     const CanonicalTileID&) override;
 
+    bool supportsRingStreaming() const override { return true; }
+
+    void addFeatureRings(const GeometryTileFeature&,
+                         GeometryRingsView,
+                         const mbgl::ImagePositions&,
+                         const PatternLayerMap&,
+                         std::size_t,
+                         const CanonicalTileID&) override;
+
     bool hasData() const override;
 
     void upload(gfx::UploadPass&) override;
@@ -83,6 +92,15 @@ public:
     SegmentVector triangleSegments;
 
     std::map<std::string, FillBinders> paintPropertyBinders;
+
+private:
+    template <class Rings>
+    void addFeatureGeometry(const GeometryTileFeature&,
+                            const Rings&,
+                            const ImagePositions&,
+                            const PatternLayerMap&,
+                            std::size_t,
+                            const CanonicalTileID&);
 };
 
 } // namespace mbgl
@@ -62,7 +62,7 @@ void FillExtrusionBucket::addFeature(const GeometryTileFeature& feature,
                                      const PatternLayerMap& patternDependencies,
                                      std::size_t index,
                                      const CanonicalTileID& canonical) {
-    for (auto& polygon : classifyRings(geometry)) {
+    for (auto& polygon : classifyRingViews(geometry)) {
         // Optimize polygons with many interior rings for earcut tesselation.
         limitHoles(polygon, 500);
 
@@ -75,7 +75,7 @@ void FillExtrusionBucket::addFeature(const GeometryTileFeature& feature,
 
         if (totalVertices == 0) continue;
 
-        std::vector<uint32_t> flatIndices;
+        util::ArenaVector<uint32_t> flatIndices;
         flatIndices.reserve(totalVertices);
 
         std::size_t startVertices = vertices.elements();
@@ -36,7 +36,26 @@ void LineBucket::addFeature(const GeometryTileFeature& feature,
                             const PatternLayerMap& patternDependencies,
                             std::size_t index,
                             const CanonicalTileID& canonical) {
-    for (auto& line : geometryCollection) {
+    addFeatureGeometry(feature, geometryCollection, patternPositions, patternDependencies, index, canonical);
+}
+
+void LineBucket::addFeatureRings(const GeometryTileFeature& feature,
+                                 GeometryRingsView rings,
+                                 const ImagePositions& patternPositions,
+                                 const PatternLayerMap& patternDependencies,
+                                 std::size_t index,
+                                 const CanonicalTileID& canonical) {
+    addFeatureGeometry(feature, rings, patternPositions, patternDependencies, index, canonical);
+}
+
+template <class Lines>
+void LineBucket::addFeatureGeometry(const GeometryTileFeature& feature,
+                                    const Lines& lines,
+                                    const ImagePositions& patternPositions,
+                                    const PatternLayerMap& patternDependencies,
+                                    std::size_t index,
+                                    const CanonicalTileID& canonical) {
+    for (const auto& line : lines) {
         addGeometry(line, feature, canonical);
     }
 
@@ -51,16 +70,15 @@ void LineBucket::addFeature(const GeometryTileFeature& feature,
     }
 }
 
-void LineBucket::addGeometry(const GeometryCoordinates& coordinates,
+void LineBucket::addGeometry(GeometryCoordinatesView coordinates,
                              const GeometryTileFeature& feature,
                              const CanonicalTileID& canonical) {
     // Ignore empty coordinates.
     if (coordinates.empty()) {
         return;
     }
-    gfx::PolylineGenerator<LineLayoutVertex, SegmentBase> generator(
+    gfx::PolylineGenerator<LineLayoutVertex, SegmentBase, &LineBucket::layoutVertex> generator(
         vertices,
-        LineBucket::layoutVertex,
         segments,
         [](std::size_t vertexOffset, std::size_t indexOffset) -> SegmentBase {
             return SegmentBase(vertexOffset, indexOffset);
@@ -106,8 +124,8 @@ void LineBucket::addGeometry(const GeometryCoordinates& coordinates,
         return;
     }
 
-    const auto clip_start = feature.getValue("mapbox_clip_start");
-    const auto clip_end = feature.getValue("mapbox_clip_end");
+    const auto clip_start = feature.getValueByKey(clipStartKey);
+    const auto clip_end = feature.getValueByKey(clipEndKey);
     if (clip_start && clip_end) {
         double total_length = 0.0;
         for (std::size_t i = first; i < len - 1; ++i) {
@@ -33,6 +33,15 @@ public:
                     std::size_t,
                     const CanonicalTileID&) override;
 
+    bool supportsRingStreaming() const override { return true; }
+
+    void addFeatureRings(const GeometryTileFeature&,
+                         GeometryRingsView,
+                         const mbgl::ImagePositions&,
+                         const PatternLayerMap&,
+                         std::size_t,
+                         const CanonicalTileID&) override;
+
     bool hasData() const override;
 
     void upload(gfx::UploadPass&) override;
@@ -96,10 +105,20 @@ public:
     std::map<std::string, LineBinders> paintPropertyBinders;
 
 private:
-    void addGeometry(const GeometryCoordinates&, const GeometryTileFeature&, const CanonicalTileID&);
+    template <class Lines>
+    void addFeatureGeometry(const GeometryTileFeature&,
+                            const Lines&,
+                            const ImagePositions&,
+                            const PatternLayerMap&,
+                            std::size_t,
+                            const CanonicalTileID&);
+    void addGeometry(GeometryCoordinatesView, const GeometryTileFeature&, const CanonicalTileID&);
 
     const float zoom;
     const uint32_t overscaling;
+
+    const PropertyKey clipStartKey{"mapbox_clip_start"};
+    const PropertyKey clipEndKey{"mapbox_clip_end"};
 };
 
 } // namespace mbgl
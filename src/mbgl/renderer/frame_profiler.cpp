@@ -0,0 +1,140 @@
+#include <mbgl/renderer/frame_profiler.hpp>
+
+#include <algorithm>
+#include <cassert>
+
+namespace mbgl {
+
+std::optional<FrameProfile::Phase> FrameProfile::parent(Phase phase) {
+    switch (phase) {
+        case Phase::Frame:
+            return std::nullopt;
+        case Phase::UpdateLayers:
+        case Phase::UpdateSources:
+        case Phase::PrepareSources:
+        case Phase::PrepareLayers:
+        case Phase::Placement:
+            return Phase::Orchestration;
+        case Phase::Orchestration:
+        case Phase::Upload:
+        case Phase::Encoding:
+        case Phase::Rendering:
+            return Phase::Frame;
+    }
+    return std::nullopt;
+}
+
+const char* FrameProfile::name(Phase phase) {
+    switch (phase) {
+        case Phase::Frame:
+            return "frame";
+        case Phase::Orchestration:
+            return "orchestration";
+        case Phase::UpdateLayers:
+            return "update layers";
+        case Phase::UpdateSources:
+            return "update sources";
+        case Phase::PrepareSources:
+            return "prepare sources";
+        case Phase::PrepareLayers:
+            return "prepare layers";
+        case Phase::Placement:
+            return "placement";
+        case Phase::Upload:
+            return "upload";
+        case Phase::Encoding:
+            return "encoding";
+        case Phase::Rendering:
+            return "rendering";
+    }
+    return "";
+}
+
+FrameProfiler::FrameProfiler(std::size_t capacity_)
+    : capacity(capacity_) {
+    assert(capacity > 0);
+}
+
+void FrameProfiler::setEnabled(bool enable) {
+    if (enable == enabled) {
+        return;
+    }
+    enabled = enable;
+    if (!enabled) {
+        std::scoped_lock lock(mutex);
+        frames.clear();
+        frames.shrink_to_fit();
+        next = 0;
+    }
+}
+
+void FrameProfiler::beginFrame(uint64_t frame) {
+    if (!enabled) {
+        return;
+    }
+    current.frame = frame;
+    current.phases.fill(0.0);
+    current.sources.clear();
+    current.layers.clear();
+}
+
+const FrameProfile* FrameProfiler::endFrame() {
+    if (!enabled) {
+        return nullptr;
+    }
+
+    std::scoped_lock lock(mutex);
+    if (frames.size() < capacity) {
+        frames.push_back(current);
+    } else {
+        // Assigning over the oldest frame reuses its allocations.
+        frames[next] = current;
+    }
+    next = (next + 1) % capacity;
+    return &current;
+}
+
+void FrameProfiler::addSource(const std::string& id, double updateTime) {
+    if (enabled) {
+        current.sources.push_back({.id = id, .updateTime = updateTime});
+    }
+}
+
+void FrameProfiler::setSourcePrepared(const std::string& id, double prepareTime, std::size_t renderTiles) {
+    if (!enabled) {
+        return;
+    }
+    // Styles have few sources, so a linear search is fine.
+    auto it = std::ranges::find(current.sources, id, &FrameProfile::SourceCounters::id);
+    if (it != current.sources.end()) {
+        it->prepareTime = prepareTime;
+        it->renderTiles = renderTiles;
+    }
+}
+
+void FrameProfiler::addLayer(const std::string& id, double evaluateTime) {
+    if (enabled) {
+        current.layers.push_back({.id = id, .evaluateTime = evaluateTime});
+    }
+}
+
+void FrameProfiler::setLayerPrepared(std::size_t index, double prepareTime) {
+    if (enabled && index < current.layers.size()) {
+        current.layers[index].prepareTime = prepareTime;
+    }
+}
+
+std::vector<FrameProfile> FrameProfiler::getFrames() const {
+    std::scoped_lock lock(mutex);
+    if (frames.size() < capacity) {
+        return frames;
+    }
+
+    std::vector<FrameProfile> result;
+    result.reserve(frames.size());
+    result.insert(result.end(), frames.begin() + static_cast<std::ptrdiff_t>(next), frames.end());
+    result.insert(result.end(), frames.begin(), frames.begin() + static_cast<std::ptrdiff_t>(next));
+    return result;
+}
+
+} // namespace mbgl
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <mbgl/renderer/frame_profile.hpp>
+#include <mbgl/util/monotonic_timer.hpp>
+#include <mbgl/util/noncopyable.hpp>
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace mbgl {
+
+/// Records a `FrameProfile` for each rendered frame into a ring buffer holding
+/// the most recent ones. While disabled, recording costs a branch per call.
+class FrameProfiler : private util::noncopyable {
+public:
+    static constexpr std::size_t defaultCapacity = 120;
+
+    explicit FrameProfiler(std::size_t capacity = defaultCapacity);
+
+    void setEnabled(bool);
+    bool isEnabled() const { return enabled; }
+
+    /// Starts recording a frame, dropping a frame that was begun but never ended.
+    void beginFrame(uint64_t frame);
+    /// Stores the frame being recorded, replacing the oldest one once the buffer
+    /// is full. Returns the frame, or null while disabled.
+    const FrameProfile* endFrame();
+
+    /// Current time while enabled, to measure the time passed to the methods below.
+    double timestamp() const { return enabled ? util::MonotonicTimer::now().count() : 0.0; }
+
+    void addTime(FrameProfile::Phase phase, double time) {
+        if (enabled) {
+            current.phases[static_cast<std::size_t>(phase)] += time;
+        }
+    }
+
+    void addSource(const std::string& id, double updateTime);
+    void setSourcePrepared(const std::string& id, double prepareTime, std::size_t renderTiles);
+    /// Layers are added in style order and referred to by that index afterwards.
+    void addLayer(const std::string& id, double evaluateTime);
+    void setLayerPrepared(std::size_t index, double prepareTime);
+
+    /// Recorded frames, oldest first.
+    std::vector<FrameProfile> getFrames() const;
+private:
+    const std::size_t capacity;
+    bool enabled = false;
+
+    // Written on the render thread only, so it needs no locking.
+    FrameProfile current;
+
+    mutable std::mutex mutex;
+    // Oldest frame at `next` once the buffer is full.
+    std::vector<FrameProfile> frames;
+    std::size_t next = 0;
+};
+
+} // namespace mbgl
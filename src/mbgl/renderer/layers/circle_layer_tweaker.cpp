@@ -1,5 +1,6 @@
 #include <mbgl/renderer/layers/circle_layer_tweaker.hpp>
 
+#include <mbgl/gfx/backend.hpp>
 #include <mbgl/gfx/context.hpp>
 #include <mbgl/gfx/drawable.hpp>
 #include <mbgl/renderer/buckets/circle_bucket.hpp>
@@ -39,8 +40,47 @@ void CircleLayerTweaker::execute(LayerGroupBase& layerGroup, const PaintParamete
     const bool pitchWithMap = evaluated.get<CirclePitchAlignment>() == AlignmentType::Map;
     const bool scaleWithMap = evaluated.get<CirclePitchScale>() == CirclePitchScaleType::Map;
 
+#if MLN_RENDER_BACKEND_METAL
+    const bool enableEval = gfx::Backend::getEnableGPUExpressionEval();
+    if (!expressionUniformBuffer || (gpuExpressionsUpdated && enableEval)) {
+        const auto get = [&](std::size_t index) {
+            return enableEval ? gpuExpressions[index].get() : nullptr;
+        };
+        const CircleExpressionUBO exprUBO = {
+            .color = get(propertyIndex<CircleColor>()),
+            .radius = get(propertyIndex<CircleRadius>()),
+            .blur = get(propertyIndex<CircleBlur>()),
+            .opacity = get(propertyIndex<CircleOpacity>()),
+            .stroke_color = get(propertyIndex<CircleStrokeColor>()),
+            .stroke_width = get(propertyIndex<CircleStrokeWidth>()),
+            .stroke_opacity = get(propertyIndex<CircleStrokeOpacity>()),
+        };
+        context.emplaceOrUpdateUniformBuffer(expressionUniformBuffer, &exprUBO);
+        gpuExpressionsUpdated = false;
+    }
+#endif // MLN_RENDER_BACKEND_METAL
+
     // Updated only with evaluated properties
     if (!evaluatedPropsUniformBuffer || propertiesUpdated) {
+        auto expressionMask = CircleExpressionMask::None;
+#if MLN_RENDER_BACKEND_METAL
+        if (enableEval) {
+            const auto addIf = [&](std::size_t index, CircleExpressionMask mask) {
+                if (gpuExpressions[index]) {
+                    expressionMask |= mask;
+                }
+            };
+            addIf(propertyIndex<CircleColor>(), CircleExpressionMask::Color);
+            addIf(propertyIndex<CircleRadius>(), CircleExpressionMask::Radius);
+            addIf(propertyIndex<CircleBlur>(), CircleExpressionMask::Blur);
+            addIf(propertyIndex<CircleOpacity>(), CircleExpressionMask::Opacity);
+            addIf(propertyIndex<CircleStrokeColor>(), CircleExpressionMask::StrokeColor);
+            addIf(propertyIndex<CircleStrokeWidth>(), CircleExpressionMask::StrokeWidth);
+            addIf(propertyIndex<CircleStrokeOpacity>(), CircleExpressionMask::StrokeOpacity);
+        }
+#endif // MLN_RENDER_BACKEND_METAL
+
+        // Properties with their bit set in the mask are evaluated on the GPU instead
         const CircleEvaluatedPropsUBO evaluatedPropsUBO = {
             .color = constOrDefault<CircleColor>(evaluated),
             .stroke_color = constOrDefault<CircleStrokeColor>(evaluated),
@@ -51,13 +91,18 @@ void CircleLayerTweaker::execute(LayerGroupBase& layerGroup, const PaintParamete
             .stroke_opacity = constOrDefault<CircleStrokeOpacity>(evaluated),
             .scale_with_map = scaleWithMap,
             .pitch_with_map = pitchWithMap,
-            .pad1 = 0};
+            .expressionMask = expressionMask};
         context.emplaceOrUpdateUniformBuffer(evaluatedPropsUniformBuffer, &evaluatedPropsUBO);
         propertiesUpdated = false;
     }
     auto& layerUniforms = layerGroup.mutableUniformBuffers();
     layerUniforms.set(idCircleEvaluatedPropsUBO, evaluatedPropsUniformBuffer);
 
+#if MLN_RENDER_BACKEND_METAL
+    // GPU Expressions
+    layerUniforms.set(idCircleExpressionUBO, expressionUniformBuffer);
+#endif // MLN_RENDER_BACKEND_METAL
+
 #if MLN_UBO_CONSOLIDATION
     int i = 0;
     std::vector<CircleDrawableUBO> drawableUBOVector(layerGroup.getDrawableCount());
@@ -128,4 +173,17 @@ void CircleLayerTweaker::execute(LayerGroupBase& layerGroup, const PaintParamete
 #endif
 }
 
+#if MLN_RENDER_BACKEND_METAL
+void CircleLayerTweaker::updateGPUExpressions(const Unevaluated& unevaluated, TimePoint now) {
+    if (gfx::Backend::getEnableGPUExpressionEval()) {
+        if (unevaluated.updateGPUExpressions(gpuExpressions, now)) {
+            gpuExpressionsUpdated = true;
+
+            // Masks also need to be updated
+            propertiesUpdated = true;
+        }
+    }
+}
+#endif // MLN_RENDER_BACKEND_METAL
+
 } // namespace mbgl
@@ -1,6 +1,11 @@
 #pragma once
 
 #include <mbgl/renderer/layer_tweaker.hpp>
+#include <mbgl/style/layers/circle_layer_properties.hpp>
+
+#if MLN_RENDER_BACKEND_METAL
+#include <mbgl/shaders/circle_layer_ubo.hpp>
+#endif // MLN_RENDER_BACKEND_METAL
 
 #include <string>
 #include <vector>
@@ -18,12 +23,29 @@ public:
 
     void execute(LayerGroupBase&, const PaintParameters&) override;
 
+#if MLN_RENDER_BACKEND_METAL
+    using CirclePaintProperties = style::CirclePaintProperties;
+    using Unevaluated = CirclePaintProperties::Unevaluated;
+    void updateGPUExpressions(const Unevaluated&, TimePoint now);
+
+    template <typename T>
+    static constexpr std::size_t propertyIndex() {
+        return CirclePaintProperties::Tuple<CirclePaintProperties::PropertyTypes>::getIndex<T>();
+    }
+#endif // MLN_RENDER_BACKEND_METAL
+
 protected:
     gfx::UniformBufferPtr evaluatedPropsUniformBuffer;
 
 #if MLN_UBO_CONSOLIDATION
     gfx::UniformBufferPtr drawableUniformBuffer;
 #endif
+
+#if MLN_RENDER_BACKEND_METAL
+    gfx::UniformBufferPtr expressionUniformBuffer;
+    Unevaluated::GPUExpressions gpuExpressions;
+    bool gpuExpressionsUpdated = true;
+#endif // MLN_RENDER_BACKEND_METAL
 };
 
 } // namespace mbgl
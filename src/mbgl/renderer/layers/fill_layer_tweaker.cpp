@@ -1,5 +1,6 @@
 #include <mbgl/renderer/layers/fill_layer_tweaker.hpp>
 
+#include <mbgl/gfx/backend.hpp>
 #include <mbgl/gfx/context.hpp>
 #include <mbgl/gfx/drawable.hpp>
 #include <mbgl/gfx/renderable.hpp>
@@ -37,7 +38,35 @@ void FillLayerTweaker::execute(LayerGroupBase& layerGroup, const PaintParameters
     const auto debugGroup = parameters.encoder->createDebugGroup(label.c_str());
 #endif
 
+#if MLN_RENDER_BACKEND_METAL
+    const bool enableEval = gfx::Backend::getEnableGPUExpressionEval();
+    if (!expressionUniformBuffer || (gpuExpressionsUpdated && enableEval)) {
+        const FillExpressionUBO exprUBO = {
+            .color = enableEval ? gpuExpressions[propertyIndex<FillColor>()].get() : nullptr,
+            .opacity = enableEval ? gpuExpressions[propertyIndex<FillOpacity>()].get() : nullptr,
+            .outline_color = enableEval ? gpuExpressions[propertyIndex<FillOutlineColor>()].get() : nullptr,
+        };
+        context.emplaceOrUpdateUniformBuffer(expressionUniformBuffer, &exprUBO);
+        gpuExpressionsUpdated = false;
+    }
+#endif // MLN_RENDER_BACKEND_METAL
+
     if (!evaluatedPropsUniformBuffer || propertiesUpdated) {
+        auto expressionMask = FillExpressionMask::None;
+#if MLN_RENDER_BACKEND_METAL
+        if (enableEval) {
+            if (gpuExpressions[propertyIndex<FillColor>()]) {
+                expressionMask |= FillExpressionMask::Color;
+            }
+            if (gpuExpressions[propertyIndex<FillOpacity>()]) {
+                expressionMask |= FillExpressionMask::Opacity;
+            }
+            if (gpuExpressions[propertyIndex<FillOutlineColor>()]) {
+                expressionMask |= FillExpressionMask::OutlineColor;
+            }
+        }
+#endif // MLN_RENDER_BACKEND_METAL
+
         const FillEvaluatedPropsUBO propsUBO = {
             .color = evaluated.get<FillColor>().constantOr(FillColor::defaultValue()),
             .outline_color = evaluated.get<FillOutlineColor>().constantOr(FillOutlineColor::defaultValue()),
@@ -45,6 +74,10 @@ void FillLayerTweaker::execute(LayerGroupBase& layerGroup, const PaintParameters
             .fade = crossfade.t,
             .from_scale = crossfade.fromScale,
             .to_scale = crossfade.toScale,
+            .expressionMask = expressionMask,
+            .pad1 = 0,
+            .pad2 = 0,
+            .pad3 = 0,
         };
         context.emplaceOrUpdateUniformBuffer(evaluatedPropsUniformBuffer, &propsUBO);
         propertiesUpdated = false;
@@ -52,6 +85,11 @@ void FillLayerTweaker::execute(LayerGroupBase& layerGroup, const PaintParameters
     auto& layerUniforms = layerGroup.mutableUniformBuffers();
     layerUniforms.set(idFillEvaluatedPropsUBO, evaluatedPropsUniformBuffer);
 
+#if MLN_RENDER_BACKEND_METAL
+    // GPU Expressions
+    layerUniforms.set(idFillExpressionUBO, expressionUniformBuffer);
+#endif // MLN_RENDER_BACKEND_METAL
+
     const auto& translation = evaluated.get<FillTranslate>();
     const auto anchor = evaluated.get<FillTranslateAnchor>();
     const auto zoom = static_cast<float>(parameters.state.getZoom());
@@ -1,6 +1,11 @@
 #pragma once
 
 #include <mbgl/renderer/layer_tweaker.hpp>
+#include <mbgl/style/layers/fill_layer_properties.hpp>
+
+#if MLN_RENDER_BACKEND_METAL
+#include <mbgl/shaders/fill_layer_ubo.hpp>
+#endif // MLN_RENDER_BACKEND_METAL
 
 #include <string>
 
@@ -19,6 +24,17 @@ public:
 
     void execute(LayerGroupBase&, const PaintParameters&) override;
 
+#if MLN_RENDER_BACKEND_METAL
+    using FillPaintProperties = style::FillPaintProperties;
+    using Unevaluated = FillPaintProperties::Unevaluated;
+    void updateGPUExpressions(const Unevaluated&, TimePoint now);
+
+    template <typename T>
+    static constexpr std::size_t propertyIndex() {
+        return FillPaintProperties::Tuple<FillPaintProperties::PropertyTypes>::getIndex<T>();
+    }
+#endif // MLN_RENDER_BACKEND_METAL
+
 private:
     gfx::UniformBufferPtr evaluatedPropsUniformBuffer;
 
@@ -26,6 +42,12 @@ private:
     gfx::UniformBufferPtr drawableUniformBuffer;
     gfx::UniformBufferPtr tilePropsUniformBuffer;
 #endif
+
+#if MLN_RENDER_BACKEND_METAL
+    gfx::UniformBufferPtr expressionUniformBuffer;
+    Unevaluated::GPUExpressions gpuExpressions;
+    bool gpuExpressionsUpdated = true;
+#endif // MLN_RENDER_BACKEND_METAL
 };
 
 } // namespace mbgl
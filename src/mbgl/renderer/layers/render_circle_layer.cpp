@@ -42,6 +42,12 @@ RenderCircleLayer::RenderCircleLayer(Immutable<style::CircleLayer::Impl> _impl)
 void RenderCircleLayer::transition(const TransitionParameters& parameters) {
     unevaluated = impl_cast(baseImpl).paint.transitioned(parameters, std::move(unevaluated));
     styleDependencies = unevaluated.getDependencies();
+
+#if MLN_RENDER_BACKEND_METAL
+    if (auto* tweaker = static_cast<CircleLayerTweaker*>(layerTweaker.get())) {
+        tweaker->updateGPUExpressions(unevaluated, parameters.now);
+    }
+#endif // MLN_RENDER_BACKEND_METAL
 }
 
 void RenderCircleLayer::evaluate(const PropertyEvaluationParameters& parameters) {
@@ -62,8 +68,11 @@ void RenderCircleLayer::evaluate(const PropertyEvaluationParameters& parameters)
     properties->renderPasses = mbgl::underlying_type(passes);
     evaluatedProperties = std::move(properties);
 
-    if (layerTweaker) {
-        layerTweaker->updateProperties(evaluatedProperties);
+    if (auto* tweaker = static_cast<CircleLayerTweaker*>(layerTweaker.get())) {
+        tweaker->updateProperties(evaluatedProperties);
+#if MLN_RENDER_BACKEND_METAL
+        tweaker->updateGPUExpressions(unevaluated, parameters.now);
+#endif // MLN_RENDER_BACKEND_METAL
     }
 }
 
@@ -164,7 +173,7 @@ using namespace shaders;
 void RenderCircleLayer::update(gfx::ShaderRegistry& shaders,
                                gfx::Context& context,
                                const TransformState&,
-                               const std::shared_ptr<UpdateParameters>&,
+                               [[maybe_unused]] const std::shared_ptr<UpdateParameters>& parameters,
                                const RenderTree&,
                                UniqueChangeRequestVec& changes) {
     if (!renderTiles || renderTiles->empty()) {
@@ -182,7 +191,12 @@ void RenderCircleLayer::update(gfx::ShaderRegistry& shaders,
     }
     auto* tileLayerGroup = static_cast<TileLayerGroup*>(layerGroup.get());
     if (!layerTweaker) {
-        layerTweaker = std::make_shared<CircleLayerTweaker>(getID(), evaluatedProperties);
+        auto tweaker = std::make_shared<CircleLayerTweaker>(getID(), evaluatedProperties);
+#if MLN_RENDER_BACKEND_METAL
+        tweaker->updateGPUExpressions(unevaluated, parameters->timePoint);
+#endif // MLN_RENDER_BACKEND_METAL
+
+        layerTweaker = std::move(tweaker);
         layerGroup->addLayerTweaker(layerTweaker);
     }
 
@@ -62,6 +62,12 @@ RenderFillLayer::~RenderFillLayer() = default;
 void RenderFillLayer::transition(const TransitionParameters& parameters) {
     unevaluated = impl_cast(baseImpl).paint.transitioned(parameters, std::move(unevaluated));
     styleDependencies = unevaluated.getDependencies();
+
+#if MLN_RENDER_BACKEND_METAL
+    if (auto* tweaker = static_cast<FillLayerTweaker*>(layerTweaker.get())) {
+        tweaker->updateGPUExpressions(unevaluated, parameters.now);
+    }
+#endif // MLN_RENDER_BACKEND_METAL
 }
 
 void RenderFillLayer::evaluate(const PropertyEvaluationParameters& parameters) {
@@ -86,8 +92,11 @@ void RenderFillLayer::evaluate(const PropertyEvaluationParameters& parameters) {
     properties->renderPasses = mbgl::underlying_type(passes);
     evaluatedProperties = std::move(properties);
 
-    if (layerTweaker) {
-        layerTweaker->updateProperties(evaluatedProperties);
+    if (auto* tweaker = static_cast<FillLayerTweaker*>(layerTweaker.get())) {
+        tweaker->updateProperties(evaluatedProperties);
+#if MLN_RENDER_BACKEND_METAL
+        tweaker->updateGPUExpressions(unevaluated, parameters.now);
+#endif // MLN_RENDER_BACKEND_METAL
     }
 }
 
@@ -120,7 +129,7 @@ bool RenderFillLayer::queryIntersectsFeature(const GeometryCoordinates& queryGeo
 void RenderFillLayer::update(gfx::ShaderRegistry& shaders,
                              gfx::Context& context,
                              const TransformState&,
-                             const std::shared_ptr<UpdateParameters>&,
+                             [[maybe_unused]] const std::shared_ptr<UpdateParameters>& parameters,
                              const RenderTree&,
                              UniqueChangeRequestVec& changes) {
     if (!renderTiles || renderTiles->empty()) {
@@ -145,7 +154,12 @@ void RenderFillLayer::update(gfx::ShaderRegistry& shaders,
 #endif
 
     if (!layerTweaker) {
-        layerTweaker = std::make_shared<FillLayerTweaker>(getID(), evaluatedProperties);
+        auto tweaker = std::make_shared<FillLayerTweaker>(getID(), evaluatedProperties);
+#if MLN_RENDER_BACKEND_METAL
+        tweaker->updateGPUExpressions(unevaluated, parameters->timePoint);
+#endif // MLN_RENDER_BACKEND_METAL
+
+        layerTweaker = std::move(tweaker);
         layerGroup->addLayerTweaker(layerTweaker);
     }
 
@@ -39,6 +39,11 @@ struct InterleavedVertexBuffer {
         memcpy(const_cast<void*>(data), &value, sizeof(value));
     }
 
+    /// Marks the vertices in `[begin, end)` as modified, so that only they are uploaded again.
+    void updateModified(std::size_t begin, std::size_t end) {
+        sharedVertexVector->updateModifiedRange(stride * begin, stride * end);
+    }
+
     template <typename T>
     const T& get(std::size_t index, std::size_t offset) {
         assert(stride * index + offset + sizeof(T) <= sharedVertexVector->bytes());
@@ -342,6 +347,7 @@ public:
         for (std::size_t i = start; i < end; ++i) {
             this->interleavedVertexBuffer->set(i, this->vertexOffset, value);
         }
+        this->interleavedVertexBuffer->updateModified(start, end);
     }
 
     std::tuple<float> interpolationFactor(float) const override { return std::tuple<float>{0.0f}; }
@@ -456,6 +462,7 @@ public:
         for (std::size_t i = start; i < end; ++i) {
             this->interleavedVertexBuffer->set(i, this->vertexOffset, value);
         }
+        this->interleavedVertexBuffer->updateModified(start, end);
     }
 
     std::tuple<float> interpolationFactor(float currentZoom) const override {
@@ -727,8 +734,8 @@ public:
     void updateVertexVectors(const FeatureStates& states,
                              const GeometryTileLayer& layer,
                              const ImagePositions& imagePositions) {
+        // The binders mark the vertices of the features they update as modified
         util::ignore({(binders.template get<Ps>()->updateVertexVectors(states, layer, imagePositions), 0)...});
-        interleavedVertexBuffer.sharedVertexVector->updateModified(true);
     }
 
     void setPatternParameters(const std::optional<ImagePosition>& posA,
@@ -125,7 +125,8 @@ RenderOrchestrator::RenderOrchestrator(bool backgroundLayerAsColor_,
       layerImpls(makeMutable<std::vector<Immutable<style::Layer::Impl>>>()),
       renderLight(makeMutable<Light::Impl>()),
       backgroundLayerAsColor(backgroundLayerAsColor_),
-      threadPool(threadPool_) {
+      threadPool(threadPool_),
+      tileWorkerStats(std::make_shared<TileWorkerStats>()) {
     glyphManager->setObserver(this);
     imageManager->setObserver(this);
 }
@@ -201,7 +202,9 @@ std::unique_ptr<RenderTree> RenderOrchestrator::createRenderTree(
                                   .tileLodPitchThreshold = updateParameters->tileLodPitchThreshold,
                                   .tileLodZoomShift = updateParameters->tileLodZoomShift,
                                   .tileLodMode = updateParameters->tileLodMode,
-                                  .dynamicTextureAtlas = dynamicTextureAtlas};
+                                  .dynamicTextureAtlas = dynamicTextureAtlas,
+                                  .tileWorkerStats = tileWorkerStats,
+                                  .predictedTransformStates = &updateParameters->predictedTransformStates};
 
     glyphManager->setURL(updateParameters->glyphURL);
     glyphManager->setFontFaces(updateParameters->fontFaces);
@@ -303,8 +306,10 @@ std::unique_ptr<RenderTree> RenderOrchestrator::createRenderTree(
 
     // Update layers for class and zoom changes.
     std::unordered_set<std::string> constantsMaskChanged;
+    const auto updateLayersStartTime = frameProfiler.timestamp();
     for (RenderLayer& layer : orderedLayers) {
         MLN_TRACE_ZONE(update layer);
+        const auto layerStartTime = frameProfiler.timestamp();
         const std::string& id = layer.getID();
         const bool layerAddedOrChanged = layerDiff.added.contains(id) || layerDiff.changed.contains(id);
         evaluationParameters.layerChanged = layerAddedOrChanged;
@@ -323,7 +328,9 @@ std::unique_ptr<RenderTree> RenderOrchestrator::createRenderTree(
                 constantsMaskChanged.insert(id);
             }
         }
+        frameProfiler.addLayer(id, frameProfiler.timestamp() - layerStartTime);
     }
+    frameProfiler.addTime(FrameProfile::Phase::UpdateLayers, frameProfiler.timestamp() - updateLayersStartTime);
 
     const SourceDifference sourceDiff = diffSources(sourceImpls, updateParameters->sources);
     sourceImpls = updateParameters->sources;
@@ -364,9 +371,11 @@ std::unique_ptr<RenderTree> RenderOrchestrator::createRenderTree(
     std::vector<bool> updateList(orderedLayers.size());
 
     // Update all sources and initialize renderItems.
+    const auto updateSourcesStartTime = frameProfiler.timestamp();
     for (const auto& sourceImpl : *sourceImpls) {
         MLN_TRACE_ZONE(update source);
         MLN_ZONE_STR(sourceImpl->id);
+        const auto sourceStartTime = frameProfiler.timestamp();
 
         RenderSource* source = renderSources.at(sourceImpl->id).get();
         bool sourceNeedsRendering = false;
@@ -424,7 +433,9 @@ std::unique_ptr<RenderTree> RenderOrchestrator::createRenderTree(
             }
         }
         addChanges(changes);
+        frameProfiler.addSource(sourceImpl->id, frameProfiler.timestamp() - sourceStartTime);
     }
+    frameProfiler.addTime(FrameProfile::Phase::UpdateSources, frameProfiler.timestamp() - updateSourcesStartTime);
 
     renderTreeParameters->loaded = updateParameters->styleLoaded && isLoaded();
     if (!isMapModeContinuous && !renderTreeParameters->loaded) {
@@ -432,27 +443,37 @@ std::unique_ptr<RenderTree> RenderOrchestrator::createRenderTree(
     }
 
     // Prepare. Update all matrices and generate data that we should upload to the GPU.
+    const auto prepareSourcesStartTime = frameProfiler.timestamp();
     for (const auto& [name, renderSource] : renderSources) {
         MLN_TRACE_ZONE(prepare source);
         if (renderSource->isEnabled()) {
+            const auto sourceStartTime = frameProfiler.timestamp();
             renderSource->prepare({.transform = renderTreeParameters->transformParams,
                                    .debugOptions = updateParameters->debugOptions,
                                    .imageManager = *imageManager,
                                    .sourceName = name});
+            if (frameProfiler.isEnabled()) {
+                frameProfiler.setSourcePrepared(
+                    name, frameProfiler.timestamp() - sourceStartTime, renderSource->getRawRenderTiles()->size());
+            }
         }
     }
+    frameProfiler.addTime(FrameProfile::Phase::PrepareSources, frameProfiler.timestamp() - prepareSourcesStartTime);
 
+    const auto prepareLayersStartTime = frameProfiler.timestamp();
     auto opaquePassCutOffEstimation = layerRenderItems.size();
     for (auto& renderItem : layerRenderItems) {
         RenderLayer& renderLayer = renderItem.layer;
         MLN_TRACE_ZONE(prepare layer);
         MLN_ZONE_STR(renderLayer.getID());
+        const auto layerStartTime = frameProfiler.timestamp();
 
         renderLayer.prepare({.source = renderItem.source,
                              .imageManager = *imageManager,
                              .patternAtlas = *patternAtlas,
                              .lineAtlas = *lineAtlas,
                              .state = updateParameters->transformState});
+        frameProfiler.setLayerPrepared(renderItem.index, frameProfiler.timestamp() - layerStartTime);
         if (renderLayer.needsPlacement()) {
             layersNeedPlacement.emplace_back(renderLayer);
         }
@@ -463,9 +484,11 @@ std::unique_ptr<RenderTree> RenderOrchestrator::createRenderTree(
             }
         }
     }
+    frameProfiler.addTime(FrameProfile::Phase::PrepareLayers, frameProfiler.timestamp() - prepareLayersStartTime);
 
     // Symbol placement.
     assert((updateParameters->mode == MapMode::Tile) || !placedSymbolDataCollected);
+    const auto placementStartTime = util::MonotonicTimer::now().count();
     bool symbolBucketsChanged = false;
     bool symbolBucketsAdded = false;
     std::set<std::string> usedSymbolLayers;
@@ -531,6 +554,8 @@ std::unique_ptr<RenderTree> RenderOrchestrator::createRenderTree(
         renderTreeParameters->symbolFadeChange = 1.0f;
         renderTreeParameters->needsRepaint = false;
     }
+    renderTreeParameters->placementTime = util::MonotonicTimer::now().count() - placementStartTime;
+    frameProfiler.addTime(FrameProfile::Phase::Placement, renderTreeParameters->placementTime);
 
     if (!renderTreeParameters->needsRepaint && renderTreeParameters->loaded) {
         MLN_TRACE_ZONE(reduce);
@@ -15,6 +15,8 @@
 #include <mbgl/renderer/image_manager_observer.hpp>
 #include <mbgl/text/placement.hpp>
 #include <mbgl/renderer/render_tree.hpp>
+#include <mbgl/renderer/frame_profiler.hpp>
+#include <mbgl/tile/tile_worker_stats.hpp>
 
 #include <map>
 #include <memory>
@@ -157,6 +159,11 @@ public:
 
     const ZoomHistory& getZoomHistory() const { return zoomHistory; }
 
+    const TileWorkerStats& getTileWorkerStats() const { return *tileWorkerStats; }
+
+    FrameProfiler& getFrameProfiler() { return frameProfiler; }
+    const FrameProfiler& getFrameProfiler() const { return frameProfiler; }
+
 private:
     bool isLoaded() const;
     bool hasTransitions(TimePoint) const;
@@ -228,6 +235,8 @@ private:
     RenderLayerReferences layersNeedPlacement;
 
     TaggedScheduler threadPool;
+    const std::shared_ptr<TileWorkerStats> tileWorkerStats;
+    FrameProfiler frameProfiler;
 
     std::vector<std::unique_ptr<ChangeRequest>> pendingChanges;
 
@@ -141,8 +141,12 @@ void RenderTile::prepare(const SourcePrepareParameters& parameters) {
     matrix::multiply(nearClippedMatrix, transform.nearClippedProjMatrix, nearClippedMatrix);
 }
 
-void RenderTile::setFeatureState(const LayerFeatureStates& states) {
-    tile.setFeatureState(states);
+void RenderTile::setFeatureState(const LayerFeatureStates& states, uint64_t version) {
+    tile.setFeatureState(states, version);
+}
+
+uint64_t RenderTile::getFeatureStateVersion() const {
+    return tile.getFeatureStateVersion();
 }
 
 } // namespace mbgl
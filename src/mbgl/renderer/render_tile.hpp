@@ -79,7 +79,8 @@ public:
                             const TransformState& state,
                             bool inViewportPixelUnits) const;
 
-    void setFeatureState(const LayerFeatureStates&);
+    void setFeatureState(const LayerFeatureStates&, uint64_t version);
+    uint64_t getFeatureStateVersion() const;
 
 private:
     Tile& tile;
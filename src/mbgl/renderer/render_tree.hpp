@@ -83,6 +83,8 @@ public:
     bool needsRepaint = false;
     bool loaded = false;
     bool placementChanged = false;
+    /// CPU time spent on symbol placement while building the tree (seconds)
+    double placementTime = 0.0;
 };
 
 class RenderTree {
@@ -41,6 +41,7 @@ void Renderer::render(const std::shared_ptr<UpdateParameters>& updateParameters)
         auto& context = impl->backend.getContext();
         impl->dynamicTextureAtlas = std::make_unique<gfx::DynamicTextureAtlas>(context);
     }
+    impl->orchestrator.getFrameProfiler().beginFrame(impl->frameCount);
     if (auto renderTree = impl->orchestrator.createRenderTree(updateParameters, impl->dynamicTextureAtlas)) {
         renderTree->prepare();
         impl->render(*renderTree, updateParameters);
@@ -143,6 +144,18 @@ const std::vector<PlacedSymbolData>& Renderer::getPlacedSymbolsData() const {
     return impl->orchestrator.getPlacedSymbolsData();
 }
 
+void Renderer::setFrameProfilingEnabled(bool enable) {
+    impl->orchestrator.getFrameProfiler().setEnabled(enable);
+}
+
+bool Renderer::isFrameProfilingEnabled() const {
+    return impl->orchestrator.getFrameProfiler().isEnabled();
+}
+
+std::vector<FrameProfile> Renderer::getFrameProfiles() const {
+    return impl->orchestrator.getFrameProfiler().getFrames();
+}
+
 void Renderer::setTileCacheEnabled(bool enable) {
     impl->orchestrator.setTileCacheEnabled(enable);
 }
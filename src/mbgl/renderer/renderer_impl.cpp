@@ -15,6 +15,7 @@
 #include <mbgl/renderer/render_tree.hpp>
 #include <mbgl/renderer/update_parameters.hpp>
 #include <mbgl/shaders/program_parameters.hpp>
+#include <mbgl/text/shaping_cache.hpp>
 #include <mbgl/util/convert.hpp>
 #include <mbgl/util/string.hpp>
 #include <mbgl/util/logging.hpp>
@@ -24,6 +25,9 @@
 #include <mbgl/renderer/layer_tweaker.hpp>
 #include <mbgl/renderer/render_target.hpp>
 
+#include <map>
+#include <mutex>
+
 #if MLN_RENDER_BACKEND_METAL
 #include <mbgl/mtl/renderer_backend.hpp>
 #include <Metal/MTLCaptureManager.hpp>
@@ -49,6 +53,25 @@ RendererObserver& nullObserver() {
     return observer;
 }
 
+// Renderers on a backend with shared static data render on the same context, one at a time, so they
+// share the compiled shaders and static buffers. Shaders depend on the pixel ratio, which is part of the key.
+std::shared_ptr<RenderStaticData> acquireStaticData(gfx::RendererBackend& backend, float pixelRatio, bool& created) {
+    static std::mutex mutex;
+    static std::map<std::pair<int64_t, float>, std::weak_ptr<RenderStaticData>> shared;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    std::erase_if(shared, [](const auto& entry) { return entry.second.expired(); });
+
+    auto& entry = shared[{backend.uniqueID.id(), pixelRatio}];
+    auto staticData = entry.lock();
+    created = !staticData;
+    if (created) {
+        staticData = std::make_shared<RenderStaticData>(std::make_unique<gfx::ShaderRegistry>());
+        entry = staticData;
+    }
+    return staticData;
+}
+
 } // namespace
 
 Renderer::Impl::Impl(gfx::RendererBackend& backend_,
@@ -160,16 +183,25 @@ void Renderer::Impl::render(const RenderTree& renderTree, const std::shared_ptr<
     }
 #endif // MLN_RENDER_BACKEND_METAL
 
+    const auto orchestrationTime = renderTree.getElapsedTime();
+
     // Blocks execution until the renderable is available.
     backend.getDefaultRenderable().wait();
     context.beginFrame();
 
     if (!staticData) {
-        staticData = std::make_unique<RenderStaticData>(std::make_unique<gfx::ShaderRegistry>());
+        bool created = true;
+        if (backend.hasSharedStaticData()) {
+            staticData = acquireStaticData(backend, pixelRatio, created);
+        } else {
+            staticData = std::make_shared<RenderStaticData>(std::make_unique<gfx::ShaderRegistry>());
+        }
 
         // Initialize shaders for drawables
-        const auto programParameters = ProgramParameters{pixelRatio, false};
-        backend.initShaders(*staticData->shaders, programParameters);
+        if (created) {
+            const auto programParameters = ProgramParameters{pixelRatio, false};
+            backend.initShaders(*staticData->shaders, programParameters);
+        }
 
         // Notify post-shader registration
         observer->onRegisterShaders(*staticData->shaders);
@@ -227,6 +259,7 @@ void Renderer::Impl::render(const RenderTree& renderTree, const std::shared_ptr<
 
     // - UPLOAD PASS -------------------------------------------------------------------------------
     // Uploads all required buffers and images before we do any actual rendering.
+    const auto startUpload = util::MonotonicTimer::now().count();
     {
         const auto uploadPass = parameters.encoder->createUploadPass("upload",
                                                                      parameters.backend.getDefaultRenderable());
@@ -287,6 +320,8 @@ void Renderer::Impl::render(const RenderTree& renderTree, const std::shared_ptr<
         // Upload the Debug layer group
         orchestrator.visitDebugLayerGroups([&](LayerGroupBase& layerGroup) { layerGroup.upload(*uploadPass); });
     }
+    const auto endUpload = util::MonotonicTimer::now().count();
+    const auto uploadTime = endUpload - startUpload;
 
     const Size atlasSize = parameters.patternAtlas.getPixelSize();
     const auto& worldSize = parameters.staticData.backendSize;
@@ -443,6 +478,7 @@ void Renderer::Impl::render(const RenderTree& renderTree, const std::shared_ptr<
     parameters.renderPass.reset();
 
     const auto startRendering = util::MonotonicTimer::now().count();
+    const auto encodingTime = startRendering - endUpload;
     // present submits render commands
     parameters.encoder->present(parameters.backend.getDefaultRenderable());
     context.renderingStats().renderingTime = util::MonotonicTimer::now().count() - startRendering;
@@ -464,6 +500,26 @@ void Renderer::Impl::render(const RenderTree& renderTree, const std::shared_ptr<
 #endif // MLN_RENDER_BACKEND_METAL
 
     context.renderingStats().encodingTime = renderTree.getElapsedTime() - context.renderingStats().renderingTime;
+    context.renderingStats().orchestrationTime = orchestrationTime;
+    context.renderingStats().placementTime = renderTreeParameters.placementTime;
+    context.renderingStats().uploadTime = uploadTime;
+
+    auto& frameProfiler = orchestrator.getFrameProfiler();
+    frameProfiler.addTime(FrameProfile::Phase::Frame, renderTree.getElapsedTime());
+    frameProfiler.addTime(FrameProfile::Phase::Orchestration, orchestrationTime);
+    frameProfiler.addTime(FrameProfile::Phase::Upload, uploadTime);
+    frameProfiler.addTime(FrameProfile::Phase::Encoding, encodingTime);
+    frameProfiler.addTime(FrameProfile::Phase::Rendering, context.renderingStats().renderingTime);
+
+    const auto& tileWorkerStats = orchestrator.getTileWorkerStats();
+    context.renderingStats().numAbandonedTileParses = tileWorkerStats.abandonedParses;
+    context.renderingStats().numSkippedTileParses = tileWorkerStats.skippedParses;
+    context.renderingStats().abandonedTileParseTime = tileWorkerStats.getAbandonedParseTime().count();
+
+    const auto shapingCacheStats = ShapingCache::get().getStats();
+    context.renderingStats().numShapingCacheHits = shapingCacheStats.hits;
+    context.renderingStats().numShapingCacheMisses = shapingCacheStats.misses;
+    context.renderingStats().shapingCacheSize = shapingCacheStats.size;
 
     observer->onDidFinishRenderingFrame(
         renderTreeParameters.loaded ? RendererObserver::RenderMode::Full : RendererObserver::RenderMode::Partial,
@@ -471,6 +527,10 @@ void Renderer::Impl::render(const RenderTree& renderTree, const std::shared_ptr<
         renderTreeParameters.placementChanged,
         context.threadSafeCopyRenderingStats());
 
+    if (const auto* profile = frameProfiler.endFrame()) {
+        observer->onDidProfileFrame(*profile);
+    }
+
     if (!renderTreeParameters.loaded) {
         renderState = RenderState::Partial;
     } else if (renderState != RenderState::Fully) {
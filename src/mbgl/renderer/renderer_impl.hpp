@@ -51,7 +51,8 @@ private:
     RendererObserver* observer;
 
     const float pixelRatio;
-    std::unique_ptr<RenderStaticData> staticData;
+    // Shared with the other renderers using the backend, if it has shared static data
+    std::shared_ptr<RenderStaticData> staticData;
     gfx::DynamicTextureAtlasPtr dynamicTextureAtlas;
     bool styleLoaded = false;
 
@@ -69,7 +69,7 @@ void SourceFeatureState::coalesceChanges(std::vector<RenderTile>& tiles) {
 
     for (const auto& layerStatesEntry : deletedStates) {
         const auto& sourceLayer = layerStatesEntry.first;
-        FeatureStates layerStates = {{}, {}};
+        FeatureStates layerStates;
 
         if (deletedStates[sourceLayer].empty()) {
             for (const auto& featureStatesEntry : currentStates[sourceLayer]) {
@@ -91,20 +91,34 @@ void SourceFeatureState::coalesceChanges(std::vector<RenderTile>& tiles) {
                 layerStates[featureID] = currentStates[sourceLayer][featureID];
             }
         }
-        changes[sourceLayer] = std::move(layerStates);
+        // Keep the features set in the same layer, deleted states are already applied to the current ones
+        auto& layerChanges = changes[sourceLayer];
+        for (auto& featureStatesEntry : layerStates) {
+            layerChanges[featureStatesEntry.first] = std::move(featureStatesEntry.second);
+        }
     }
 
     stateChanges.clear();
     deletedStates.clear();
 
-    changes.insert(currentStates.begin(), currentStates.end());
-
-    if (changes.empty()) {
+    const bool changed = !changes.empty();
+    if (changed) {
+        ++version;
+    }
+    if (version == 0) {
+        // No state was ever set
         return;
     }
 
     for (auto& tile : tiles) {
-        tile.setFeatureState(changes);
+        const uint64_t tileVersion = tile.getFeatureStateVersion();
+        if (tileVersion == version) {
+            continue;
+        }
+        // Only the features that changed in this call need updating if the tile was up to date
+        // before it. Tiles that missed an earlier call get all the states.
+        const bool incremental = changed && tileVersion != 0 && tileVersion + 1 == version;
+        tile.setFeatureState(incremental ? changes : currentStates, version);
     }
 }
 
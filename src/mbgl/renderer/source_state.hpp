@@ -22,9 +22,14 @@ public:
                      const std::optional<std::string>& featureID,
                      const std::optional<std::string>& stateKey);
 
+    /// Applies the changes since the last call to the tiles. Tiles that missed any of the previous
+    /// changes, e.g. because they were not rendered or have been laid out again since, get all the
+    /// current states instead.
     void coalesceChanges(std::vector<RenderTile>& tiles);
 
 private:
+    // Incremented whenever the current states change, tiles record the version they have applied
+    uint64_t version = 0;
     LayerFeatureStates currentStates;
     LayerFeatureStates stateChanges;
     LayerFeatureStates deletedStates;
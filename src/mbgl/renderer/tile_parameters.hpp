@@ -5,6 +5,7 @@
 
 #include <memory>
 #include <numbers>
+#include <vector>
 
 #include <mapbox/std/weak.hpp>
 
@@ -15,6 +16,7 @@ class FileSource;
 class AnnotationManager;
 class ImageManager;
 class GlyphManager;
+class TileWorkerStats;
 
 namespace gfx {
 class DynamicTextureAtlas;
@@ -40,6 +42,9 @@ public:
     TileLodMode tileLodMode = TileLodMode::Default;
     gfx::DynamicTextureAtlasPtr dynamicTextureAtlas;
     bool isUpdateSynchronous = false;
+    std::shared_ptr<TileWorkerStats> tileWorkerStats;
+    // Camera states to prefetch tiles for, nearest first. May be null.
+    const std::vector<TransformState>* predictedTransformStates = nullptr;
 };
 
 } // namespace mbgl
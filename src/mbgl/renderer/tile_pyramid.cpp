@@ -25,6 +25,10 @@ using namespace style;
 namespace {
 TileObserver nullObserver;
 const std::map<OverscaledTileID, std::unique_ptr<Tile>> emptyPrefetchedTiles;
+
+// Upper bound on the tiles kept loading for predicted camera states, roughly
+// two viewports' worth on a large screen.
+constexpr std::size_t maxPredictedTiles = 64;
 } // namespace
 
 TilePyramid::TilePyramid(const TaggedScheduler& threadPool_)
@@ -76,6 +80,7 @@ void TilePyramid::update(const std::vector<Immutable<style::LayerProperties>>& l
                 // for them and thus suppress network requests on
                 // tiles expiration (see `OnlineFileRequest`).
                 entry.second->setNecessity(TileNecessity::Optional);
+                entry.second->setVisible(false);
                 cache.add(entry.first, std::move(entry.second));
             } else {
                 cache.deferredRelease(std::move(entry.second));
@@ -110,6 +115,10 @@ void TilePyramid::update(const std::vector<Immutable<style::LayerProperties>>& l
     std::vector<OverscaledTileID> idealTiles;
     std::vector<OverscaledTileID> panTiles;
 
+    // Only attempt prefetching in continuous mode.
+    const bool prefetch = parameters.mode == MapMode::Continuous && type != style::SourceType::GeoJSON &&
+                          type != style::SourceType::Annotations;
+
     util::TileCoverParameters tileCoverParameters = {.transformState = parameters.transformState,
                                                      .tileLodMinRadius = parameters.tileLodMinRadius,
                                                      .tileLodScale = parameters.tileLodScale,
@@ -124,9 +133,7 @@ void TilePyramid::update(const std::vector<Immutable<style::LayerProperties>>& l
             tileZoom = idealZoom;
         }
 
-        // Only attempt prefetching in continuous mode.
-        if (parameters.mode == MapMode::Continuous && type != style::SourceType::GeoJSON &&
-            type != style::SourceType::Annotations) {
+        if (prefetch) {
             // Request lower zoom level tiles (if configured to do so) in an attempt
             // to show something on the screen faster at the cost of a little of bandwidth.
             const uint8_t prefetchZoomDelta = sourcePrefetchZoomDelta ? *sourcePrefetchZoomDelta
@@ -157,16 +164,21 @@ void TilePyramid::update(const std::vector<Immutable<style::LayerProperties>>& l
     // using, e.g. as a replacement for tile that aren't loaded yet.
     std::set<OverscaledTileID> retain;
 
-    auto retainTileFn = [&](Tile& tile, TileNecessity necessity) -> void {
+    auto retainTile = [&](Tile& tile, TileNecessity necessity, bool isPrefetch) -> void {
         if (retain.emplace(tile.id).second) {
-            tile.setUpdateParameters({.minimumUpdateInterval = minimumUpdateInterval, .isVolatile = isVolatile});
+            tile.setUpdateParameters(
+                {.minimumUpdateInterval = minimumUpdateInterval, .isVolatile = isVolatile, .isPrefetch = isPrefetch});
             tile.setNecessity(necessity);
+            tile.setVisible(true);
         }
 
         if (needsRelayout) {
             tile.setLayers(layers);
         }
     };
+    auto retainTileFn = [&](Tile& tile, TileNecessity necessity) -> void {
+        retainTile(tile, necessity, false);
+    };
     auto getTileFn = [&](const OverscaledTileID& tileID) -> Tile* {
         auto it = tiles.find(tileID);
         return it == tiles.end() ? nullptr : it->second.get();
@@ -227,6 +239,50 @@ void TilePyramid::update(const std::vector<Immutable<style::LayerProperties>>& l
                                  zoomRange,
                                  maxParentTileOverscaleFactor);
 
+    // Load the tiles covering where the camera is headed, at low priority and
+    // up to a budget, nearest prediction first. Tiles of a prediction that no
+    // longer holds aren't retained anymore and are released below, which
+    // cancels their pending requests.
+    if (prefetch && parameters.predictedTransformStates) {
+        std::size_t budget = maxPredictedTiles;
+        for (const TransformState& predictedState : *parameters.predictedTransformStates) {
+            const double predictedZoom = util::clamp<double>(predictedState.getZoom() + parameters.tileLodZoomShift,
+                                                             predictedState.getMinZoom(),
+                                                             predictedState.getMaxZoom());
+            const int32_t predictedOverscaledZoom = util::coveringZoomLevel(predictedZoom, type, tileSize);
+            if (std::cmp_less(predictedOverscaledZoom, zoomRange.min)) {
+                continue;
+            }
+            const int32_t predictedIdealZoom = std::min<int32_t>(zoomRange.max, predictedOverscaledZoom);
+
+            util::TileCoverParameters predictedCoverParameters = tileCoverParameters;
+            predictedCoverParameters.transformState = predictedState;
+            const auto predictedTiles = util::tileCover(predictedCoverParameters,
+                                                        predictedIdealZoom,
+                                                        zoomRange,
+                                                        type == SourceType::Raster ? predictedIdealZoom
+                                                                                   : predictedOverscaledZoom);
+            for (const auto& tileID : predictedTiles) {
+                if (retain.contains(tileID)) {
+                    continue;
+                }
+                Tile* tile = getTileFn(tileID);
+                if (!tile) {
+                    tile = createTileFn(tileID);
+                }
+                if (tile) {
+                    retainTile(*tile, TileNecessity::Required, true);
+                    if (--budget == 0) {
+                        break;
+                    }
+                }
+            }
+            if (budget == 0) {
+                break;
+            }
+        }
+    }
+
     for (auto previouslyRenderedTile : previouslyRenderedTiles) {
         Tile& tile = previouslyRenderedTile.second;
         tile.markRenderedPreviously();
@@ -264,6 +320,7 @@ void TilePyramid::update(const std::vector<Immutable<style::LayerProperties>>& l
                         cache.deferredRelease(std::move(tile));
                     } else {
                         tile->setNecessity(TileNecessity::Optional);
+                        tile->setVisible(false);
                         cache.add(key, std::move(tile));
                     }
                 }
@@ -28,6 +28,8 @@ public:
     const MapDebugOptions debugOptions;
     const TimePoint timePoint;
     const TransformState transformState;
+    // Where the camera is expected to go next, nearest first.
+    const std::vector<TransformState> predictedTransformStates;
 
     const std::string glyphURL;
     std::shared_ptr<FontFaces> fontFaces;
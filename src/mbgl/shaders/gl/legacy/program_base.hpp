@@ -7,6 +7,7 @@
 #include <mbgl/gl/object.hpp>
 #include <mbgl/gl/context.hpp>
 #include <mbgl/gl/draw_scope_resource.hpp>
+#include <mbgl/gl/index_buffer_resource.hpp>
 #include <mbgl/gl/vertex_array.hpp>
 #include <mbgl/gl/attribute.hpp>
 #include <mbgl/gl/uniform.hpp>
@@ -41,9 +42,7 @@ public:
         Instance(Context& context,
                  const std::initializer_list<const char*>& vertexSource,
                  const std::initializer_list<const char*>& fragmentSource)
-            : program(context.createProgram(context.createShader(ShaderType::Vertex, vertexSource),
-                                            context.createShader(ShaderType::Fragment, fragmentSource),
-                                            attributeLocations.getFirstAttribName())) {
+            : program(context.createProgram(vertexSource, fragmentSource, attributeLocations.getFirstAttribName())) {
             attributeLocations.queryLocations(program);
             uniformStates.queryLocations(program);
         }
@@ -124,7 +123,9 @@ public:
         auto& vertexArray = drawScope.getResource<gl::DrawScopeResource>().vertexArray;
         vertexArray.bind(context, indexBuffer, instance.attributeLocations.toBindingArray(attributeBindings));
 
-        context.draw(drawMode, indexOffset, indexLength);
+        // Static index data may be sub-allocated from a pooled buffer, the offset is relative to its start
+        const auto indexBase = indexBuffer.getResource<gl::IndexBufferResource>().getIndexOffset();
+        context.draw(drawMode, indexBase + indexOffset, indexLength);
     }
 
 private:
@@ -120,22 +120,18 @@ std::shared_ptr<ShaderProgramGL> ShaderProgramGL::create(
             programParameters.getProgramType(), gfx::Backend::Type::OpenGL, additionalDefines);
 
         // throws on compile error
-        auto vertProg = context.createShader(
-            ShaderType::Vertex,
-            std::initializer_list<const char*>{
-                "#version 300 es\n",
-                programParameters.getDefinesString().c_str(),
-                additionalDefines.c_str(),
-                shaders::ShaderSource<shaders::BuiltIn::Prelude, gfx::Backend::Type::OpenGL>::vertex,
-                vertexSource.c_str()});
-        auto fragProg = context.createShader(
-            ShaderType::Fragment,
+        auto program = context.createProgram(
+            {"#version 300 es\n",
+             programParameters.getDefinesString().c_str(),
+             additionalDefines.c_str(),
+             shaders::ShaderSource<shaders::BuiltIn::Prelude, gfx::Backend::Type::OpenGL>::vertex,
+             vertexSource.c_str()},
             {"#version 300 es\n",
              programParameters.getDefinesString().c_str(),
              additionalDefines.c_str(),
              shaders::ShaderSource<shaders::BuiltIn::Prelude, gfx::Backend::Type::OpenGL>::fragment,
-             fragmentSource.c_str()});
-        auto program = context.createProgram(vertProg, fragProg, firstAttribName.data());
+             fragmentSource.c_str()},
+            firstAttribName.data());
 
         context.getObserver().onPostCompileShader(
             programParameters.getProgramType(), gfx::Backend::Type::OpenGL, additionalDefines);
@@ -128,6 +128,7 @@ ShaderProgram::~ShaderProgram() noexcept {
 }
 
 const vk::UniquePipeline& ShaderProgram::getPipeline(const PipelineInfo& pipelineInfo) {
+    std::scoped_lock lock(pipelineMutex);
     auto& pipeline = pipelines->operator[](pipelineInfo.hash());
     if (pipeline) return pipeline;
 
@@ -233,7 +234,9 @@ const vk::UniquePipeline& ShaderProgram::getPipeline(const PipelineInfo& pipelin
                                         .setLayout(pipelineLayout.get())
                                         .setRenderPass(pipelineInfo.renderPass);
 
-    pipeline = std::move(device->createGraphicsPipelineUnique(nullptr, pipelineCreateInfo, nullptr, dispatcher).value);
+    pipeline = std::move(
+        device->createGraphicsPipelineUnique(backend.getPipelineCache(), pipelineCreateInfo, nullptr, dispatcher)
+            .value);
     backend.setDebugName(pipeline.get(), shaderName + "_pipeline");
 
     return pipeline;
@@ -7,6 +7,7 @@
 
 #include <mbgl/util/image.hpp>
 #include <mbgl/util/rapidjson.hpp>
+#include <mbgl/util/scheduler_telemetry.hpp>
 #include <mbgl/util/string.hpp>
 
 #include <algorithm>
@@ -200,7 +201,10 @@ std::optional<style::TextFit> getTextFit(const JSValue& value, const char* prope
 std::vector<Immutable<style::Image::Impl>> parseSprite(const std::string& id,
                                                        const std::string& encodedImage,
                                                        const std::string& json) {
-    const PremultipliedImage raster = decodeImage(encodedImage);
+    const PremultipliedImage raster = [&] {
+        const util::TaskTimer taskTimer(util::TaskCategory::ImageDecode);
+        return decodeImage(encodedImage);
+    }();
 
     JSDocument doc;
     doc.Parse<0>(json.c_str());
@@ -310,7 +310,30 @@ public:
                                                          /* .opacity = */ .opacity = options.opacity,
                                                          /* .fade = */ .fade = 0.f,
                                                          /* .from_scale = */ .from_scale = 0.f,
-                                                         /* .to_scale = */ .to_scale = 0.f};
+                                                         /* .to_scale = */ .to_scale = 0.f,
+                                                         .expressionMask = FillExpressionMask::None,
+                                                         .pad1 = 0,
+                                                         .pad2 = 0,
+                                                         .pad3 = 0};
+
+        // We would need to set up `idFillExpressionUBO` if the expression mask isn't empty
+        assert(propsUBO.expressionMask == FillExpressionMask::None);
+
+        if (!expressionUniformBuffer) {
+            const FillExpressionUBO exprUBO = {
+                .color = nullptr,
+                .opacity = nullptr,
+                .outline_color = nullptr,
+            };
+
+            expressionUniformBuffer = parameters.context.createUniformBuffer(&exprUBO, sizeof(exprUBO));
+#if MLN_UBO_CONSOLIDATION
+            layerUniforms->set(idFillExpressionUBO, expressionUniformBuffer);
+#else
+            auto& drawableUniforms = drawable.mutableUniformBuffers();
+            drawableUniforms.set(idFillExpressionUBO, expressionUniformBuffer);
+#endif
+        }
 
 #if MLN_UBO_CONSOLIDATION
         FillDrawableUnionUBO drawableUBO;
@@ -354,6 +377,8 @@ private:
     gfx::UniqueUniformBufferArray layerUniforms;
     gfx::UniformBufferPtr drawableUniformBuffer;
 #endif
+
+    gfx::UniformBufferPtr expressionUniformBuffer;
 };
 
 class SymbolDrawableTweaker : public gfx::DrawableTweaker {
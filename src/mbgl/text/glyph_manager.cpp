@@ -9,6 +9,7 @@
 #include <mbgl/util/tiny_sdf.hpp>
 #include <mbgl/util/image.hpp>
 #include <mbgl/util/logging.hpp>
+#include <mbgl/util/scheduler_telemetry.hpp>
 
 #include <fstream>
 
@@ -124,6 +125,7 @@ void GlyphManager::processResponse(const Response& res, const FontStack& fontSta
             std::vector<Glyph> glyphs;
 
             try {
+                const util::TaskTimer taskTimer(util::TaskCategory::Glyph);
                 if (range.type == GlyphIDType::FontPBF) {
                     glyphs = parseGlyphPBF(range, *res.data);
                 } else {
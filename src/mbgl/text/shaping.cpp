@@ -1,12 +1,12 @@
 #include <mbgl/text/shaping.hpp>
 #include <mbgl/util/constants.hpp>
 #include <mbgl/util/i18n.hpp>
+#include <mbgl/util/monotonic_arena.hpp>
 #include <mbgl/layout/symbol_feature.hpp>
 #include <mbgl/math/minmax.hpp>
 #include <mbgl/text/bidi.hpp>
 
 #include <algorithm>
-#include <list>
 #include <cmath>
 
 namespace {
@@ -318,7 +318,7 @@ struct PotentialBreak {
 PotentialBreak evaluateBreak(const std::size_t breakIndex,
                              const float breakX,
                              const float targetWidth,
-                             const std::list<PotentialBreak>& potentialBreaks,
+                             const util::ArenaVector<PotentialBreak>& potentialBreaks,
                              const float penalty,
                              const bool isLastBreak) {
     // We could skip evaluating breaks where the line length (breakX - priorBreak.x) > maxWidth
@@ -369,7 +369,9 @@ std::set<std::size_t> determineLineBreaks(const TaggedString& logicalInput,
     const float targetWidth = determineAverageLineWidth(
         logicalInput, spacing, maxWidth, glyphMap, imagePositions, layoutTextSize);
 
-    std::list<PotentialBreak> potentialBreaks;
+    // Breaks point at earlier ones, so there must be room for all of them up front
+    util::ArenaVector<PotentialBreak> potentialBreaks;
+    potentialBreaks.reserve(logicalInput.length());
     float currentX = 0;
     // Find first occurance of zero width space (ZWSP) character.
     const bool hasServerSuggestedBreaks = logicalInput.rawText().find_first_of(ZWSP) != std::string::npos;
@@ -0,0 +1,207 @@
+#include <mbgl/text/shaping_cache.hpp>
+#include <mbgl/util/hash.hpp>
+
+namespace mbgl {
+
+namespace {
+
+// Labels set in a single font are the common case; ones with images or
+// HarfBuzz adjustments depend on more than the key captures.
+bool isCacheable(const TaggedString& string) {
+    if (string.sectionCount() != 1 || string.rawText().empty()) {
+        return false;
+    }
+    const SectionOptions& section = string.sectionAt(0);
+    return section.type == GlyphIDType::FontPBF && !section.imageID && !section.adjusts;
+}
+
+// Fills in the tile's atlas positions, and checks that the glyphs the shaping
+// was made with have the same metrics.
+bool updateGlyphPositions(Shaping& shaping, const GlyphMap& glyphMap, const GlyphPositions& glyphPositions) {
+    for (auto& line : shaping.positionedLines) {
+        for (auto& positionedGlyph : line.positionedGlyphs) {
+            const GlyphMetrics* metrics = nullptr;
+            Rect<uint16_t> rect;
+
+            if (auto positions = glyphPositions.find(positionedGlyph.font); positions != glyphPositions.end()) {
+                if (auto position = positions->second.find(positionedGlyph.glyph);
+                    position != positions->second.end()) {
+                    metrics = &position->second.metrics;
+                    rect = position->second.rect;
+                }
+            }
+            if (!metrics) {
+                if (auto glyphs = glyphMap.find(positionedGlyph.font); glyphs != glyphMap.end()) {
+                    if (auto glyph = glyphs->second.find(positionedGlyph.glyph);
+                        glyph != glyphs->second.end() && glyph->second) {
+                        metrics = &(*glyph->second)->metrics;
+                    }
+                }
+            }
+
+            if (!metrics || !(*metrics == positionedGlyph.metrics)) {
+                return false;
+            }
+            positionedGlyph.rect = rect;
+        }
+    }
+    return true;
+}
+
+// Characters of the text the tile has no glyph for, which the shaping leaves out
+std::u16string missingGlyphs(const std::u16string& text,
+                             FontStackHash fontStack,
+                             const GlyphMap& glyphMap,
+                             const GlyphPositions& glyphPositions) {
+    const auto glyphs = glyphMap.find(fontStack);
+    const auto positions = glyphPositions.find(fontStack);
+    std::u16string result;
+    for (const char16_t codePoint : text) {
+        if (positions != glyphPositions.end() && positions->second.contains(codePoint)) {
+            continue;
+        }
+        if (glyphs != glyphMap.end()) {
+            if (auto glyph = glyphs->second.find(codePoint); glyph != glyphs->second.end() && glyph->second) {
+                continue;
+            }
+        }
+        result.push_back(codePoint);
+    }
+    return result;
+}
+
+} // namespace
+
+std::size_t ShapingCache::KeyHasher::operator()(const Key& key) const {
+    return util::hash(key.text,
+                      key.fontStack,
+                      key.scale,
+                      key.maxWidth,
+                      key.lineHeight,
+                      key.spacing,
+                      key.translate[0],
+                      key.translate[1],
+                      key.layoutTextSize,
+                      key.layoutTextSizeAtBucketZoomLevel,
+                      key.textAnchor,
+                      key.textJustify,
+                      key.writingMode,
+                      key.allowVerticalPlacement);
+}
+
+ShapingCache::ShapingCache(std::size_t capacity_)
+    : capacity(capacity_) {}
+
+ShapingCache& ShapingCache::get() {
+    static ShapingCache cache;
+    return cache;
+}
+
+Shaping ShapingCache::getShaping(const TaggedString& string,
+                                 const float maxWidth,
+                                 const float lineHeight,
+                                 const style::SymbolAnchorType textAnchor,
+                                 const style::TextJustifyType textJustify,
+                                 const float spacing,
+                                 const std::array<float, 2>& translate,
+                                 const WritingModeType writingMode,
+                                 BiDi& bidi,
+                                 const GlyphMap& glyphMap,
+                                 const GlyphPositions& glyphPositions,
+                                 const ImagePositions& imagePositions,
+                                 const float layoutTextSize,
+                                 const float layoutTextSizeAtBucketZoomLevel,
+                                 const bool allowVerticalPlacement) {
+    const auto shape = [&] {
+        return mbgl::getShaping(string,
+                                maxWidth,
+                                lineHeight,
+                                textAnchor,
+                                textJustify,
+                                spacing,
+                                translate,
+                                writingMode,
+                                bidi,
+                                glyphMap,
+                                glyphPositions,
+                                imagePositions,
+                                layoutTextSize,
+                                layoutTextSizeAtBucketZoomLevel,
+                                allowVerticalPlacement);
+    };
+
+    if (capacity == 0 || !isCacheable(string)) {
+        return shape();
+    }
+
+    const SectionOptions& section = string.sectionAt(0);
+    Key key{.text = string.rawText(),
+            .fontStack = section.fontStackHash,
+            .scale = section.scale,
+            .maxWidth = maxWidth,
+            .lineHeight = lineHeight,
+            .spacing = spacing,
+            .translate = translate,
+            .layoutTextSize = layoutTextSize,
+            .layoutTextSizeAtBucketZoomLevel = layoutTextSizeAtBucketZoomLevel,
+            .textAnchor = textAnchor,
+            .textJustify = textJustify,
+            .writingMode = writingMode,
+            .allowVerticalPlacement = allowVerticalPlacement};
+
+    auto missing = missingGlyphs(key.text, key.fontStack, glyphMap, glyphPositions);
+    if (auto cached = find(key); cached && cached->missingGlyphs == missing) {
+        Shaping shaping = *cached->shaping;
+        if (updateGlyphPositions(shaping, glyphMap, glyphPositions)) {
+            hits++;
+            return shaping;
+        }
+    }
+
+    misses++;
+    Shaping shaping = shape();
+    insert(std::move(key), {.shaping = std::make_shared<const Shaping>(shaping), .missingGlyphs = std::move(missing)});
+    return shaping;
+}
+
+std::optional<ShapingCache::Value> ShapingCache::find(const Key& key) {
+    std::scoped_lock lock(mutex);
+    auto it = index.find(key);
+    if (it == index.end()) {
+        return std::nullopt;
+    }
+    entries.splice(entries.begin(), entries, it->second);
+    return it->second->second;
+}
+
+void ShapingCache::insert(Key&& key, Value&& value) {
+    std::scoped_lock lock(mutex);
+    if (auto it = index.find(key); it != index.end()) {
+        // Replaces an entry made with other glyphs, or one another thread added meanwhile.
+        it->second->second = std::move(value);
+        entries.splice(entries.begin(), entries, it->second);
+        return;
+    }
+
+    if (entries.size() == capacity) {
+        index.erase(entries.back().first);
+        entries.pop_back();
+    }
+    entries.emplace_front(std::move(key), std::move(value));
+    index.emplace(entries.front().first, entries.begin());
+}
+
+ShapingCache::Stats ShapingCache::getStats() const {
+    std::scoped_lock lock(mutex);
+    return {.hits = hits, .misses = misses, .size = entries.size()};
+}
+
+void ShapingCache::clear() {
+    std::scoped_lock lock(mutex);
+    entries.clear();
+    index.clear();
+    hits = 0;
+    misses = 0;
+}
+
+} // namespace mbgl
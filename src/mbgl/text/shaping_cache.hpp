@@ -0,0 +1,106 @@
+#pragma once
+
+#include <mbgl/text/shaping.hpp>
+#include <mbgl/util/noncopyable.hpp>
+
+#include <array>
+#include <atomic>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+namespace mbgl {
+
+/// Shapings of single-font labels, shared between tiles and zoom levels. The
+/// same street name shows up in many tiles, each of which would otherwise
+/// break and lay out the text from scratch.
+///
+/// Glyph atlas positions differ between tiles, so they are filled in for the
+/// requesting tile on every hit. A hit whose glyph metrics don't match the
+/// tile's glyphs, e.g. after switching to a style with other fonts, is
+/// treated as a miss. So is a hit made with other glyphs missing than the
+/// tile's, as missing glyphs are left out of the shaping.
+class ShapingCache : private util::noncopyable {
+public:
+    static constexpr std::size_t defaultCapacity = 4096;
+
+    struct Stats {
+        std::size_t hits = 0;
+        std::size_t misses = 0;
+        std::size_t size = 0;
+    };
+
+    explicit ShapingCache(std::size_t capacity = defaultCapacity);
+
+    /// The cache shared by all symbol layouts.
+    static ShapingCache& get();
+
+    /// Same as `mbgl::getShaping`, served from the cache where possible.
+    Shaping getShaping(const TaggedString& string,
+                       float maxWidth,
+                       float lineHeight,
+                       style::SymbolAnchorType textAnchor,
+                       style::TextJustifyType textJustify,
+                       float spacing,
+                       const std::array<float, 2>& translate,
+                       WritingModeType,
+                       BiDi& bidi,
+                       const GlyphMap& glyphMap,
+                       const GlyphPositions& glyphPositions,
+                       const ImagePositions& imagePositions,
+                       float layoutTextSize,
+                       float layoutTextSizeAtBucketZoomLevel,
+                       bool allowVerticalPlacement);
+
+    Stats getStats() const;
+    void clear();
+
+private:
+    struct Key {
+        std::u16string text;
+        FontStackHash fontStack;
+        double scale;
+        float maxWidth;
+        float lineHeight;
+        float spacing;
+        std::array<float, 2> translate;
+        float layoutTextSize;
+        float layoutTextSizeAtBucketZoomLevel;
+        style::SymbolAnchorType textAnchor;
+        style::TextJustifyType textJustify;
+        WritingModeType writingMode;
+        bool allowVerticalPlacement;
+
+        bool operator==(const Key&) const = default;
+    };
+
+    struct KeyHasher {
+        std::size_t operator()(const Key&) const;
+    };
+
+    struct Value {
+        std::shared_ptr<const Shaping> shaping;
+        // Characters of the text without a glyph when it was shaped
+        std::u16string missingGlyphs;
+    };
+
+    using Entries = std::list<std::pair<Key, Value>>;
+
+    std::optional<Value> find(const Key&);
+    void insert(Key&&, Value&&);
+
+    const std::size_t capacity;
+
+    mutable std::mutex mutex;
+    // Most recently used first.
+    Entries entries;
+    std::unordered_map<Key, Entries::iterator, KeyHasher> index;
+
+    std::atomic<std::size_t> hits{0};
+    std::atomic<std::size_t> misses{0};
+};
+
+} // namespace mbgl
@@ -199,12 +199,13 @@ GeometryTile::GeometryTile(const OverscaledTileID& id_,
              parameters.threadPool,
              id_,
              sourceID,
-             obsolete,
+             cancellation,
              parameters.mode,
              parameters.pixelRatio,
              parameters.debugOptions & MapDebugOptions::Collision,
              parameters.dynamicTextureAtlas,
-             parameters.glyphManager->getFontFaces()),
+             parameters.glyphManager->getFontFaces(),
+             parameters.tileWorkerStats),
       fileSource(parameters.fileSource),
       glyphManager(parameters.glyphManager),
       imageManager(parameters.imageManager),
@@ -234,8 +235,14 @@ void GeometryTile::cancel() {
     markObsolete();
 }
 
+void GeometryTile::setVisible(bool visible) {
+    if (cancellation.setSuspended(!visible) && visible) {
+        worker.self().invoke(&GeometryTileWorker::resume);
+    }
+}
+
 void GeometryTile::markObsolete() {
-    obsolete = true;
+    cancellation.abandon();
     mailbox->abandon();
 }
 
@@ -247,7 +254,7 @@ void GeometryTile::setError(std::exception_ptr err) {
 void GeometryTile::setData(std::unique_ptr<const GeometryTileData> data_) {
     MLN_TRACE_FUNC();
 
-    if (obsolete) {
+    if (cancellation.isAbandoned()) {
         return;
     }
 
@@ -343,6 +350,8 @@ void GeometryTile::onLayout(std::shared_ptr<LayoutResult> result, const uint64_t
     }
 
     layoutResult = std::move(result);
+    // The new buckets have none of the feature states applied
+    featureStateVersion = 0;
     if (!atlasTextures) {
         atlasTextures = std::make_shared<TileAtlasTextures>();
     }
@@ -579,13 +588,14 @@ void GeometryTile::performedFadePlacement() {
     }
 }
 
-void GeometryTile::setFeatureState(const LayerFeatureStates& states) {
+void GeometryTile::setFeatureState(const LayerFeatureStates& states, uint64_t version) {
     MLN_TRACE_FUNC();
 
     const auto layers = getData();
-    if ((layers == nullptr) || states.empty() || !layoutResult) {
+    if ((layers == nullptr) || !layoutResult) {
         return;
     }
+    featureStateVersion = version;
 
     for (auto& layerIdToLayerRenderData = layoutResult->layerRenderData;
          auto& [layerID, renderData] : layerIdToLayerRenderData) {
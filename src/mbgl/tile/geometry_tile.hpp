@@ -65,6 +65,7 @@ public:
     float getQueryPadding(const std::unordered_map<std::string, const RenderLayer*>&) override;
 
     void cancel() override;
+    void setVisible(bool) override;
 
     class LayoutResult {
     public:
@@ -99,14 +100,16 @@ public:
     void performedFadePlacement() override;
     std::shared_ptr<FeatureIndex> getFeatureIndex() const;
 
-    void setFeatureState(const LayerFeatureStates&) override;
+    void setFeatureState(const LayerFeatureStates&, uint64_t version) override;
+    uint64_t getFeatureStateVersion() const override { return featureStateVersion; }
 
 protected:
     const GeometryTileData* getData() const;
     LayerRenderData* getLayerRenderData(const style::Layer::Impl&);
 
-    // Used to signal the worker that it should abandon parsing this tile as soon as possible.
-    std::atomic<bool> obsolete{false};
+    // Used to signal the worker that it should abandon parsing this tile as soon as possible,
+    // or suspend it while the tile is out of view.
+    util::CancellationToken cancellation;
 
 private:
     void markObsolete();
@@ -124,6 +127,8 @@ private:
 
     std::shared_ptr<LayoutResult> layoutResult;
     std::shared_ptr<TileAtlasTextures> atlasTextures;
+    // Feature states applied to the buckets of `layoutResult`
+    uint64_t featureStateVersion = 0;
 
     const MapMode mode;
 
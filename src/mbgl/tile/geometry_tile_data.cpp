@@ -21,7 +21,7 @@ using namespace std::numbers;
 namespace mbgl {
 namespace {
 
-double signedArea(const GeometryCoordinates& ring) {
+double signedArea(std::span<const GeometryCoordinate> ring) {
     double sum = 0;
 
     for (std::size_t i = 0, len = ring.size(), j = len - 1; i < len; j = i++) {
@@ -55,6 +55,44 @@ GeometryCollection toGeometryCollection(MultiPolygon<int16_t>&& multipolygon) {
     }
     return result;
 }
+
+template <class Rings>
+util::ArenaVector<PolygonView> classifyRingViewsImpl(const Rings& rings) {
+    util::ArenaVector<PolygonView> polygons;
+
+    if (rings.size() <= 1) {
+        auto& polygon = polygons.emplace_back();
+        for (const auto& ring : rings) {
+            polygon.emplace_back(ring);
+        }
+        return polygons;
+    }
+
+    PolygonView polygon;
+    int8_t ccw = 0;
+
+    for (const auto& ring : rings) {
+        double area = signedArea(ring);
+        if (area == 0) continue;
+
+        if (ccw == 0) {
+            ccw = (area < 0 ? -1 : 1);
+        }
+
+        if (ccw == (area < 0 ? -1 : 1) && !polygon.empty()) {
+            polygons.emplace_back(std::move(polygon));
+            polygon = PolygonView();
+        }
+
+        polygon.emplace_back(ring);
+    }
+
+    if (!polygon.empty()) {
+        polygons.emplace_back(std::move(polygon));
+    }
+
+    return polygons;
+}
 } // namespace
 
 GeometryCollection fixupPolygons(const GeometryCollection& rings) {
@@ -124,6 +162,28 @@ void limitHoles(GeometryCollection& polygon, uint32_t maxHoles) {
     }
 }
 
+util::ArenaVector<PolygonView> classifyRingViews(const GeometryCollection& rings) {
+    MLN_TRACE_FUNC();
+    return classifyRingViewsImpl(rings);
+}
+
+util::ArenaVector<PolygonView> classifyRingViews(GeometryRingsView rings) {
+    MLN_TRACE_FUNC();
+    return classifyRingViewsImpl(rings);
+}
+
+void limitHoles(PolygonView& polygon, uint32_t maxHoles) {
+    MLN_TRACE_FUNC();
+
+    if (polygon.size() > 1 + maxHoles) {
+        std::nth_element(
+            polygon.begin() + 1, polygon.begin() + 1 + maxHoles, polygon.end(), [](const auto& a, const auto& b) {
+                return std::fabs(signedArea(a)) > std::fabs(signedArea(b));
+            });
+        polygon.resize(1 + maxHoles);
+    }
+}
+
 Feature::geometry_type convertGeometry(const GeometryTileFeature& geometryTileFeature, const CanonicalTileID& tileID) {
     MLN_TRACE_FUNC();
 
@@ -299,4 +359,10 @@ const GeometryCollection& GeometryTileFeature::getGeometries() const {
     return dummy;
 }
 
+void GeometryTileFeature::visitGeometries(const std::function<void(GeometryRingsView)>& visitor) const {
+    const GeometryCollection& geometries = getGeometries();
+    const util::ArenaVector<GeometryCoordinatesView> rings(geometries.begin(), geometries.end());
+    visitor(rings);
+}
+
 } // namespace mbgl
@@ -2,9 +2,12 @@
 
 #include <mbgl/util/geometry.hpp>
 #include <mbgl/util/feature.hpp>
+#include <mbgl/util/monotonic_arena.hpp>
 
 #include <cstdint>
+#include <functional>
 #include <memory>
+#include <optional>
 #include <span>
 #include <string>
 #include <vector>
@@ -60,6 +63,41 @@ private:
     std::span<const std::uint32_t> triangles = {};
 };
 
+using GeometryCoordinatesView = std::span<const GeometryCoordinate>;
+
+// All rings of a feature, referring to coordinates owned by someone else.
+using GeometryRingsView = std::span<const GeometryCoordinatesView>;
+
+// A polygon whose rings refer to the coordinates of the classified geometry.
+using PolygonView = util::ArenaVector<GeometryCoordinatesView>;
+
+// A property name that remembers its index in the key table of the layer it
+// was last looked up in, so that looking it up on further features of that
+// layer doesn't compare strings. Not thread-safe; keep one per bucket.
+class PropertyKey {
+public:
+    explicit PropertyKey(std::string name_)
+        : name(std::move(name_)) {}
+
+    const std::string& getName() const { return name; }
+
+    // Returns the index of the key in `layer`, calling `lookup(name)` only when
+    // the key was last resolved against a different layer.
+    template <class Lookup>
+    std::optional<std::size_t> resolve(const void* layer, Lookup&& lookup) const {
+        if (layer != resolvedLayer) {
+            index = lookup(name);
+            resolvedLayer = layer;
+        }
+        return index;
+    }
+
+private:
+    std::string name;
+    mutable const void* resolvedLayer = nullptr;
+    mutable std::optional<std::size_t> index;
+};
+
 class GeometryTileFeature {
 public:
     virtual ~GeometryTileFeature() = default;
@@ -68,6 +106,15 @@ public:
     virtual const PropertyMap& getProperties() const;
     virtual FeatureIdentifier getID() const { return NullValue{}; }
     virtual const GeometryCollection& getGeometries() const;
+
+    // Same as `getValue(key.getName())`. Formats with a per-layer key table
+    // use the index cached in `key` instead of looking up the name.
+    virtual std::optional<Value> getValueByKey(const PropertyKey& key) const { return getValue(key.getName()); }
+
+    // Passes all rings of the feature to `visitor` in a single call. Formats
+    // that can decode on the fly do so into scratch memory, without building
+    // a GeometryCollection. The views are only valid during the call.
+    virtual void visitGeometries(const std::function<void(GeometryRingsView)>& visitor) const;
 };
 
 class GeometryTileLayer {
@@ -98,6 +145,13 @@ std::vector<GeometryCollection> classifyRings(const GeometryCollection&);
 // Truncate polygon to the largest `maxHoles` inner rings by area.
 void limitHoles(GeometryCollection&, uint32_t maxHoles);
 
+// Like classifyRings, but without copying the rings. The result must not
+// outlive the collection, and is allocated from the current arena, if any.
+util::ArenaVector<PolygonView> classifyRingViews(const GeometryCollection&);
+util::ArenaVector<PolygonView> classifyRingViews(GeometryRingsView);
+
+void limitHoles(PolygonView&, uint32_t maxHoles);
+
 Feature::geometry_type convertGeometry(const GeometryTileFeature& geometryTileFeature, const CanonicalTileID& tileID);
 
 GeometryCollection convertGeometry(const Feature::geometry_type& geometryTileFeature, const CanonicalTileID& tileID);
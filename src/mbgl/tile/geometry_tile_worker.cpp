@@ -19,6 +19,10 @@
 #include <mbgl/util/constants.hpp>
 #include <mbgl/util/string.hpp>
 #include <mbgl/util/exception.hpp>
+#include <mbgl/util/monotonic_arena.hpp>
+#include <mbgl/util/monotonic_timer.hpp>
+#include <mbgl/util/parallel_for.hpp>
+#include <mbgl/util/scheduler_telemetry.hpp>
 #include <mbgl/util/stopwatch.hpp>
 #include <mbgl/util/thread_pool.hpp>
 
@@ -29,28 +33,47 @@ namespace mbgl {
 
 using namespace style;
 
+namespace {
+
+// Upper bound on the number of extra pool tasks a single parse may fan out to.
+constexpr std::size_t maxParseHelpers = 3;
+
+// Scratch memory for the intermediates of bucket population (classified rings,
+// triangle lists, line breaks). Nothing allocated from it outlives a single
+// feature; each scope rewinds it to where it started, so nested scopes on the
+// same thread leave each other's allocations alone. The vertex and index
+// vectors that end up in a bucket are regular heap allocations.
+util::MonotonicArena& scratchArena() {
+    thread_local util::MonotonicArena arena;
+    return arena;
+}
+
+} // namespace
+
 GeometryTileWorker::GeometryTileWorker(OptionalActorRef<GeometryTileWorker> self_,
                                        OptionalActorRef<GeometryTile> parent_,
                                        const TaggedScheduler& scheduler_,
                                        OverscaledTileID id_,
                                        std::string sourceID_,
-                                       const std::atomic<bool>& obsolete_,
+                                       const util::CancellationToken& cancellation_,
                                        const MapMode mode_,
                                        const float pixelRatio_,
                                        const bool showCollisionBoxes_,
                                        gfx::DynamicTextureAtlasPtr dynamicTextureAtlas_,
-                                       std::shared_ptr<FontFaces> fontFaces_)
+                                       std::shared_ptr<FontFaces> fontFaces_,
+                                       TileWorkerStatsPtr stats_)
     : self(std::move(self_)),
       parent(std::move(parent_)),
       scheduler(scheduler_),
       id(id_),
       sourceID(std::move(sourceID_)),
-      obsolete(obsolete_),
+      cancellation(cancellation_),
       mode(mode_),
       pixelRatio(pixelRatio_),
       showCollisionBoxes(showCollisionBoxes_),
       dynamicTextureAtlas(dynamicTextureAtlas_),
-      fontFaces(fontFaces_) {}
+      fontFaces(fontFaces_),
+      stats(std::move(stats_)) {}
 
 GeometryTileWorker::~GeometryTileWorker() {
     MLN_TRACE_FUNC();
@@ -231,6 +254,34 @@ void GeometryTileWorker::setShowCollisionBoxes(bool showCollisionBoxes_, uint64_
     }
 }
 
+void GeometryTileWorker::resume() {
+    MLN_TRACE_FUNC();
+
+    try {
+        if (!suspendedWork) {
+            return;
+        }
+        suspendedWork = false;
+
+        switch (state) {
+            case Idle:
+                parse();
+                coalesce();
+                break;
+
+            case Coalescing:
+            case NeedsSymbolLayout:
+                state = NeedsParse;
+                break;
+
+            case NeedsParse:
+                break;
+        }
+    } catch (...) {
+        parent.invoke(&GeometryTile::onError, std::current_exception(), correlationID);
+    }
+}
+
 void GeometryTileWorker::symbolDependenciesChanged() {
     MLN_TRACE_FUNC();
 
@@ -414,12 +465,28 @@ void GeometryTileWorker::parse() {
     }
 
     MBGL_TIMING_START(watch)
+    const auto parseStart = util::MonotonicTimer::now();
+    const util::TaskTimer taskTimer(util::TaskCategory::TileParse);
+    const util::MonotonicArena::Scope arenaScope(scratchArena());
 
     std::unordered_map<std::string, std::unique_ptr<SymbolLayout>> symbolLayoutMap;
 
     renderData.clear();
     layouts.clear();
 
+    // Loops stop as soon as the tile is cancelled, and the cancellation may be lifted again before
+    // the next checkpoint. Comparing the epoch makes sure a parse cut short is never published.
+    const auto parseEpoch = cancellation.getEpoch();
+    if (cancellation.isCancelled()) {
+        // The result isn't wanted (right now), don't even start.
+        featureIndex.reset();
+        suspendedWork = !cancellation.isAbandoned();
+        if (stats) {
+            stats->skippedParses++;
+        }
+        return;
+    }
+
     featureIndex = std::make_unique<FeatureIndex>(*data ? (*data)->clone() : nullptr);
 
     // Avoid small reallocations for populated cells.
@@ -438,9 +505,24 @@ void GeometryTileWorker::parse() {
         groupMap[layoutKey(*layer->baseImpl)].push_back(std::move(layer));
     }
 
+    // Groups which don't need a `Layout` step only touch their own bucket while
+    // iterating features, so they are collected here and populated in parallel
+    // below. Everything touching shared state (the feature index, render data,
+    // glyph and image dependencies) stays on this thread.
+    struct BucketJob {
+        const std::vector<Immutable<style::LayerProperties>>* group;
+        std::unique_ptr<GeometryTileLayer> geometryLayer;
+        std::shared_ptr<Bucket> bucket;
+        // Index of each added feature within the layer, and the number of
+        // entries it contributed to `envelopes`.
+        std::vector<std::pair<std::size_t, std::size_t>> features;
+        std::vector<FeatureIndex::RingEnvelope> envelopes;
+    };
+    std::vector<BucketJob> bucketJobs;
+
     for (auto& pair : groupMap) {
         const auto& group = pair.second;
-        if (obsolete) {
+        if (abandonIfCancelled(parseStart, parseEpoch)) {
             return;
         }
 
@@ -476,38 +558,81 @@ void GeometryTileWorker::parse() {
                                                                                 .fontFaces = fontFaces,
                                                                                 .glyphDependencies = glyphDependencies,
                                                                                 .imageDependencies = imageDependencies,
-                                                                                .availableImages = availableImages},
+                                                                                .availableImages = availableImages,
+                                                                                .cancellation = &cancellation},
                                                                                std::move(geometryLayer),
                                                                                group);
+            if (abandonIfCancelled(parseStart, parseEpoch)) {
+                // The layout may have stopped early and is incomplete.
+                return;
+            }
             if (layout->hasDependencies()) {
                 layouts.push_back(std::move(layout));
             } else {
                 layout->createBucket({}, featureIndex, renderData, firstLoad, showCollisionBoxes, id.canonical);
             }
         } else {
-            const Filter& filter = leaderImpl.filter;
-            const std::string& sourceLayerID = leaderImpl.sourceLayer;
-            std::shared_ptr<Bucket> bucket = LayerManager::get()->createBucket(parameters, group);
+            bucketJobs.push_back({.group = &group,
+                                  .geometryLayer = std::move(geometryLayer),
+                                  .bucket = LayerManager::get()->createBucket(parameters, group),
+                                  .features = {},
+                                  .envelopes = {}});
+        }
+    }
 
-            for (std::size_t i = 0; !obsolete && i < geometryLayer->featureCount(); i++) {
-                std::unique_ptr<GeometryTileFeature> feature = geometryLayer->getFeature(i);
+    util::parallelFor(scheduler, bucketJobs.size(), maxParseHelpers, [&](std::size_t jobIndex) {
+        MLN_TRACE_ZONE(populate bucket);
+        const util::MonotonicArena::Scope jobArenaScope(scratchArena());
+        auto& job = bucketJobs[jobIndex];
+        const style::Layer::Impl& leaderImpl = *(job.group->at(0)->baseImpl);
+        const Filter& filter = leaderImpl.filter;
 
-                if (!filter(expression::EvaluationContext(static_cast<float>(this->id.overscaledZ), feature.get())
-                                .withCanonicalTileID(&id.canonical)))
-                    continue;
+        for (std::size_t i = 0; !cancellation.isCancelled() && i < job.geometryLayer->featureCount(); i++) {
+            const util::MonotonicArena::Checkpoint featureCheckpoint;
+            std::unique_ptr<GeometryTileFeature> feature = job.geometryLayer->getFeature(i);
 
+            if (!filter(expression::EvaluationContext(static_cast<float>(this->id.overscaledZ), feature.get())
+                            .withCanonicalTileID(&id.canonical)))
+                continue;
+
+            const std::size_t firstEnvelope = job.envelopes.size();
+            if (job.bucket->supportsRingStreaming()) {
+                feature->visitGeometries([&](GeometryRingsView rings) {
+                    job.bucket->addFeatureRings(*feature, rings, {}, PatternLayerMap(), i, id.canonical);
+                    for (const auto& ring : rings) {
+                        job.envelopes.push_back(FeatureIndex::envelope(ring));
+                    }
+                });
+            } else {
                 const GeometryCollection& geometries = feature->getGeometries();
-                bucket->addFeature(*feature, geometries, {}, PatternLayerMap(), i, id.canonical);
-                featureIndex->insert(geometries, i, sourceLayerID, leaderImpl.id);
+                job.bucket->addFeature(*feature, geometries, {}, PatternLayerMap(), i, id.canonical);
+                for (const auto& ring : geometries) {
+                    job.envelopes.push_back(FeatureIndex::envelope(ring));
+                }
             }
+            job.features.emplace_back(i, job.envelopes.size() - firstEnvelope);
+        }
+    });
 
-            if (!bucket->hasData()) {
-                continue;
-            }
+    if (abandonIfCancelled(parseStart, parseEpoch)) {
+        return;
+    }
 
-            for (const auto& layer : group) {
-                renderData.emplace(layer->baseImpl->id, LayerRenderData{.bucket = bucket, .layerProperties = layer});
-            }
+    // Join in group order, so the feature index is filled deterministically.
+    for (auto& job : bucketJobs) {
+        const style::Layer::Impl& leaderImpl = *(job.group->at(0)->baseImpl);
+        std::span<const FeatureIndex::RingEnvelope> envelopes = job.envelopes;
+        for (const auto& [index, envelopeCount] : job.features) {
+            featureIndex->insert(envelopes.first(envelopeCount), index, leaderImpl.sourceLayer, leaderImpl.id);
+            envelopes = envelopes.subspan(envelopeCount);
+        }
+
+        if (!job.bucket->hasData()) {
+            continue;
+        }
+
+        for (const auto& layer : *job.group) {
+            renderData.emplace(layer->baseImpl->id, LayerRenderData{.bucket = job.bucket, .layerProperties = layer});
         }
     }
 
@@ -522,6 +647,28 @@ void GeometryTileWorker::parse() {
     finalizeLayout();
 }
 
+bool GeometryTileWorker::abandonIfCancelled(std::chrono::duration<double> workStart, uint64_t workEpoch) {
+    if (!cancellation.isCancelledSince(workEpoch)) {
+        return false;
+    }
+
+    if (stats) {
+        stats->addAbandoned(util::MonotonicTimer::now() - workStart);
+    }
+    discardResult();
+    return true;
+}
+
+void GeometryTileWorker::discardResult() {
+    // A partial result is of no use, suspended tiles have to start over when resumed.
+    // The suspension may have been lifted in the meantime, in which case a resume
+    // message is on its way.
+    suspendedWork = !cancellation.isAbandoned();
+    featureIndex.reset();
+    renderData.clear();
+    layouts.clear();
+}
+
 bool GeometryTileWorker::hasPendingDependencies() const {
     for (auto& glyphDependency : pendingGlyphDependencies.glyphs) {
         if (!glyphDependency.second.empty()) {
@@ -542,7 +689,18 @@ void GeometryTileWorker::finalizeLayout() {
         return;
     }
 
+    if (cancellation.isCancelled()) {
+        // No layout work was done yet, so there's nothing to count as abandoned
+        discardResult();
+        return;
+    }
+
     MBGL_TIMING_START(watch);
+    const auto layoutStart = util::MonotonicTimer::now();
+    const auto layoutEpoch = cancellation.getEpoch();
+
+    const util::MonotonicArena::Scope arenaScope(scratchArena());
+
     gfx::ImageAtlas imageAtlas;
     gfx::GlyphAtlas glyphAtlas;
     if (dynamicTextureAtlas) {
@@ -554,14 +712,17 @@ void GeometryTileWorker::finalizeLayout() {
         }
 
         for (auto& layout : layouts) {
-            if (obsolete) {
-                dynamicTextureAtlas->removeTextures(glyphAtlas.textureHandles, glyphAtlas.dynamicTexture);
-                dynamicTextureAtlas->removeTextures(imageAtlas.textureHandles, imageAtlas.dynamicTexture);
+            // Stops early when the tile gets cancelled, leaving the layout incomplete.
+            layout->prepareSymbols(glyphMap, glyphAtlas.glyphPositions, iconMap, imageAtlas.iconPositions);
+
+            if (abandonIfCancelled(layoutStart, layoutEpoch)) {
+                if (dynamicTextureAtlas) {
+                    dynamicTextureAtlas->removeTextures(glyphAtlas.textureHandles, glyphAtlas.dynamicTexture);
+                    dynamicTextureAtlas->removeTextures(imageAtlas.textureHandles, imageAtlas.dynamicTexture);
+                }
                 return;
             }
 
-            layout->prepareSymbols(glyphMap, glyphAtlas.glyphPositions, iconMap, imageAtlas.iconPositions);
-
             if (!layout->hasSymbolInstances()) {
                 continue;
             }
@@ -12,9 +12,11 @@
 #include <mbgl/renderer/bucket.hpp>
 #include <mbgl/renderer/render_layer.hpp>
 #include <mbgl/tile/tile.hpp>
+#include <mbgl/tile/tile_worker_stats.hpp>
+#include <mbgl/util/cancellation_token.hpp>
 #include <mbgl/util/containers.hpp>
 
-#include <atomic>
+#include <chrono>
 #include <memory>
 
 namespace mbgl {
@@ -39,12 +41,13 @@ public:
                        const TaggedScheduler& scheduler_,
                        OverscaledTileID,
                        std::string,
-                       const std::atomic<bool>&,
+                       const util::CancellationToken&,
                        MapMode,
                        float pixelRatio,
                        bool showCollisionBoxes_,
                        gfx::DynamicTextureAtlasPtr,
-                       std::shared_ptr<FontFaces> fontFaces);
+                       std::shared_ptr<FontFaces> fontFaces,
+                       TileWorkerStatsPtr stats);
     ~GeometryTileWorker();
 
     void setLayers(std::vector<Immutable<style::LayerProperties>>,
@@ -55,6 +58,8 @@ public:
                  uint64_t correlationID);
     void reset(uint64_t correlationID_);
     void setShowCollisionBoxes(bool showCollisionBoxes_, uint64_t correlationID_);
+    // Restarts work that was dropped while the tile was suspended.
+    void resume();
 
     void onGlyphsAvailable(GlyphMap glyphs, HBShapeResults requests);
 
@@ -79,13 +84,19 @@ private:
 
     void checkPatternLayout(std::unique_ptr<Layout> layout);
 
+    // Cancellation checkpoint. Returns true, after discarding any partial
+    // parse result, if the tile was cancelled since the work started at
+    // `workEpoch`, even if the cancellation was lifted again.
+    bool abandonIfCancelled(std::chrono::duration<double> workStart, uint64_t workEpoch);
+    void discardResult();
+
     OptionalActorRef<GeometryTileWorker> self;
     OptionalActorRef<GeometryTile> parent;
     TaggedScheduler scheduler;
 
     const OverscaledTileID id;
     const std::string sourceID;
-    const std::atomic<bool>& obsolete;
+    const util::CancellationToken& cancellation;
     const MapMode mode;
     const float pixelRatio;
 
@@ -119,10 +130,14 @@ private:
 
     bool showCollisionBoxes;
     bool firstLoad = true;
+    // Set when work was dropped because the tile got suspended.
+    bool suspendedWork = false;
 
     gfx::DynamicTextureAtlasPtr dynamicTextureAtlas;
 
     std::shared_ptr<FontFaces> fontFaces;
+
+    TileWorkerStatsPtr stats;
 };
 
 } // namespace mbgl
@@ -3,6 +3,7 @@
 #include <mbgl/renderer/buckets/hillshade_bucket.hpp>
 #include <mbgl/actor/actor.hpp>
 #include <mbgl/util/premultiply.hpp>
+#include <mbgl/util/scheduler_telemetry.hpp>
 
 namespace mbgl {
 
@@ -19,6 +20,7 @@ void RasterDEMTileWorker::parse(const std::shared_ptr<const std::string>& data,
     }
 
     try {
+        const util::TaskTimer taskTimer(util::TaskCategory::ImageDecode);
         auto bucket = std::make_unique<HillshadeBucket>(decodeImage(*data), encoding);
         parent.invoke(&RasterDEMTile::onParsed, std::move(bucket), correlationID);
     } catch (...) {
@@ -3,6 +3,7 @@
 #include <mbgl/renderer/buckets/raster_bucket.hpp>
 #include <mbgl/actor/actor.hpp>
 #include <mbgl/util/premultiply.hpp>
+#include <mbgl/util/scheduler_telemetry.hpp>
 
 namespace mbgl {
 
@@ -17,6 +18,7 @@ void RasterTileWorker::parse(const std::shared_ptr<const std::string>& data, uin
     }
 
     try {
+        const util::TaskTimer taskTimer(util::TaskCategory::ImageDecode);
         auto bucket = std::make_unique<RasterBucket>(decodeImage(*data));
         parent.invoke(&RasterTile::onParsed, std::move(bucket), correlationID);
     } catch (...) {
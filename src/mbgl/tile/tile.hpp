@@ -38,10 +38,13 @@ class UploadPass;
 struct TileUpdateParameters {
     Duration minimumUpdateInterval;
     bool isVolatile;
+    // The tile is only loaded in anticipation of camera movement.
+    bool isPrefetch = false;
 };
 
 inline bool operator==(const TileUpdateParameters& a, const TileUpdateParameters& b) {
-    return a.minimumUpdateInterval == b.minimumUpdateInterval && a.isVolatile == b.isVolatile;
+    return a.minimumUpdateInterval == b.minimumUpdateInterval && a.isVolatile == b.isVolatile &&
+           a.isPrefetch == b.isPrefetch;
 }
 
 inline bool operator!=(const TileUpdateParameters& a, const TileUpdateParameters& b) {
@@ -66,6 +69,10 @@ public:
 
     virtual void setNecessity(TileNecessity) {}
 
+    // Notifies this tile whether it is part of the current tile cover. Tiles
+    // outside of it may suspend pending work until they are needed again.
+    virtual void setVisible(bool) {}
+
     virtual void setUpdateParameters(const TileUpdateParameters&) {}
 
     // Mark this tile as no longer needed and cancel any pending work.
@@ -132,7 +139,11 @@ public:
     // placement and will have time to finish by the second placement.
     virtual void performedFadePlacement() {}
 
-    virtual void setFeatureState(const LayerFeatureStates&) {}
+    /// Applies feature states, which are either changes to the ones applied before or all of them.
+    /// `version` identifies the resulting states.
+    virtual void setFeatureState(const LayerFeatureStates&, uint64_t /*version*/) {}
+    /// Version of the feature states last applied, or 0 if none are.
+    virtual uint64_t getFeatureStateVersion() const { return 0; }
 
     void dumpDebugLogs() const;
 
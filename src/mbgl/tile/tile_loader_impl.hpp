@@ -200,6 +200,7 @@ void TileLoader<T>::loadFromNetwork() {
     resource.minimumUpdateInterval = updateParameters.minimumUpdateInterval;
     resource.storagePolicy = updateParameters.isVolatile ? Resource::StoragePolicy::Volatile
                                                          : Resource::StoragePolicy::Permanent;
+    resource.priority = updateParameters.isPrefetch ? Resource::Priority::Low : Resource::Priority::Regular;
 
     request = fileSource->request(resource, [this, shared_{shared}](const Response& res) {
         do {
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+
+namespace mbgl {
+
+/// Counters shared between a renderer and the workers parsing its tiles, tracking the work
+/// which was cut short because the tile was dropped or moved out of view while parsing.
+class TileWorkerStats {
+public:
+    /// Parses which were started and then abandoned at a cancellation checkpoint
+    std::atomic<std::uint64_t> abandonedParses{0};
+    /// Parses which were cancelled before doing any work
+    std::atomic<std::uint64_t> skippedParses{0};
+    /// Worker time spent in abandoned parses before they noticed the cancellation
+    std::atomic<std::int64_t> abandonedParseNanoseconds{0};
+
+    void addAbandoned(std::chrono::duration<double> elapsed) {
+        abandonedParses++;
+        abandonedParseNanoseconds += std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+    }
+
+    std::chrono::duration<double> getAbandonedParseTime() const {
+        return std::chrono::nanoseconds(abandonedParseNanoseconds.load());
+    }
+};
+
+using TileWorkerStatsPtr = std::shared_ptr<TileWorkerStats>;
+
+} // namespace mbgl
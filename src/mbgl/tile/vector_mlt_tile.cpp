@@ -25,7 +25,7 @@ VectorMLTTile::~VectorMLTTile() {
 }
 
 void VectorMLTTile::setData(const std::shared_ptr<const std::string>& data_) {
-    if (!obsolete) {
+    if (!cancellation.isAbandoned()) {
         GeometryTile::setData(data_ ? std::make_unique<VectorMLTTileData>(data_) : nullptr);
     }
 }
@@ -25,7 +25,7 @@ VectorMVTTile::~VectorMVTTile() {
 }
 
 void VectorMVTTile::setData(const std::shared_ptr<const std::string>& data_) {
-    if (!obsolete) {
+    if (!cancellation.isAbandoned()) {
         GeometryTile::setData(data_ ? std::make_unique<VectorMVTTileData>(data_) : nullptr);
     }
 }
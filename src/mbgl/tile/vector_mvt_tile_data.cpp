@@ -3,6 +3,10 @@
 #include <mbgl/util/constants.hpp>
 #include <mbgl/util/instrumentation.hpp>
 #include <mbgl/util/logging.hpp>
+#include <mbgl/util/monotonic_arena.hpp>
+
+#include <cmath>
+#include <stdexcept>
 
 #if ANDROID
 #include <mlt/decoder.hpp>
@@ -10,8 +14,114 @@
 
 namespace mbgl {
 
-VectorMVTTileFeature::VectorMVTTileFeature(const mapbox::vector_tile::layer& layer, const protozero::data_view& view)
-    : feature(view, layer) {}
+namespace {
+
+// Field numbers from the vector tile specification.
+enum : protozero::pbf_tag_type {
+    LayerKeys = 3,
+    LayerValues = 4,
+    FeatureTags = 2,
+    FeatureGeometry = 4,
+};
+
+enum : uint32_t {
+    CommandMoveTo = 1,
+    CommandLineTo = 2,
+    CommandClosePath = 7,
+};
+
+Value decodeValue(const protozero::data_view& view) {
+    protozero::pbf_reader reader(view);
+    while (reader.next()) {
+        switch (reader.tag()) {
+            case 1:
+                return reader.get_string();
+            case 2:
+                return static_cast<double>(reader.get_float());
+            case 3:
+                return reader.get_double();
+            case 4:
+                return reader.get_int64();
+            case 5:
+                return reader.get_uint64();
+            case 6:
+                return reader.get_sint64();
+            case 7:
+                return reader.get_bool();
+            default:
+                reader.skip();
+        }
+    }
+    return NullValue{};
+}
+
+// Decodes the command stream of a line or polygon feature into a flat list of
+// coordinates, recording where each ring ends. Produces the same rings as
+// `mapbox::vector_tile::feature::getGeometries`, including closing polygon
+// rings by repeating their first point.
+void decodeRings(const protozero::data_view& featureData,
+                 float scale,
+                 util::ArenaVector<GeometryCoordinate>& coordinates,
+                 util::ArenaVector<std::size_t>& ringEnds) {
+    protozero::pbf_reader reader(featureData);
+    if (!reader.next(FeatureGeometry)) {
+        return;
+    }
+
+    const auto commands = reader.get_packed_uint32();
+    auto it = commands.begin();
+    const auto end = commands.end();
+
+    std::size_t ringStart = 0;
+    int64_t x = 0;
+    int64_t y = 0;
+
+    auto finishRing = [&] {
+        if (coordinates.size() > ringStart) {
+            ringEnds.push_back(coordinates.size());
+            ringStart = coordinates.size();
+        }
+    };
+
+    while (it != end) {
+        const uint32_t commandAndCount = *it++;
+        const uint32_t command = commandAndCount & 0x7;
+        const uint32_t count = commandAndCount >> 3;
+
+        if (command == CommandMoveTo || command == CommandLineTo) {
+            for (uint32_t i = 0; i < count; ++i) {
+                if (it == end) {
+                    throw std::runtime_error("unterminated geometry command");
+                }
+                x += protozero::decode_zigzag32(*it++);
+                if (it == end) {
+                    throw std::runtime_error("unterminated geometry command");
+                }
+                y += protozero::decode_zigzag32(*it++);
+
+                if (command == CommandMoveTo) {
+                    finishRing();
+                }
+                coordinates.emplace_back(static_cast<int16_t>(std::round(static_cast<float>(x) * scale)),
+                                         static_cast<int16_t>(std::round(static_cast<float>(y) * scale)));
+            }
+        } else if (command == CommandClosePath) {
+            if (coordinates.size() > ringStart) {
+                coordinates.push_back(coordinates[ringStart]);
+            }
+        } else {
+            throw std::runtime_error("unknown geometry command");
+        }
+    }
+    finishRing();
+}
+
+} // namespace
+
+VectorMVTTileFeature::VectorMVTTileFeature(const VectorMVTTileLayer& layer_, const protozero::data_view& view)
+    : layer(layer_),
+      data(view),
+      feature(view, layer_.layer) {}
 
 FeatureType VectorMVTTileFeature::getType() const {
     switch (feature.getType()) {
@@ -62,22 +172,110 @@ const GeometryCollection& VectorMVTTileFeature::getGeometries() const {
     return *lines;
 }
 
+std::optional<Value> VectorMVTTileFeature::getValueByKey(const PropertyKey& key) const {
+    // All layer objects wrapping the same data share their key table.
+    const auto keyIndex = key.resolve(layer.keys.empty() ? nullptr : layer.keys.front().data(),
+                                      [&](const std::string& name) { return layer.getKeyIndex(name); });
+    if (!keyIndex) {
+        return std::nullopt;
+    }
+
+    protozero::pbf_reader reader(data);
+    while (reader.next(FeatureTags)) {
+        const auto tags = reader.get_packed_uint32();
+        for (auto it = tags.begin(); it != tags.end();) {
+            const uint32_t tagKey = *it++;
+            if (it == tags.end()) {
+                break;
+            }
+            const uint32_t tagValue = *it++;
+            if (tagKey == *keyIndex) {
+                return layer.getValue(tagValue);
+            }
+        }
+    }
+    return std::nullopt;
+}
+
+void VectorMVTTileFeature::visitGeometries(const std::function<void(GeometryRingsView)>& visitor) const {
+    MLN_TRACE_FUNC();
+
+    // Version 1 polygons need to be fixed up, and points aren't worth
+    // streaming, so those use the cached collection.
+    const auto type = feature.getType();
+    if (lines || feature.getVersion() < 2 ||
+        (type != mapbox::vector_tile::GeomType::LINESTRING && type != mapbox::vector_tile::GeomType::POLYGON)) {
+        GeometryTileFeature::visitGeometries(visitor);
+        return;
+    }
+
+    util::ArenaVector<GeometryCoordinate> coordinates;
+    util::ArenaVector<std::size_t> ringEnds;
+    try {
+        decodeRings(data, static_cast<float>(util::EXTENT) / feature.getExtent(), coordinates, ringEnds);
+    } catch (const std::runtime_error& ex) {
+        Log::Error(Event::ParseTile, "Could not get geometries: " + std::string(ex.what()));
+        coordinates.clear();
+        ringEnds.clear();
+    }
+
+    util::ArenaVector<GeometryCoordinatesView> rings;
+    rings.reserve(ringEnds.size());
+    std::size_t ringStart = 0;
+    for (const std::size_t ringEnd : ringEnds) {
+        rings.emplace_back(coordinates.data() + ringStart, ringEnd - ringStart);
+        ringStart = ringEnd;
+    }
+    visitor(rings);
+}
+
 VectorMVTTileLayer::VectorMVTTileLayer(std::shared_ptr<const std::string> data_, const protozero::data_view& view)
     : data(std::move(data_)),
-      layer(view) {}
+      layer(view) {
+    protozero::pbf_reader reader(view);
+    while (reader.next()) {
+        switch (reader.tag()) {
+            case LayerKeys:
+                keys.push_back(reader.get_view());
+                break;
+            case LayerValues:
+                values.push_back(reader.get_view());
+                break;
+            default:
+                reader.skip();
+        }
+    }
+}
 
 std::size_t VectorMVTTileLayer::featureCount() const {
     return layer.featureCount();
 }
 
 std::unique_ptr<GeometryTileFeature> VectorMVTTileLayer::getFeature(std::size_t i) const {
-    return std::make_unique<VectorMVTTileFeature>(layer, layer.getFeature(i));
+    return std::make_unique<VectorMVTTileFeature>(*this, layer.getFeature(i));
 }
 
 std::string VectorMVTTileLayer::getName() const {
     return layer.getName();
 }
 
+std::optional<std::size_t> VectorMVTTileLayer::getKeyIndex(const std::string& key) const {
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+        if (keys[i] == protozero::data_view{key.data(), key.size()}) {
+            return i;
+        }
+    }
+    return std::nullopt;
+}
+
+std::optional<Value> VectorMVTTileLayer::getValue(std::size_t valueIndex) const {
+    if (valueIndex >= values.size()) {
+        return std::nullopt;
+    }
+    auto value = decodeValue(values[valueIndex]);
+    return value.is<NullValue>() ? std::nullopt : std::optional<Value>{std::move(value)};
+}
+
 VectorMVTTileData::VectorMVTTileData(std::shared_ptr<const std::string> data_)
     : data(std::move(data_)) {}
 
@@ -20,17 +20,23 @@
 
 namespace mbgl {
 
+class VectorMVTTileLayer;
+
 class VectorMVTTileFeature : public GeometryTileFeature {
 public:
-    VectorMVTTileFeature(const mapbox::vector_tile::layer&, const protozero::data_view&);
+    VectorMVTTileFeature(const VectorMVTTileLayer&, const protozero::data_view&);
 
     FeatureType getType() const override;
     std::optional<Value> getValue(const std::string& key) const override;
     const PropertyMap& getProperties() const override;
     FeatureIdentifier getID() const override;
     const GeometryCollection& getGeometries() const override;
+    std::optional<Value> getValueByKey(const PropertyKey&) const override;
+    void visitGeometries(const std::function<void(GeometryRingsView)>&) const override;
 
 private:
+    const VectorMVTTileLayer& layer;
+    const protozero::data_view data;
     mapbox::vector_tile::feature feature;
     mutable std::optional<GeometryCollection> lines;
     mutable std::optional<PropertyMap> properties;
@@ -44,9 +50,18 @@ public:
     std::unique_ptr<GeometryTileFeature> getFeature(std::size_t i) const override;
     std::string getName() const override;
 
+    std::optional<std::size_t> getKeyIndex(const std::string& key) const;
+    std::optional<Value> getValue(std::size_t valueIndex) const;
+
 private:
+    friend class VectorMVTTileFeature;
+
     std::shared_ptr<const std::string> data;
     mapbox::vector_tile::layer layer;
+
+    // The raw key and value tables, for lookups by index.
+    std::vector<protozero::data_view> keys;
+    std::vector<protozero::data_view> values;
 };
 
 class VectorMVTTileData : public GeometryTileData {
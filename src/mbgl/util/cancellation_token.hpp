@@ -0,0 +1,55 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace mbgl {
+namespace util {
+
+/// Lets the owner of some background work signal that its result is not wanted (anymore).
+///
+/// Work is either abandoned for good, e.g. because the owner is being destroyed, or suspended
+/// while the result isn't needed right now and may be asked for again later. Long-running jobs
+/// poll `isCancelled()` at convenient checkpoints and bail out early.
+class CancellationToken {
+public:
+    /// Permanently cancels the work. Cannot be undone.
+    void abandon() noexcept {
+        if (!abandoned.exchange(true)) {
+            epoch++;
+        }
+    }
+
+    /// Suspends or resumes the work.
+    /// @return Whether the suspended state changed.
+    bool setSuspended(bool value) noexcept {
+        if (suspended.exchange(value) == value) {
+            return false;
+        }
+        if (value) {
+            // Counted before the suspension can be lifted again
+            epoch++;
+        }
+        return true;
+    }
+
+    bool isAbandoned() const noexcept { return abandoned.load(); }
+    bool isSuspended() const noexcept { return suspended.load(); }
+    bool isCancelled() const noexcept { return isAbandoned() || isSuspended(); }
+
+    /// Number of times the work was cancelled. Work that stops early when it finds itself
+    /// cancelled compares it with the value from its start, as the suspension may have been
+    /// lifted again before it checks whether to discard its partial result.
+    std::uint64_t getEpoch() const noexcept { return epoch.load(); }
+    bool isCancelledSince(std::uint64_t startEpoch) const noexcept {
+        return isCancelled() || getEpoch() != startEpoch;
+    }
+
+private:
+    std::atomic<bool> abandoned{false};
+    std::atomic<bool> suspended{false};
+    std::atomic<std::uint64_t> epoch{0};
+};
+
+} // namespace util
+} // namespace mbgl
@@ -0,0 +1,131 @@
+#include <mbgl/util/monotonic_arena.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+
+namespace mbgl {
+namespace util {
+
+namespace {
+thread_local MonotonicArena* currentArena = nullptr;
+} // namespace
+
+MonotonicArena::MonotonicArena(std::size_t blockSize_)
+    : blockSize(std::max<std::size_t>(blockSize_, alignof(std::max_align_t))) {}
+
+MonotonicArena::~MonotonicArena() {
+    assert(currentArena != this);
+}
+
+void* MonotonicArena::allocate(std::size_t bytes, std::size_t alignment) {
+    assert(alignment != 0 && (alignment & (alignment - 1)) == 0);
+    assert(alignment <= alignof(std::max_align_t));
+
+    auto align = [&](std::byte* p) {
+        const auto address = reinterpret_cast<std::uintptr_t>(p);
+        return p + ((alignment - (address & (alignment - 1))) & (alignment - 1));
+    };
+
+    std::byte* result = cursor ? align(cursor) : nullptr;
+    if (!result || static_cast<std::size_t>(end - result) < bytes) {
+        nextBlock(bytes);
+        result = align(cursor);
+    }
+
+    cursor = result + bytes;
+    allocated += bytes;
+    return result;
+}
+
+void MonotonicArena::reset() {
+    allocated = 0;
+    activeBlock = 0;
+    if (blocks.empty()) {
+        cursor = end = nullptr;
+        return;
+    }
+
+    // Keep the largest block that is still reasonably sized, so a parse of
+    // similar size fits into a single block next time.
+    auto keep = blocks.end();
+    for (auto it = blocks.begin(); it != blocks.end(); ++it) {
+        if (it->size <= maxRetainedBlockSize && (keep == blocks.end() || it->size > keep->size)) {
+            keep = it;
+        }
+    }
+
+    if (keep == blocks.end()) {
+        blocks.clear();
+        cursor = end = nullptr;
+    } else {
+        Block retained = std::move(*keep);
+        blocks.clear();
+        cursor = retained.data.get();
+        end = cursor + retained.size;
+        blocks.push_back(std::move(retained));
+    }
+}
+
+void MonotonicArena::rewind(const Mark& mark) {
+    assert(mark.allocated <= allocated);
+    if (mark.allocated == 0) {
+        reset();
+        return;
+    }
+
+    assert(mark.cursor && mark.block <= activeBlock);
+    activeBlock = mark.block;
+    cursor = mark.cursor;
+    end = blocks[activeBlock].data.get() + blocks[activeBlock].size;
+    allocated = mark.allocated;
+}
+
+void MonotonicArena::nextBlock(std::size_t minSize) {
+    const std::size_t required = minSize + alignof(std::max_align_t);
+    const std::size_t next = cursor ? activeBlock + 1 : 0;
+
+    // Blocks past the active one are left over from a rewind, and empty.
+    if (next >= blocks.size() || blocks[next].size < required) {
+        // Grow geometrically so that large parses need few blocks, and always
+        // leave room for the worst-case alignment padding.
+        const std::size_t size = std::max(next == 0 ? blockSize : blocks[next - 1].size * 2, required);
+
+        // `new std::byte[]` guarantees alignment for `std::max_align_t`, which is
+        // the strictest alignment the arena hands out. Not value-initialized on purpose.
+        blocks.insert(blocks.begin() + next, Block{std::unique_ptr<std::byte[]>(new std::byte[size]), size});
+    }
+
+    activeBlock = next;
+    cursor = blocks[next].data.get();
+    end = cursor + blocks[next].size;
+}
+
+MonotonicArena* MonotonicArena::current() {
+    return currentArena;
+}
+
+MonotonicArena::Scope::Scope(MonotonicArena& arena_)
+    : arena(arena_),
+      previous(currentArena),
+      start(arena_.mark()) {
+    currentArena = &arena;
+}
+
+MonotonicArena::Scope::~Scope() {
+    arena.rewind(start);
+    currentArena = previous;
+}
+
+MonotonicArena::Checkpoint::Checkpoint()
+    : arena(currentArena),
+      start(arena ? arena->mark() : Mark{}) {}
+
+MonotonicArena::Checkpoint::~Checkpoint() {
+    if (arena) {
+        arena->rewind(start);
+    }
+}
+
+} // namespace util
+} // namespace mbgl
@@ -0,0 +1,89 @@
+#include <mbgl/util/parallel_for.hpp>
+#include <mbgl/util/instrumentation.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+
+namespace mbgl {
+namespace util {
+
+namespace {
+
+struct ParallelForState {
+    ParallelForState(std::size_t count_, const std::function<void(std::size_t)>& fn_)
+        : count(count_),
+          fn(fn_) {}
+
+    const std::size_t count;
+    // Only dereferenced for claimed items, all of which complete before `parallelFor` returns.
+    const std::function<void(std::size_t)>& fn;
+
+    std::atomic<std::size_t> next{0};
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::size_t finished = 0;
+    std::exception_ptr error;
+
+    void drain() {
+        for (std::size_t i = next++; i < count; i = next++) {
+            std::exception_ptr failure;
+            try {
+                fn(i);
+            } catch (...) {
+                failure = std::current_exception();
+            }
+
+            std::scoped_lock lock(mutex);
+            if (failure && !error) {
+                error = std::move(failure);
+            }
+            if (++finished == count) {
+                cv.notify_all();
+            }
+        }
+    }
+};
+
+} // namespace
+
+void parallelFor(TaggedScheduler& scheduler,
+                 std::size_t count,
+                 std::size_t maxHelpers,
+                 const std::function<void(std::size_t)>& fn) {
+    MLN_TRACE_FUNC();
+
+    if (count == 0) {
+        return;
+    }
+
+    const auto helpers = std::min(maxHelpers, count - 1);
+    if (helpers == 0) {
+        for (std::size_t i = 0; i < count; ++i) {
+            fn(i);
+        }
+        return;
+    }
+
+    auto state = std::make_shared<ParallelForState>(count, fn);
+    for (std::size_t i = 0; i < helpers; ++i) {
+        scheduler.schedule([state] {
+            MLN_TRACE_ZONE(parallelFor helper);
+            state->drain();
+        });
+    }
+
+    state->drain();
+
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->cv.wait(lock, [&] { return state->finished == state->count; });
+    if (state->error) {
+        std::rethrow_exception(state->error);
+    }
+}
+
+} // namespace util
+} // namespace mbgl
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <mbgl/actor/scheduler.hpp>
+
+#include <cstddef>
+#include <functional>
+
+namespace mbgl {
+namespace util {
+
+/// @brief Run `fn(i)` for every `i` in `[0, count)`, sharing the work between the calling thread and
+/// up to `maxHelpers` tasks submitted to `scheduler`.
+///
+/// The calling thread always takes part in the work and only waits for items that a helper has already
+/// claimed, so this is safe to call from a task running on the same scheduler even if every other
+/// thread is busy. Helpers which start after all items were claimed return without touching `fn`.
+/// If any invocation throws, the first exception is re-thrown on the calling thread once all claimed
+/// items have finished.
+void parallelFor(TaggedScheduler& scheduler,
+                 std::size_t count,
+                 std::size_t maxHelpers,
+                 const std::function<void(std::size_t)>& fn);
+
+} // namespace util
+} // namespace mbgl
@@ -0,0 +1,197 @@
+#include <mbgl/util/scheduler_telemetry.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+
+namespace mbgl {
+namespace util {
+
+namespace {
+
+std::int64_t toNanoseconds(std::chrono::duration<double> duration) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+}
+
+// Start of the calling worker thread, as registered with `threadStarted()`.
+thread_local std::int64_t threadStartTime = 0;
+
+std::int64_t nowNanoseconds() {
+    return toNanoseconds(MonotonicTimer::now());
+}
+
+void writeHistogram(std::ostream& out,
+                    const std::string& name,
+                    const std::string& labels,
+                    const DurationHistogram::Snapshot& histogram) {
+    const std::string separator = labels.empty() ? "" : ",";
+    uint64_t cumulative = 0;
+    for (std::size_t i = 0; i < DurationHistogram::bounds.size(); ++i) {
+        cumulative += histogram.counts[i];
+        out << name << "_bucket{" << labels << separator << "le=\"" << DurationHistogram::bounds[i] << "\"} "
+            << cumulative << "\n";
+    }
+    out << name << "_bucket{" << labels << separator << "le=\"+Inf\"} " << histogram.count << "\n";
+    out << name << "_sum{" << labels << "} " << histogram.sum << "\n";
+    out << name << "_count{" << labels << "} " << histogram.count << "\n";
+}
+
+void writeHeader(std::ostream& out, const char* name, const char* type, const char* help) {
+    out << "# HELP " << name << " " << help << "\n";
+    out << "# TYPE " << name << " " << type << "\n";
+}
+
+} // namespace
+
+double DurationHistogram::Snapshot::quantile(double q) const {
+    if (count == 0) {
+        return 0.0;
+    }
+    const auto rank = static_cast<uint64_t>(std::ceil(std::clamp(q, 0.0, 1.0) * static_cast<double>(count)));
+    uint64_t cumulative = 0;
+    for (std::size_t i = 0; i < bounds.size(); ++i) {
+        cumulative += counts[i];
+        if (cumulative >= std::max<uint64_t>(rank, 1)) {
+            return bounds[i];
+        }
+    }
+    return std::numeric_limits<double>::infinity();
+}
+
+void DurationHistogram::record(std::chrono::duration<double> duration) {
+    const double seconds = duration.count();
+    const auto bucket = std::ranges::lower_bound(bounds, seconds) - bounds.begin();
+    counts[bucket].fetch_add(1, std::memory_order_relaxed);
+    sumNanoseconds.fetch_add(static_cast<uint64_t>(std::max<std::int64_t>(toNanoseconds(duration), 0)),
+                             std::memory_order_relaxed);
+}
+
+DurationHistogram::Snapshot DurationHistogram::snapshot() const {
+    Snapshot result;
+    for (std::size_t i = 0; i < counts.size(); ++i) {
+        result.counts[i] = counts[i].load(std::memory_order_relaxed);
+        result.count += result.counts[i];
+    }
+    result.sum = static_cast<double>(sumNanoseconds.load(std::memory_order_relaxed)) * 1e-9;
+    return result;
+}
+
+SchedulerTelemetry& SchedulerTelemetry::get() {
+    static SchedulerTelemetry telemetry;
+    return telemetry;
+}
+
+const char* SchedulerTelemetry::name(TaskCategory category) {
+    switch (category) {
+        case TaskCategory::TileParse:
+            return "tile_parse";
+        case TaskCategory::Glyph:
+            return "glyph";
+        case TaskCategory::ImageDecode:
+            return "image_decode";
+        case TaskCategory::Database:
+            return "database";
+    }
+    return "";
+}
+
+std::shared_ptr<SchedulerTelemetry::TagStats> SchedulerTelemetry::getTagStats(const SimpleIdentity& tag) {
+    std::scoped_lock lock(tagsMutex);
+    auto& stats = tags[tag.id()];
+    if (!stats) {
+        stats = std::make_shared<TagStats>();
+    }
+    return stats;
+}
+
+void SchedulerTelemetry::removeTag(const SimpleIdentity& tag) {
+    std::scoped_lock lock(tagsMutex);
+    tags.erase(tag.id());
+}
+
+void SchedulerTelemetry::recordTask(TaskCategory category, std::chrono::duration<double> duration) {
+    categories[static_cast<std::size_t>(category)].record(duration);
+}
+
+void SchedulerTelemetry::threadStarted() {
+    threadStartTime = nowNanoseconds();
+    runningThreadStarts += threadStartTime;
+    threads++;
+}
+
+void SchedulerTelemetry::threadStopped() {
+    threads--;
+    runningThreadStarts -= threadStartTime;
+    stoppedThreadNanoseconds += nowNanoseconds() - threadStartTime;
+}
+
+void SchedulerTelemetry::addBusyTime(std::chrono::duration<double> duration) {
+    busyNanoseconds.fetch_add(toNanoseconds(duration), std::memory_order_relaxed);
+}
+
+SchedulerTelemetry::Snapshot SchedulerTelemetry::snapshot() const {
+    Snapshot result;
+    {
+        std::scoped_lock lock(tagsMutex);
+        result.tags.reserve(tags.size());
+        for (const auto& [tag, stats] : tags) {
+            result.tags.push_back(
+                {.tag = tag, .queueLatency = stats->queueLatency.snapshot(), .execution = stats->execution.snapshot()});
+        }
+    }
+    std::ranges::sort(result.tags, {}, &Snapshot::Tag::tag);
+
+    for (std::size_t i = 0; i < TaskCategoryCount; ++i) {
+        result.categories[i] = categories[i].snapshot();
+    }
+
+    result.threads = threads;
+    result.busyTime = static_cast<double>(busyNanoseconds.load()) * 1e-9;
+    const auto threadNanoseconds = static_cast<std::int64_t>(result.threads) * nowNanoseconds() -
+                                   runningThreadStarts.load() + stoppedThreadNanoseconds.load();
+    result.threadTime = static_cast<double>(std::max<std::int64_t>(threadNanoseconds, 0)) * 1e-9;
+    return result;
+}
+
+std::string SchedulerTelemetry::toPrometheus() const {
+    const Snapshot stats = snapshot();
+    std::ostringstream out;
+    out << std::setprecision(9);
+
+    writeHeader(out,
+                "mbgl_scheduler_queue_latency_seconds",
+                "histogram",
+                "Time from scheduling a task to a worker thread starting it.");
+    for (const auto& tag : stats.tags) {
+        writeHistogram(
+            out, "mbgl_scheduler_queue_latency_seconds", "tag=\"" + std::to_string(tag.tag) + "\"", tag.queueLatency);
+    }
+
+    writeHeader(out, "mbgl_scheduler_task_duration_seconds", "histogram", "Time worker threads spent running a task.");
+    for (const auto& tag : stats.tags) {
+        writeHistogram(
+            out, "mbgl_scheduler_task_duration_seconds", "tag=\"" + std::to_string(tag.tag) + "\"", tag.execution);
+    }
+
+    writeHeader(out, "mbgl_task_duration_seconds", "histogram", "Time spent on a kind of work.");
+    for (std::size_t i = 0; i < TaskCategoryCount; ++i) {
+        writeHistogram(out,
+                       "mbgl_task_duration_seconds",
+                       std::string("category=\"") + name(static_cast<TaskCategory>(i)) + "\"",
+                       stats.categories[i]);
+    }
+
+    writeHeader(out, "mbgl_scheduler_threads", "gauge", "Worker threads running.");
+    out << "mbgl_scheduler_threads " << stats.threads << "\n";
+    writeHeader(out, "mbgl_scheduler_busy_seconds_total", "counter", "Time worker threads spent running tasks.");
+    out << "mbgl_scheduler_busy_seconds_total " << stats.busyTime << "\n";
+    writeHeader(out, "mbgl_scheduler_thread_seconds_total", "counter", "Time worker threads have existed.");
+    out << "mbgl_scheduler_thread_seconds_total " << stats.threadTime << "\n";
+
+    return out.str();
+}
+
+} // namespace util
+} // namespace mbgl
@@ -32,6 +32,9 @@ std::thread ThreadedSchedulerBase::makeSchedulerThread(size_t index) {
         platform::setCurrentThreadName("Worker " + util::toString(index + 1));
         platform::attachThread();
 
+        auto& telemetry = util::SchedulerTelemetry::get();
+        telemetry.threadStarted();
+
         owningThreadPool.set(this);
 
         while (true) {
@@ -41,6 +44,7 @@ std::thread ThreadedSchedulerBase::makeSchedulerThread(size_t index) {
             }
 
             if (terminated) {
+                telemetry.threadStopped();
                 platform::detachThread();
                 break;
             }
@@ -60,11 +64,13 @@ std::thread ThreadedSchedulerBase::makeSchedulerThread(size_t index) {
             // 2. Visit a task from each
             for (auto& q : pending) {
                 std::function<void()> tasklet;
+                std::chrono::duration<double> scheduledTime{};
                 {
                     std::scoped_lock lock(q->lock);
                     if (q->queue.size()) {
                         q->runningCount++;
-                        tasklet = std::move(q->queue.front());
+                        tasklet = std::move(q->queue.front().fn);
+                        scheduledTime = q->queue.front().scheduledTime;
                         q->queue.pop();
                     }
                     if (!tasklet) continue;
@@ -73,9 +79,18 @@ std::thread ThreadedSchedulerBase::makeSchedulerThread(size_t index) {
                 assert(taskCount > 0);
                 taskCount--;
 
+                const auto startTime = util::MonotonicTimer::now();
+                q->stats->queueLatency.record(startTime - scheduledTime);
+                const auto recordExecution = [&] {
+                    const auto executionTime = util::MonotonicTimer::now() - startTime;
+                    q->stats->execution.record(executionTime);
+                    telemetry.addBusyTime(executionTime);
+                };
+
                 try {
                     tasklet();
                     tasklet = {}; // destroy the function and release its captures before unblocking `waitForEmpty`
+                    recordExecution();
 
                     if (!--q->runningCount) {
                         std::scoped_lock lock(q->lock);
@@ -84,6 +99,7 @@ std::thread ThreadedSchedulerBase::makeSchedulerThread(size_t index) {
                         }
                     }
                 } catch (...) {
+                    recordExecution();
                     std::scoped_lock lock(q->lock);
                     if (handler) {
                         handler(std::current_exception());
@@ -124,6 +140,7 @@ void ThreadedSchedulerBase::schedule(const util::SimpleIdentity tag, std::functi
         if (result.second) {
             // new entry inserted
             result.first->second = std::make_shared<Queue>();
+            result.first->second->stats = util::SchedulerTelemetry::get().getTagStats(tag);
         }
         q = result.first->second;
 
@@ -133,7 +150,7 @@ void ThreadedSchedulerBase::schedule(const util::SimpleIdentity tag, std::functi
     {
         MLN_TRACE_ZONE(push);
         std::scoped_lock lock(q->lock);
-        q->queue.push(std::move(fn));
+        q->queue.push({.fn = std::move(fn), .scheduledTime = util::MonotonicTimer::now()});
         taskCount++;
     }
 
@@ -168,6 +185,7 @@ void ThreadedSchedulerBase::waitForEmpty(const util::SimpleIdentity tag) {
             std::scoped_lock lock(taggedQueueLock);
             taggedQueue.erase(tagToFind);
         }
+        util::SchedulerTelemetry::get().removeTag(tagToFind);
     }
 }
 
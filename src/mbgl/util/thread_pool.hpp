@@ -6,6 +6,7 @@
 #include <mbgl/util/containers.hpp>
 #include <mbgl/util/identity.hpp>
 #include <mbgl/util/instrumentation.hpp>
+#include <mbgl/util/scheduler_telemetry.hpp>
 
 #include <condition_variable>
 #include <mutex>
@@ -52,12 +53,18 @@ protected:
     std::atomic<size_t> taskCount{0};
     bool terminated{false};
 
+    struct Task {
+        std::function<void()> fn;
+        std::chrono::duration<double> scheduledTime;
+    };
+
     // Task queues bucketed by tag address
     struct Queue {
-        std::atomic<std::size_t> runningCount;   /* running tasks */
-        std::condition_variable cv;              /* queue empty condition */
-        std::mutex lock;                         /* lock */
-        std::queue<std::function<void()>> queue; /* pending task queue */
+        std::atomic<std::size_t> runningCount;                     /* running tasks */
+        std::condition_variable cv;                                /* queue empty condition */
+        std::mutex lock;                                           /* lock */
+        std::queue<Task> queue;                                    /* pending task queue */
+        std::shared_ptr<util::SchedulerTelemetry::TagStats> stats; /* telemetry of the tag */
     };
     mbgl::unordered_map<util::SimpleIdentity, std::shared_ptr<Queue>> taggedQueue;
 };
@@ -11,7 +11,8 @@ namespace vulkan {
 
 CommandEncoder::CommandEncoder(Context& context_, const vk::UniqueCommandBuffer& buffer_)
     : context(context_),
-      commandBuffer(buffer_) {}
+      primaryCommandBuffer(buffer_),
+      commandBuffer(&buffer_) {}
 
 CommandEncoder::~CommandEncoder() {}
 
@@ -33,11 +34,19 @@ void CommandEncoder::pushDebugGroup(const char* name) {
 }
 
 void CommandEncoder::pushDebugGroup(const char* name, const std::array<float, 4>& color) {
-    context.getBackend().beginDebugLabel(commandBuffer.get(), name, color);
+    if (commandBuffer != &primaryCommandBuffer) {
+        skippedDebugGroups++;
+        return;
+    }
+    context.getBackend().beginDebugLabel(commandBuffer->get(), name, color);
 }
 
 void CommandEncoder::popDebugGroup() {
-    context.getBackend().endDebugLabel(commandBuffer.get());
+    if (skippedDebugGroups > 0) {
+        skippedDebugGroups--;
+        return;
+    }
+    context.getBackend().endDebugLabel(commandBuffer->get());
 }
 
 } // namespace vulkan
@@ -253,6 +253,8 @@ void Context::beginFrame() {
     MLN_TRACE_FUNC();
     MBGL_VERIFY_THREAD(tid);
 
+    backend.onBeginFrame();
+
     frameResourceIndex = (frameResourceIndex + 1) % frameResources.size();
 
     const auto& device = backend.getDevice();
@@ -305,6 +307,11 @@ void Context::beginFrame() {
 
     frame.runDeletionQueue(*this);
 
+    for (auto& secondary : frame.secondaryCommandPools) {
+        device->resetCommandPool(secondary.pool.get(), {}, dispatcher);
+        secondary.used = 0;
+    }
+
     if (platformSurface) {
         MLN_TRACE_ZONE(acquireNextImageKHR);
         try {
@@ -395,6 +402,45 @@ void Context::submitFrame() {
     backend.endFrameCapture();
 }
 
+void Context::reserveSecondaryCommandPools(std::size_t count) {
+    auto& frame = frameResources[frameResourceIndex];
+    const auto& device = backend.getDevice();
+
+    while (frame.secondaryCommandPools.size() < count) {
+        const vk::CommandPoolCreateInfo createInfo(vk::CommandPoolCreateFlagBits::eTransient,
+                                                   backend.getGraphicsQueueIndex());
+        frame.secondaryCommandPools.push_back(
+            {.pool = device->createCommandPoolUnique(createInfo, nullptr, backend.getDispatcher())});
+    }
+}
+
+const vk::UniqueCommandBuffer& Context::beginSecondaryCommandBuffer(std::size_t poolIndex,
+                                                                    gfx::Renderable& renderable) {
+    auto& frame = frameResources[frameResourceIndex];
+    assert(poolIndex < frame.secondaryCommandPools.size());
+    auto& secondary = frame.secondaryCommandPools[poolIndex];
+    const auto& dispatcher = backend.getDispatcher();
+
+    if (secondary.used == secondary.buffers.size()) {
+        const vk::CommandBufferAllocateInfo allocateInfo(secondary.pool.get(), vk::CommandBufferLevel::eSecondary, 1);
+        auto buffers = backend.getDevice()->allocateCommandBuffersUnique(allocateInfo, dispatcher);
+        secondary.buffers.push_back(std::move(buffers.front()));
+    }
+
+    const auto& buffer = secondary.buffers[secondary.used++];
+    const auto& resource = renderable.getResource<RenderableResource>();
+    const auto inheritanceInfo = vk::CommandBufferInheritanceInfo()
+                                     .setRenderPass(resource.getRenderPass().get())
+                                     .setSubpass(0)
+                                     .setFramebuffer(resource.getFramebuffer().get());
+
+    buffer->begin(vk::CommandBufferBeginInfo(vk::CommandBufferUsageFlagBits::eOneTimeSubmit |
+                                             vk::CommandBufferUsageFlagBits::eRenderPassContinue)
+                      .setPInheritanceInfo(&inheritanceInfo),
+                  dispatcher);
+    return buffer;
+}
+
 std::unique_ptr<gfx::CommandEncoder> Context::createCommandEncoder() {
     const auto& frame = frameResources[frameResourceIndex];
     return std::make_unique<CommandEncoder>(*this, frame.commandBuffer);
@@ -524,6 +570,7 @@ void Context::bindGlobalUniformBuffers(gfx::RenderPass& renderPass) const noexce
     }
 
     context.globalUniformBuffers.bindDescriptorSets(renderPassImpl.getEncoder());
+    renderPassImpl.setGlobalUniformBuffers(&context.globalUniformBuffers);
 }
 
 bool Context::renderTileClippingMasks(gfx::RenderPass& renderPass,
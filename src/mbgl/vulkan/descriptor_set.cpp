@@ -128,7 +128,7 @@ void DescriptorSet::markDirty() {
     std::fill(dirty.begin(), dirty.end(), true);
 }
 
-void DescriptorSet::bind(CommandEncoder& encoder) {
+void DescriptorSet::bind(CommandEncoder& encoder) const {
     MLN_TRACE_FUNC();
     const auto& backend = encoder.getContext().getBackend();
     auto& commandBuffer = encoder.getCommandBuffer();
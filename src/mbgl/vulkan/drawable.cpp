@@ -239,28 +239,25 @@ void Drawable::upload(gfx::UploadPass& uploadPass_) {
 void Drawable::draw(PaintParameters& parameters) const {
     MLN_TRACE_FUNC();
 
-    if (isCustom) {
-        return;
-    }
+    if (!prepare(parameters)) return;
 
     auto& context = static_cast<Context&>(parameters.context);
-    auto& dispatcher = context.getBackend().getDispatcher();
     auto& renderPass_ = static_cast<RenderPass&>(*parameters.renderPass);
-    auto& encoder = renderPass_.getEncoder();
-    auto& commandBuffer = encoder.getCommandBuffer();
 
-    auto& shaderImpl = static_cast<mbgl::vulkan::ShaderProgram&>(*shader);
+    context.renderingStats().numDrawCalls += static_cast<int>(record(renderPass_.getEncoder()));
+}
 
-    if (!bindAttributes(encoder)) return;
-    if (!bindDescriptors(encoder)) return;
+bool Drawable::prepare(PaintParameters& parameters) const {
+    MLN_TRACE_FUNC();
 
-    commandBuffer->pushConstants(
-        context.getGeneralPipelineLayout().get(),
-        vk::ShaderStageFlags() | vk::ShaderStageFlagBits::eVertex | vk::ShaderStageFlagBits::eFragment,
-        0,
-        sizeof(uboIndex),
-        &uboIndex,
-        dispatcher);
+    if (isCustom || impl->vulkanVertexBuffers.empty()) {
+        return false;
+    }
+
+    auto& context = static_cast<Context&>(parameters.context);
+    auto& renderPass_ = static_cast<RenderPass&>(*parameters.renderPass);
+
+    if (!updateDescriptors(context)) return false;
 
     if (enableDepth) {
         if (impl->depthFor3D.has_value()) {
@@ -289,6 +286,30 @@ void Drawable::draw(PaintParameters& parameters) const {
     }
 
     impl->pipelineInfo.setRenderable(renderPass_.getDescriptor().renderable);
+    impl->pipelineInfo.setScissorRect(parameters.scissorRect);
+
+    return true;
+}
+
+std::size_t Drawable::record(CommandEncoder& encoder) const {
+    MLN_TRACE_FUNC();
+
+    auto& context = encoder.getContext();
+    auto& dispatcher = context.getBackend().getDispatcher();
+    auto& commandBuffer = encoder.getCommandBuffer();
+
+    auto& shaderImpl = static_cast<mbgl::vulkan::ShaderProgram&>(*shader);
+
+    bindAttributes(encoder);
+    bindDescriptors(encoder);
+
+    commandBuffer->pushConstants(
+        context.getGeneralPipelineLayout().get(),
+        vk::ShaderStageFlags() | vk::ShaderStageFlagBits::eVertex | vk::ShaderStageFlagBits::eFragment,
+        0,
+        sizeof(uboIndex),
+        &uboIndex,
+        dispatcher);
 
     const auto instances = instanceAttributes ? instanceAttributes->getMaxCount() : 1;
 
@@ -298,8 +319,6 @@ void Drawable::draw(PaintParameters& parameters) const {
         // update pipeline info with per segment modifiers
         impl->pipelineInfo.setDrawMode(seg->getMode());
 
-        impl->pipelineInfo.setScissorRect(parameters.scissorRect);
-
         impl->pipelineInfo.setDynamicValues(context.getBackend(), commandBuffer);
 
         const auto& pipeline = shaderImpl.getPipeline(impl->pipelineInfo);
@@ -319,9 +338,9 @@ void Drawable::draw(PaintParameters& parameters) const {
                                 0,
                                 dispatcher);
         }
-
-        context.renderingStats().numDrawCalls++;
     }
+
+    return impl->segments.size();
 }
 
 void Drawable::setIndexData(gfx::IndexVectorBasePtr indexes, std::vector<UniqueDrawSegment> segments) {
@@ -433,19 +452,18 @@ bool Drawable::bindAttributes(CommandEncoder& encoder) const noexcept {
     return true;
 }
 
-bool Drawable::bindDescriptors(CommandEncoder& encoder) const noexcept {
+bool Drawable::updateDescriptors(Context& context) const noexcept {
     MLN_TRACE_FUNC();
 
     if (!shader) return false;
 
-    // bind uniforms
-    impl->uniformBuffers.bindDescriptorSets(encoder);
+    impl->uniformBuffers.updateDescriptorSets(context);
 
     const auto& shaderImpl = static_cast<const mbgl::vulkan::ShaderProgram&>(*shader);
     if (shaderImpl.hasTextures()) {
         // update image set
         if (!impl->imageDescriptorSet) {
-            impl->imageDescriptorSet = std::make_unique<ImageDescriptorSet>(encoder.getContext());
+            impl->imageDescriptorSet = std::make_unique<ImageDescriptorSet>(context);
         }
 
         for (const auto& texture : textures) {
@@ -458,12 +476,22 @@ bool Drawable::bindDescriptors(CommandEncoder& encoder) const noexcept {
         }
 
         impl->imageDescriptorSet->update(textures);
-        impl->imageDescriptorSet->bind(encoder);
     }
 
     return true;
 }
 
+void Drawable::bindDescriptors(CommandEncoder& encoder) const noexcept {
+    MLN_TRACE_FUNC();
+
+    impl->uniformBuffers.bindUpdatedDescriptorSets(encoder);
+
+    const auto& shaderImpl = static_cast<const mbgl::vulkan::ShaderProgram&>(*shader);
+    if (shaderImpl.hasTextures()) {
+        impl->imageDescriptorSet->bind(encoder);
+    }
+}
+
 void Drawable::uploadTextures(UploadPass&) const noexcept {
     MLN_TRACE_FUNC();
     for (const auto& texture : textures) {
@@ -118,48 +118,52 @@ DynamicTexture::~DynamicTexture() {
 
 void DynamicTexture::uploadImage(const uint8_t* pixelData, gfx::TextureHandle& texHandle) {
     std::scoped_lock lock(mutex);
-    const auto& rect = texHandle.getRectangle();
+    stageImage(pixelData, texHandle.getRectangle());
+
+    gfx::DynamicTexture::uploadImage(pixelData, texHandle);
+}
+
+void DynamicTexture::uploadDeferredImages() {
+    std::scoped_lock lock(mutex);
+
+    // Images packed next to each other are copied from one staging buffer
+    const auto regions = takeStagedRegions();
+    if (regions.empty()) {
+        return;
+    }
 
     const auto& backend = context.getBackend();
     const auto& allocator = backend.getAllocator();
 
-    const auto bufferInfo = vk::BufferCreateInfo()
-                                .setSize(static_cast<vk::DeviceSize>(rect.w) * rect.h * texture->getPixelStride())
-                                .setUsage(vk::BufferUsageFlagBits::eTransferSrc)
-                                .setSharingMode(vk::SharingMode::eExclusive);
-
     VmaAllocationCreateInfo allocationInfo = {};
-
     allocationInfo.usage = VMA_MEMORY_USAGE_AUTO_PREFER_HOST;
     allocationInfo.requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
     allocationInfo.flags = VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT | VMA_ALLOCATION_CREATE_MAPPED_BIT;
 
-    UniqueBufferAllocation bufferAllocation = std::make_unique<BufferAllocation>(allocator);
-    if (!bufferAllocation->create(allocationInfo, bufferInfo)) {
-        mbgl::Log::Error(mbgl::Event::Render, "Vulkan texture buffer allocation failed");
-        return;
-    }
-
-    vmaMapMemory(allocator, bufferAllocation->allocation, &bufferAllocation->mappedBuffer);
-    memcpy(bufferAllocation->mappedBuffer, pixelData, bufferInfo.size);
-
-    textureBuffersToUpload.emplace(texHandle, std::move(bufferAllocation));
-
-    gfx::DynamicTexture::uploadImage(pixelData, texHandle);
-}
-
-void DynamicTexture::uploadDeferredImages() {
-    std::scoped_lock lock(mutex);
+    std::vector<std::pair<Rect<uint16_t>, UniqueBufferAllocation>> stagingBuffers;
+    stagingBuffers.reserve(regions.size());
+    for (const auto& [region, pixels] : regions) {
+        const auto bufferInfo = vk::BufferCreateInfo()
+                                    .setSize(pixels.size())
+                                    .setUsage(vk::BufferUsageFlagBits::eTransferSrc)
+                                    .setSharingMode(vk::SharingMode::eExclusive);
+
+        UniqueBufferAllocation bufferAllocation = std::make_unique<BufferAllocation>(allocator);
+        if (!bufferAllocation->create(allocationInfo, bufferInfo)) {
+            mbgl::Log::Error(mbgl::Event::Render, "Vulkan texture buffer allocation failed");
+            continue;
+        }
 
-    if (textureBuffersToUpload.empty()) {
-        return;
+        vmaMapMemory(allocator, bufferAllocation->allocation, &bufferAllocation->mappedBuffer);
+        memcpy(bufferAllocation->mappedBuffer, pixels.data(), pixels.size());
+        stagingBuffers.emplace_back(region, std::move(bufferAllocation));
     }
 
     const auto& textureVK = static_cast<Texture2D*>(texture.get());
     context.submitOneTimeCommand([&](const vk::UniqueCommandBuffer& commandBuffer) {
         textureVK->transitionToTransferWriteLayout(commandBuffer);
-        for (const auto& pair : textureBuffersToUpload) {
-            const auto& rect = pair.first.getRectangle();
+        for (const auto& staging : stagingBuffers) {
+            const auto& rect = staging.first;
             const auto region = vk::BufferImageCopy()
                                     .setBufferOffset(0)
                                     .setBufferRowLength(rect.w)
@@ -168,7 +172,7 @@ void DynamicTexture::uploadDeferredImages() {
                                     .setImageOffset(vk::Offset3D(rect.x, rect.y))
                                     .setImageExtent(vk::Extent3D(rect.w, rect.h, 1));
 
-            commandBuffer->copyBufferToImage(pair.second->buffer,
+            commandBuffer->copyBufferToImage(staging.second->buffer,
                                              textureVK->getVulkanImage(),
                                              textureVK->getVulkanImageLayout(),
                                              region,
@@ -181,18 +185,8 @@ void DynamicTexture::uploadDeferredImages() {
         }
         textureVK->transitionToShaderReadLayout(commandBuffer);
     });
-
-    textureBuffersToUpload.clear();
 }
 
-bool DynamicTexture::removeTexture(const gfx::TextureHandle& texHandle) {
-    if (gfx::DynamicTexture::removeTexture(texHandle)) {
-        std::scoped_lock lock(mutex);
-        textureBuffersToUpload.erase(texHandle);
-        return true;
-    }
-    return false;
-}
 #endif
 
 } // namespace vulkan
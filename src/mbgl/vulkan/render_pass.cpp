@@ -3,14 +3,27 @@
 #include <mbgl/vulkan/command_encoder.hpp>
 #include <mbgl/vulkan/renderable_resource.hpp>
 #include <mbgl/vulkan/context.hpp>
+#include <mbgl/vulkan/drawable.hpp>
+#include <mbgl/vulkan/uniform_buffer.hpp>
+#include <mbgl/util/instrumentation.hpp>
 #include <mbgl/util/logging.hpp>
+#include <mbgl/util/parallel_for.hpp>
+
+#include <algorithm>
+#include <atomic>
 
 namespace mbgl {
 namespace vulkan {
 
+namespace {
+// Fewer drawables per thread aren't worth the secondary command buffer
+constexpr std::size_t minDrawablesPerBatch = 64;
+} // namespace
+
 RenderPass::RenderPass(CommandEncoder& commandEncoder_, const char* name, const gfx::RenderPassDescriptor& descriptor_)
     : descriptor(descriptor_),
-      commandEncoder(commandEncoder_) {
+      commandEncoder(commandEncoder_),
+      recordingSecondary(commandEncoder_.getContext().getBackend().getRecordingThreads() > 1) {
     auto& resource = descriptor.renderable.getResource<RenderableResource>();
 
     resource.bind();
@@ -38,8 +51,16 @@ RenderPass::RenderPass(CommandEncoder& commandEncoder_, const char* name, const
 
     pushDebugGroup(name);
 
+    // A subpass takes either inline commands or secondary command buffers, so with several recording
+    // threads even the commands of the render thread go into secondary ones
+    const auto contents = recordingSecondary ? vk::SubpassContents::eSecondaryCommandBuffers
+                                             : vk::SubpassContents::eInline;
     commandEncoder.getCommandBuffer()->beginRenderPass(
-        renderPassBeginInfo, vk::SubpassContents::eInline, commandEncoder.getContext().getBackend().getDispatcher());
+        renderPassBeginInfo, contents, commandEncoder.getContext().getBackend().getDispatcher());
+
+    if (recordingSecondary) {
+        beginSegment();
+    }
 
     commandEncoder.context.performCleanup();
 }
@@ -51,7 +72,91 @@ RenderPass::~RenderPass() {
 }
 
 void RenderPass::endEncoding() {
-    commandEncoder.getCommandBuffer()->endRenderPass(commandEncoder.getContext().getBackend().getDispatcher());
+    const auto& dispatcher = commandEncoder.getContext().getBackend().getDispatcher();
+
+    if (recordingSecondary) {
+        endSegment();
+        commandEncoder.getCommandBuffer()->executeCommands(segments, dispatcher);
+        segments.clear();
+    }
+
+    commandEncoder.getCommandBuffer()->endRenderPass(dispatcher);
+}
+
+void RenderPass::recordDrawables(const std::vector<const Drawable*>& drawables,
+                                 const std::function<void(CommandEncoder&)>& bindLayer) {
+    MLN_TRACE_FUNC();
+
+    auto& context = commandEncoder.getContext();
+    auto& backend = context.getBackend();
+
+    const auto recordBatch = [&](CommandEncoder& encoder, std::size_t begin, std::size_t end) {
+        if (globalUniformBuffers) {
+            globalUniformBuffers->bindUpdatedDescriptorSets(encoder);
+        }
+        bindLayer(encoder);
+
+        std::size_t drawCalls = 0;
+        for (std::size_t i = begin; i < end; ++i) {
+            drawCalls += drawables[i]->record(encoder);
+        }
+        return drawCalls;
+    };
+
+    const std::size_t batchCount = recordingSecondary ? std::min<std::size_t>(backend.getRecordingThreads(),
+                                                                              drawables.size() / minDrawablesPerBatch)
+                                                      : 1;
+    if (batchCount <= 1) {
+        context.renderingStats().numDrawCalls += static_cast<int>(recordBatch(commandEncoder, 0, drawables.size()));
+        return;
+    }
+
+    // Create what the workers share, which is otherwise created on first use
+    context.reserveSecondaryCommandPools(batchCount);
+    (void)context.getGeneralPipelineLayout();
+    (void)backend.getPipelineCache();
+
+    endSegment();
+
+    std::vector<vk::CommandBuffer> batches(batchCount);
+    std::atomic<std::size_t> drawCalls{0};
+    util::parallelFor(backend.getThreadPool(), batchCount, batchCount - 1, [&](std::size_t batch) {
+        MLN_TRACE_ZONE(record batch);
+        const auto& buffer = context.beginSecondaryCommandBuffer(batch, descriptor.renderable);
+        CommandEncoder encoder(context, buffer);
+
+        drawCalls += recordBatch(
+            encoder, drawables.size() * batch / batchCount, drawables.size() * (batch + 1) / batchCount);
+
+        buffer->end(backend.getDispatcher());
+        batches[batch] = buffer.get();
+    });
+
+    context.renderingStats().numDrawCalls += static_cast<int>(drawCalls.load());
+    context.renderingStats().numParallelRecordedBatches += batchCount;
+    segments.insert(segments.end(), batches.begin(), batches.end());
+
+    beginSegment();
+}
+
+void RenderPass::beginSegment() {
+    auto& context = commandEncoder.getContext();
+
+    context.reserveSecondaryCommandPools(1);
+    commandEncoder.setCommandBuffer(context.beginSecondaryCommandBuffer(0, descriptor.renderable));
+
+    // Bindings don't carry over from the previous secondary command buffer
+    if (globalUniformBuffers) {
+        globalUniformBuffers->bindUpdatedDescriptorSets(commandEncoder);
+    }
+}
+
+void RenderPass::endSegment() {
+    const auto& segment = commandEncoder.getCommandBuffer();
+    segment->end(commandEncoder.getContext().getBackend().getDispatcher());
+    segments.push_back(segment.get());
+
+    commandEncoder.setCommandBuffer(commandEncoder.getPrimaryCommandBuffer());
 }
 
 void RenderPass::clearStencil(uint32_t value) const {
@@ -3,6 +3,7 @@
 #include <mbgl/vulkan/renderable_resource.hpp>
 
 #include <mbgl/gfx/backend_scope.hpp>
+#include <mbgl/gfx/shader_binary_cache.hpp>
 #include <mbgl/gfx/shader_registry.hpp>
 #include <mbgl/shaders/shader_source.hpp>
 #include <mbgl/util/logging.hpp>
@@ -118,6 +119,8 @@ RendererBackend::~RendererBackend() {
 }
 
 std::unique_ptr<gfx::Context> RendererBackend::createContext() {
+    // Start reading the stored pipeline cache while the first frame is prepared
+    initShaderBinaryCache();
     return std::make_unique<vulkan::Context>(*this);
 }
 
@@ -631,12 +634,71 @@ void RendererBackend::initCommandPool() {
     commandPool = device->createCommandPoolUnique(createInfo, nullptr, dispatcher);
 }
 
+namespace {
+// The pipeline cache is stored as a single binary, whose header the driver validates on its own
+constexpr uint64_t pipelineCacheKey = 0;
+} // namespace
+
+void RendererBackend::initShaderBinaryCache() {
+    if (shaderBinaryCache || !device || getShaderCacheDirectory().empty()) {
+        return;
+    }
+
+    const auto& properties = physicalDeviceProperties;
+    std::string driverID = std::to_string(properties.vendorID) + ":" + std::to_string(properties.deviceID) + ":" +
+                           std::to_string(properties.driverVersion) + ":";
+    driverID.append(reinterpret_cast<const char*>(properties.pipelineCacheUUID.data()), VK_UUID_SIZE);
+    shaderBinaryCache = std::make_unique<gfx::ShaderBinaryCache>(getShaderCacheDirectory(), std::move(driverID));
+}
+
+vk::PipelineCache RendererBackend::getPipelineCache() {
+    if (!pipelineCacheChecked && device) {
+        pipelineCacheChecked = true;
+        initShaderBinaryCache();
+        if (!shaderBinaryCache) {
+            return {};
+        }
+
+        const auto data = shaderBinaryCache->get(pipelineCacheKey);
+        auto createInfo = vk::PipelineCacheCreateInfo();
+        if (data) {
+            createInfo.setInitialDataSize(data->size()).setPInitialData(data->data());
+        }
+
+        try {
+            pipelineCache = device->createPipelineCacheUnique(createInfo, nullptr, dispatcher);
+        } catch (const vk::SystemError& e) {
+            // Start over with an empty cache if the driver fails on the stored one
+            Log::Warning(Event::Shader, std::string("Failed to load pipeline cache: ") + e.what());
+            shaderBinaryCache->remove(pipelineCacheKey);
+            pipelineCache = device->createPipelineCacheUnique({}, nullptr, dispatcher);
+        }
+    }
+    return pipelineCache.get();
+}
+
+void RendererBackend::savePipelineCache() {
+    if (!pipelineCache || !shaderBinaryCache) {
+        return;
+    }
+
+    const auto data = device->getPipelineCacheData(pipelineCache.get(), dispatcher);
+    if (!data.empty()) {
+        shaderBinaryCache->put(pipelineCacheKey, std::string(data.begin(), data.end()));
+        shaderBinaryCache->save();
+    }
+}
+
 void RendererBackend::destroyResources() {
     if (device) device->waitIdle(dispatcher);
 
     context.reset();
     commandPool.reset();
 
+    savePipelineCache();
+    pipelineCache.reset();
+    shaderBinaryCache.reset();
+
     vmaDestroyAllocator(allocator);
 
     usingSharedContext ? void(device.release()) : device.reset();
@@ -86,6 +86,17 @@ void TileLayerGroup::render(RenderOrchestrator&, PaintParameters& parameters) {
         parameters.renderTileClippingMasks(stencilTiles);
     }
 
+    // With several recording threads, the drawables are prepared here and recorded together afterwards
+    const bool recordSecondary = renderPass.isRecordingSecondary();
+    const auto recordPrepared = [&] {
+        if (!preparedDrawables.empty()) {
+            renderPass.recordDrawables(preparedDrawables, [&](CommandEncoder& batchEncoder) {
+                uniformBuffers.bindUpdatedDescriptorSets(batchEncoder);
+            });
+            preparedDrawables.clear();
+        }
+    };
+
     bool bindUBOs = false;
     visitDrawables([&](gfx::Drawable& drawable) {
         if (!drawable.getEnabled() || !drawable.hasRenderPass(parameters.pass)) {
@@ -93,10 +104,19 @@ void TileLayerGroup::render(RenderOrchestrator&, PaintParameters& parameters) {
         }
 
         if (!bindUBOs) {
-            uniformBuffers.bindDescriptorSets(encoder);
+            if (recordSecondary) {
+                uniformBuffers.updateDescriptorSets(encoder.getContext());
+            } else {
+                uniformBuffers.bindDescriptorSets(encoder);
+            }
             bindUBOs = true;
         }
 
+        // Custom drawables render from their tweakers, which has to come after what's drawn before them
+        if (recordSecondary && drawable.getIsCustom()) {
+            recordPrepared();
+        }
+
         for (const auto& tweaker : drawable.getTweakers()) {
             tweaker->execute(drawable, parameters);
         }
@@ -112,8 +132,17 @@ void TileLayerGroup::render(RenderOrchestrator&, PaintParameters& parameters) {
             drawableImpl.setStencilModeFor3D(stencil);
         }
 
-        drawable.draw(parameters);
+        if (recordSecondary) {
+            const auto& drawableImpl = static_cast<const Drawable&>(drawable);
+            if (drawableImpl.prepare(parameters)) {
+                preparedDrawables.push_back(&drawableImpl);
+            }
+        } else {
+            drawable.draw(parameters);
+        }
     });
+
+    recordPrepared();
 }
 
 } // namespace vulkan
@@ -83,6 +83,7 @@ const gfx::UniqueVertexBufferResource& UploadPass::getBuffer(const gfx::VertexVe
             auto buffer = std::make_unique<VertexBuffer>();
             buffer->resource = createVertexBufferResource(rawBufPtr, rawBufSize, usage, /*persistent=*/false);
             vec->setBuffer(std::move(buffer));
+            vec->resetModifiedRanges();
 
             auto* rawData = static_cast<VertexBuffer*>(vec->getBuffer());
             auto& resource = static_cast<VertexBufferResource&>(*rawData->resource);
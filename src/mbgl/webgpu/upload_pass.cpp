@@ -108,7 +108,17 @@ const gfx::UniqueVertexBufferResource& UploadPass::getBuffer(const gfx::VertexVe
 
             if (rawBufSize <= resource.getSizeInBytes()) {
                 if (forceUpdate || vec->isModifiedAfter(resource.getLastUpdated())) {
-                    updateVertexBufferResource(resource, rawBufPtr, rawBufSize);
+                    const auto& ranges = vec->getModifiedRanges();
+                    if (forceUpdate || ranges.empty()) {
+                        updateVertexBufferResource(resource, rawBufPtr, rawBufSize);
+                    } else {
+                        for (const auto& range : ranges) {
+                            resource.getBuffer().update(static_cast<const uint8_t*>(rawBufPtr) + range.begin,
+                                                        range.end - range.begin,
+                                                        range.begin);
+                        }
+                    }
+                    vec->resetModifiedRanges();
                     resource.setLastUpdated(vec->getLastModified());
                 }
                 return rawData->resource;
@@ -118,6 +128,7 @@ const gfx::UniqueVertexBufferResource& UploadPass::getBuffer(const gfx::VertexVe
             auto buffer_ = std::make_unique<VertexBuffer>();
             buffer_->resource = createVertexBufferResource(rawBufPtr, rawBufSize, usage, /*persistent=*/false);
             vec->setBuffer(std::move(buffer_));
+            vec->resetModifiedRanges();
             return static_cast<VertexBuffer*>(vec->getBuffer())->resource;
         }
     }
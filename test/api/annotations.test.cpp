@@ -208,6 +208,50 @@ TEST(Annotations, UpdateSymbolAnnotationGeometry) {
     test.checkRendering("update_point");
 }
 
+TEST(Annotations, BatchedUpdates) {
+    AnnotationTest test;
+
+    test.map.getStyle().loadJSON(util::read_file("test/fixtures/api/empty.json"));
+    test.map.addAnnotationImage(namedMarker("default_marker"));
+    AnnotationIDs points = test.map.addAnnotations({SymbolAnnotation{Point<double>{0, 0}, "default_marker"},
+                                                    SymbolAnnotation{Point<double>{45, 45}, "default_marker"},
+                                                    SymbolAnnotation{Point<double>{-45, -45}, "default_marker"}});
+    ASSERT_EQ(3u, points.size());
+
+    test.frontend.render(test.map);
+
+    test.map.updateAnnotations({{points[0], SymbolAnnotation{Point<double>{-10, 0}, "default_marker"}}});
+    test.map.removeAnnotations({points[1], points[2]});
+    test.checkRendering("update_point");
+}
+
+TEST(Annotations, UpdatesAtAntimeridian) {
+    AnnotationTest test;
+
+    auto viewSize = test.frontend.getSize();
+    auto box = ScreenBox{{}, {double(viewSize.width), double(viewSize.height)}};
+
+    test.map.getStyle().loadJSON(util::read_file("test/fixtures/api/empty.json"));
+    test.map.addAnnotationImage(namedMarker("default_marker"));
+    test.map.addAnnotation(SymbolAnnotation{Point<double>{0, 0}, "default_marker"});
+    test.map.jumpTo(CameraOptions().withCenter(LatLng(0, 180)).withZoom(2));
+    test.frontend.render(test.map);
+
+    // Only the tiles at the edges of the world contain these, and they're live already.
+    AnnotationIDs points = test.map.addAnnotations({SymbolAnnotation{Point<double>{180, 10}, "default_marker"},
+                                                    SymbolAnnotation{Point<double>{-180, -10}, "default_marker"}});
+    test.frontend.render(test.map);
+
+    auto features = test.frontend.getRenderer()->queryRenderedFeatures(box);
+    AnnotationIDs ids;
+    for (const auto& feature : features) {
+        ids.push_back(feature.id.get<uint64_t>());
+    }
+    std::ranges::sort(ids);
+    ids.erase(std::unique(ids.begin(), ids.end()), ids.end()); // NOLINT(modernize-use-ranges)
+    EXPECT_EQ(points, ids);
+}
+
 TEST(Annotations, UpdateSymbolAnnotationIcon) {
     AnnotationTest test;
 
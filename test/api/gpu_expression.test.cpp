@@ -0,0 +1,94 @@
+#include <mbgl/test/util.hpp>
+
+#include <mbgl/gfx/backend.hpp>
+#include <mbgl/gfx/headless_frontend.hpp>
+#include <mbgl/map/map.hpp>
+#include <mbgl/map/map_options.hpp>
+#include <mbgl/storage/resource_options.hpp>
+#include <mbgl/style/style.hpp>
+#include <mbgl/util/image.hpp>
+#include <mbgl/util/run_loop.hpp>
+
+#include <mapbox/pixelmatch.hpp>
+
+using namespace mbgl;
+
+namespace {
+
+// Zoom-dependent paint properties for each of the layer types that can evaluate them on the GPU
+constexpr const char* style = R"STYLE({
+  "version": 8,
+  "sources": {
+    "geojson": {
+      "type": "geojson",
+      "data": {
+        "type": "FeatureCollection",
+        "features": [
+          { "type": "Feature", "properties": {},
+            "geometry": { "type": "Polygon",
+                          "coordinates": [[[-20, -15], [25, -20], [15, 20], [-25, 10], [-20, -15]]] } },
+          { "type": "Feature", "properties": {},
+            "geometry": { "type": "LineString", "coordinates": [[-30, -25], [0, 5], [30, -10]] } },
+          { "type": "Feature", "properties": {},
+            "geometry": { "type": "MultiPoint", "coordinates": [[-10, 0], [0, 10], [10, -5], [20, 15]] } }
+        ]
+      }
+    }
+  },
+  "layers": [
+    { "id": "background", "type": "background", "paint": { "background-color": "white" } },
+    { "id": "fill", "type": "fill", "source": "geojson", "filter": ["==", ["geometry-type"], "Polygon"],
+      "paint": {
+        "fill-color": ["interpolate", ["linear"], ["zoom"], 0, "#ff0000", 2, "#00ff00", 4, "#0000ff"],
+        "fill-opacity": ["interpolate", ["exponential", 1.5], ["zoom"], 0, 0.2, 4, 0.9],
+        "fill-outline-color": ["step", ["zoom"], "#000000", 2, "#ff00ff"] } },
+    { "id": "line", "type": "line", "source": "geojson", "filter": ["==", ["geometry-type"], "LineString"],
+      "paint": {
+        "line-color": ["interpolate", ["linear"], ["zoom"], 0, "#000080", 4, "#ffa500"],
+        "line-width": ["interpolate", ["exponential", 2], ["zoom"], 0, 1, 4, 12],
+        "line-opacity": ["step", ["zoom"], 1, 1.5, 0.6] } },
+    { "id": "circle", "type": "circle", "source": "geojson", "filter": ["==", ["geometry-type"], "Point"],
+      "paint": {
+        "circle-color": ["interpolate", ["linear"], ["zoom"], 0, "#008080", 4, "#800080"],
+        "circle-radius": ["interpolate", ["linear"], ["zoom"], 0, 2, 4, 20],
+        "circle-blur": ["step", ["zoom"], 0, 2.5, 0.5],
+        "circle-opacity": ["interpolate", ["linear"], ["zoom"], 0, 1, 4, 0.5],
+        "circle-stroke-color": ["step", ["zoom"], "#000000", 1, "#ffffff", 3, "#ff0000"],
+        "circle-stroke-width": ["interpolate", ["linear"], ["zoom"], 0, 0, 4, 4],
+        "circle-stroke-opacity": ["interpolate", ["linear"], ["zoom"], 0, 0.5, 4, 1] } }
+  ]
+})STYLE";
+
+PremultipliedImage render(bool gpuEval, double zoom) {
+    gfx::Backend::setEnableGPUExpressionEval(gpuEval);
+
+    HeadlessFrontend frontend{{256, 256}, 1};
+    Map map(frontend,
+            MapObserver::nullObserver(),
+            MapOptions().withMapMode(MapMode::Static).withSize(frontend.getSize()),
+            ResourceOptions().withCachePath(":memory:").withAssetPath("test/fixtures/api/assets"));
+    map.getStyle().loadJSON(style);
+    map.jumpTo(CameraOptions().withCenter(LatLng{0, 0}).withZoom(zoom));
+    return frontend.render(map).image;
+}
+
+} // namespace
+
+// GPU evaluation of zoom expressions must draw the same thing as evaluating them on the CPU.
+// Backends without GPU evaluation ignore the setting, and render the same image twice.
+TEST(GPUExpression, MatchesCPU) {
+    util::RunLoop loop;
+
+    const bool wasEnabled = gfx::Backend::getEnableGPUExpressionEval();
+    for (const double zoom : {0.0, 0.75, 1.5, 2.25, 3.0, 3.6}) {
+        const auto cpu = render(false, zoom);
+        const auto gpu = render(true, zoom);
+        ASSERT_EQ(cpu.size, gpu.size);
+
+        PremultipliedImage diff{cpu.size};
+        const auto pixels = mapbox::pixelmatch(
+            cpu.data.get(), gpu.data.get(), cpu.size.width, cpu.size.height, diff.data.get(), 0.1);
+        EXPECT_LE(static_cast<double>(pixels) / (cpu.size.width * cpu.size.height), 0.001) << "at zoom " << zoom;
+    }
+    gfx::Backend::setEnableGPUExpressionEval(wasEnabled);
+}
@@ -0,0 +1,99 @@
+#if MLN_RENDER_BACKEND_VULKAN
+
+#include <mbgl/test/util.hpp>
+
+#include <mbgl/gfx/headless_frontend.hpp>
+#include <mbgl/map/map.hpp>
+#include <mbgl/map/map_options.hpp>
+#include <mbgl/storage/resource_options.hpp>
+#include <mbgl/style/style.hpp>
+#include <mbgl/util/image.hpp>
+#include <mbgl/util/run_loop.hpp>
+#include <mbgl/vulkan/renderer_backend.hpp>
+
+#include <mapbox/pixelmatch.hpp>
+
+#include <sstream>
+
+using namespace mbgl;
+
+namespace {
+
+// A polygon with an outline and a graticule covering the whole world, so that every tile has drawables
+std::string graticuleStyle() {
+    std::ostringstream lines;
+    for (int lon = -180; lon <= 180; lon += 10) {
+        lines << (lon > -180 ? "," : "") << "[[" << lon << ",-85],[" << lon << ",85]]";
+    }
+    for (int lat = -80; lat <= 80; lat += 10) {
+        lines << ",[[-180," << lat << "],[180," << lat << "]]";
+    }
+
+    return R"({
+      "version": 8,
+      "sources": {
+        "world": {
+          "type": "geojson",
+          "data": {
+            "type": "FeatureCollection",
+            "features": [
+              { "type": "Feature", "properties": {},
+                "geometry": { "type": "Polygon",
+                              "coordinates": [[[-179, -84], [179, -84], [179, 84], [-179, 84], [-179, -84]]] } },
+              { "type": "Feature", "properties": {},
+                "geometry": { "type": "MultiLineString", "coordinates": [)" +
+           lines.str() + R"(] } }
+            ]
+          }
+        }
+      },
+      "layers": [
+        { "id": "background", "type": "background", "paint": { "background-color": "white" } },
+        { "id": "fill", "type": "fill", "source": "world", "filter": ["==", ["geometry-type"], "Polygon"],
+          "paint": { "fill-color": "#9ec8e6", "fill-outline-color": "#205080" } },
+        { "id": "line", "type": "line", "source": "world", "filter": ["==", ["geometry-type"], "LineString"],
+          "paint": { "line-color": "#c03030", "line-width": 2 } }
+      ]
+    })";
+}
+
+HeadlessFrontend::RenderResult render(uint32_t recordingThreads) {
+    HeadlessFrontend frontend{{1024, 1024}, 1};
+    static_cast<vulkan::RendererBackend*>(frontend.getBackend())->setRecordingThreads(recordingThreads);
+
+    Map map(frontend,
+            MapObserver::nullObserver(),
+            MapOptions().withMapMode(MapMode::Static).withSize(frontend.getSize()),
+            ResourceOptions().withCachePath(":memory:").withAssetPath("test/fixtures/api/assets"));
+    map.getStyle().loadJSON(graticuleStyle());
+    // Pitched, so that the tile layers have enough drawables to be split into several batches
+    map.jumpTo(CameraOptions().withCenter(LatLng{20, 10}).withZoom(4.5).withPitch(60));
+    return frontend.render(map);
+}
+
+} // namespace
+
+// Recording the drawables of a render pass into secondary command buffers on several threads
+// has to produce the same image as recording them into the primary command buffer.
+TEST(RecordingThreads, MatchesSingleThread) {
+    util::RunLoop loop;
+
+    const auto single = render(1);
+    const auto multiple = render(4);
+    EXPECT_EQ(single.stats.numDrawCalls, multiple.stats.numDrawCalls);
+    // Otherwise the passes were recorded on the render thread alone, and nothing was compared
+    EXPECT_EQ(0u, single.stats.numParallelRecordedBatches);
+    EXPECT_GT(multiple.stats.numParallelRecordedBatches, 1u);
+    ASSERT_EQ(single.image.size, multiple.image.size);
+
+    PremultipliedImage diff{single.image.size};
+    EXPECT_EQ(0u,
+              mapbox::pixelmatch(single.image.data.get(),
+                                 multiple.image.data.get(),
+                                 single.image.size.width,
+                                 single.image.size.height,
+                                 diff.data.get(),
+                                 0.0));
+}
+
+#endif
@@ -136,6 +136,40 @@ TEST(Buckets, LineBucket) {
     ASSERT_FALSE(bucket.needsUpload());
 }
 
+TEST(Buckets, LineBucketIndexes) {
+    LineBucket::PossiblyEvaluatedLayoutProperties layout;
+    LineBucket bucket{layout, {}, 10.0f, 1};
+
+    GeometryCollection first{{{0, 0}, {10, 0}, {10, 10}}};
+    bucket.addFeature(StubGeometryTileFeature{{}, FeatureType::LineString, first, properties},
+                      first,
+                      {},
+                      PatternLayerMap(),
+                      0,
+                      CanonicalTileID(0, 0, 0));
+    const std::size_t firstVertices = bucket.vertices.elements();
+    const std::size_t firstIndexes = bucket.triangles.elements();
+
+    GeometryCollection second{{{20, 20}, {30, 20}}};
+    bucket.addFeature(StubGeometryTileFeature{{}, FeatureType::LineString, second, properties},
+                      second,
+                      {},
+                      PatternLayerMap(),
+                      1,
+                      CanonicalTileID(0, 0, 0));
+
+    // Both lines share a segment, and the second line's indexes point past the first line's vertices.
+    ASSERT_EQ(1u, bucket.segments.size());
+    EXPECT_EQ(bucket.vertices.elements(), bucket.segments[0].vertexLength);
+    EXPECT_EQ(bucket.triangles.elements(), bucket.segments[0].indexLength);
+    for (std::size_t i = 0; i < bucket.triangles.elements(); ++i) {
+        EXPECT_LT(bucket.triangles.at(i), bucket.vertices.elements());
+        if (i >= firstIndexes) {
+            EXPECT_GE(bucket.triangles.at(i), firstVertices);
+        }
+    }
+}
+
 TEST(Buckets, SymbolBucket) {
     gl::HeadlessBackend backend({512, 256});
     gfx::BackendScope scope{backend};
@@ -0,0 +1,82 @@
+#if MLN_RENDER_BACKEND_OPENGL
+#include <mbgl/test/util.hpp>
+
+#include <mbgl/gfx/backend_scope.hpp>
+#include <mbgl/gl/buffer_pool.hpp>
+#include <mbgl/gl/context.hpp>
+#include <mbgl/gl/headless_backend.hpp>
+
+#include <array>
+#include <vector>
+
+using namespace mbgl;
+
+TEST(BufferPool, Allocate) {
+    gl::HeadlessBackend backend{{256, 256}};
+    gfx::BackendScope scope{backend};
+    gl::Context context{backend};
+
+    gl::BufferPool pool{context, gl::BufferPool::Target::Vertex};
+    const std::array<uint8_t, 24> data{};
+
+    auto first = pool.allocate(data.data(), data.size());
+    auto second = pool.allocate(data.data(), data.size());
+    ASSERT_TRUE(first);
+    ASSERT_TRUE(second);
+    EXPECT_NE(first->getBuffer(), 0u);
+    EXPECT_EQ(first->getBuffer(), second->getBuffer());
+    EXPECT_EQ(first->getOffset(), 0u);
+    EXPECT_EQ(second->getOffset(), 2 * gl::BufferPool::alignment);
+    EXPECT_EQ(context.renderingStats().numBufferPages, 1);
+    EXPECT_EQ(context.renderingStats().numPooledBuffers, 2);
+
+    // Too large for a page to hold more than a few, those get a buffer of their own
+    std::vector<uint8_t> large(gl::BufferPool::maxAllocationSize + 1);
+    EXPECT_FALSE(pool.allocate(large.data(), large.size()));
+    EXPECT_FALSE(pool.allocate(data.data(), 0));
+
+    // Released regions are reused once defragmented
+    first.reset();
+    EXPECT_EQ(context.renderingStats().numPooledBuffers, 1);
+    auto third = pool.allocate(data.data(), data.size());
+    ASSERT_TRUE(third);
+    EXPECT_EQ(third->getOffset(), 4 * gl::BufferPool::alignment);
+
+    pool.defragment();
+    auto fourth = pool.allocate(data.data(), data.size());
+    ASSERT_TRUE(fourth);
+    EXPECT_EQ(fourth->getOffset(), 0u);
+}
+
+TEST(BufferPool, Defragment) {
+    gl::HeadlessBackend backend{{256, 256}};
+    gfx::BackendScope scope{backend};
+    gl::Context context{backend};
+
+    gl::BufferPool pool{context, gl::BufferPool::Target::Index};
+    std::vector<uint8_t> data(gl::BufferPool::maxAllocationSize);
+
+    constexpr auto perPage = gl::BufferPool::pageSize / gl::BufferPool::maxAllocationSize;
+    std::vector<gl::BufferPool::Allocation> allocations;
+    for (std::size_t i = 0; i < 3 * perPage; ++i) {
+        auto allocation = pool.allocate(data.data(), data.size());
+        ASSERT_TRUE(allocation);
+        allocations.push_back(std::move(*allocation));
+    }
+    EXPECT_EQ(context.renderingStats().numBufferPages, 3);
+    EXPECT_EQ(context.renderingStats().memBufferPages, static_cast<int>(3 * gl::BufferPool::pageSize));
+
+    // Pages still in use are kept, as allocations never move
+    while (allocations.size() > 1) {
+        allocations.pop_back();
+    }
+    pool.defragment();
+    EXPECT_EQ(context.renderingStats().numBufferPages, 1 + static_cast<int>(gl::BufferPool::maxEmptyPages));
+
+    allocations.clear();
+    pool.defragment();
+    EXPECT_EQ(context.renderingStats().numBufferPages, static_cast<int>(gl::BufferPool::maxEmptyPages));
+    EXPECT_EQ(context.renderingStats().numPooledBuffers, 0);
+}
+
+#endif
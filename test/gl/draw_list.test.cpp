@@ -0,0 +1,79 @@
+#if MLN_RENDER_BACKEND_OPENGL
+#include <mbgl/test/util.hpp>
+
+#include <mbgl/gfx/backend_scope.hpp>
+#include <mbgl/gl/context.hpp>
+#include <mbgl/gl/draw_list.hpp>
+#include <mbgl/gl/drawable_gl.hpp>
+#include <mbgl/gl/headless_backend.hpp>
+#include <mbgl/gl/texture2d.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace mbgl;
+
+namespace {
+
+std::unique_ptr<gl::DrawableGL> makeDrawable(const std::string& name,
+                                             const OverscaledTileID& tileID,
+                                             gfx::Texture2DPtr texture,
+                                             gfx::DrawPriority priority = 0) {
+    auto drawable = std::make_unique<gl::DrawableGL>(name);
+    drawable->setTileID(tileID);
+    drawable->setTexture(std::move(texture), 0);
+    drawable->setDrawPriority(priority);
+    return drawable;
+}
+
+std::vector<std::string> names(const gl::DrawList& list) {
+    std::vector<std::string> result;
+    list.visitDrawables([&](gl::DrawableGL& drawable) { result.push_back(drawable.getName()); });
+    return result;
+}
+
+} // namespace
+
+TEST(DrawList, Sort) {
+    gl::HeadlessBackend backend{{256, 256}};
+    gfx::BackendScope scope{backend};
+    gl::Context context{backend};
+
+    auto fillTexture = std::make_shared<gl::Texture2D>(context);
+    auto patternTexture = std::make_shared<gl::Texture2D>(context);
+    auto outlineTexture = std::make_shared<gl::Texture2D>(context);
+
+    const OverscaledTileID a{1, 0, 0};
+    const OverscaledTileID b{1, 1, 0};
+    const OverscaledTileID c{1, 0, 1};
+    std::vector<std::unique_ptr<gl::DrawableGL>> drawables;
+    drawables.push_back(makeDrawable("a-fill", a, fillTexture));
+    drawables.push_back(makeDrawable("a-outline", a, outlineTexture));
+    drawables.push_back(makeDrawable("b-fill", b, patternTexture));
+    drawables.push_back(makeDrawable("b-outline", b, outlineTexture));
+    drawables.push_back(makeDrawable("c-fill", c, fillTexture));
+    drawables.push_back(makeDrawable("c-outline", c, outlineTexture));
+    drawables.push_back(makeDrawable("a-top", a, fillTexture, 1));
+
+    gl::DrawList list;
+    for (auto& drawable : drawables) {
+        list.add(*drawable);
+    }
+    ASSERT_EQ(drawables.size(), list.size());
+    EXPECT_EQ("a-fill", names(list).front());
+
+    // The drawables of a tile keep their order, higher priorities are drawn last
+    list.sort();
+    const auto sorted = names(list);
+    const std::vector<std::string> fills(sorted.begin(), sorted.begin() + 3);
+    EXPECT_TRUE(fills == std::vector<std::string>({"a-fill", "c-fill", "b-fill"}) ||
+                fills == std::vector<std::string>({"b-fill", "a-fill", "c-fill"}));
+    EXPECT_EQ(std::vector<std::string>({"a-outline", "b-outline", "c-outline", "a-top"}),
+              std::vector<std::string>(sorted.begin() + 3, sorted.end()));
+
+    list.clear();
+    EXPECT_TRUE(list.empty());
+}
+
+#endif
@@ -0,0 +1,65 @@
+#if MLN_RENDER_BACKEND_OPENGL
+#include <mbgl/test/util.hpp>
+
+#include <mbgl/gfx/backend_scope.hpp>
+#include <mbgl/gfx/dynamic_texture.hpp>
+#include <mbgl/gl/context.hpp>
+#include <mbgl/gl/headless_backend.hpp>
+
+#include <vector>
+
+using namespace mbgl;
+
+namespace {
+
+class StagingTexture : public gfx::DynamicTexture {
+public:
+    using DynamicTexture::DynamicTexture;
+    using DynamicTexture::stageImage;
+    using DynamicTexture::takeStagedRegions;
+};
+
+} // namespace
+
+TEST(DynamicTexture, StagedRegions) {
+    gl::HeadlessBackend backend{{256, 256}};
+    gfx::BackendScope scope{backend};
+    gl::Context context{backend};
+    StagingTexture texture{context, {64, 64}, gfx::TexturePixelType::Alpha};
+
+    // Images next to each other are composited into one region, row after row
+    const std::vector<uint8_t> left{1, 2, 3, 4};
+    const std::vector<uint8_t> right{5, 6, 7, 8};
+    texture.stageImage(left.data(), {0, 0, 2, 2});
+    texture.stageImage(right.data(), {2, 0, 2, 2});
+
+    auto regions = texture.takeStagedRegions();
+    ASSERT_EQ(1u, regions.size());
+    EXPECT_EQ(Rect<uint16_t>(0, 0, 4, 2), regions[0].rect);
+    EXPECT_EQ(std::vector<uint8_t>({1, 2, 5, 6, 3, 4, 7, 8}), regions[0].pixels);
+
+    // Taking the regions releases the staged images
+    EXPECT_TRUE(texture.takeStagedRegions().empty());
+
+    // An image staged in the space of another one replaces it, the other was removed since
+    const std::vector<uint8_t> removed{9, 9, 9, 9};
+    const std::vector<uint8_t> replacement{10, 11, 12, 13};
+    texture.stageImage(removed.data(), {0, 0, 2, 2});
+    texture.stageImage(replacement.data(), {1, 1, 2, 2});
+
+    regions = texture.takeStagedRegions();
+    ASSERT_EQ(1u, regions.size());
+    EXPECT_EQ(Rect<uint16_t>(1, 1, 2, 2), regions[0].rect);
+    EXPECT_EQ(replacement, regions[0].pixels);
+
+    // Images with space in between are uploaded on their own
+    texture.stageImage(left.data(), {0, 0, 2, 2});
+    texture.stageImage(right.data(), {8, 8, 2, 2});
+
+    regions = texture.takeStagedRegions();
+    ASSERT_EQ(2u, regions.size());
+    EXPECT_EQ(left, regions[0].rect.x == 0 ? regions[0].pixels : regions[1].pixels);
+    EXPECT_EQ(right, regions[0].rect.x == 0 ? regions[1].pixels : regions[0].pixels);
+}
+
+#endif // MLN_RENDER_BACKEND_OPENGL
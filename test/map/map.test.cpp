@@ -9,6 +9,7 @@
 
 #include <mbgl/gfx/backend_scope.hpp>
 #include <mbgl/gfx/headless_frontend.hpp>
+#include <mbgl/gfx/headless_render_pool.hpp>
 #include <mbgl/gfx/shader_registry.hpp>
 #include <mbgl/map/map_options.hpp>
 #include <mbgl/math/log2.hpp>
@@ -34,6 +35,7 @@
 #include <mbgl/style/sources/vector_source.hpp>
 #include <mbgl/style/style_impl.hpp>
 #include <mbgl/style/style.hpp>
+#include <mbgl/text/shaping_cache.hpp>
 #include <mbgl/util/async_task.hpp>
 #include <mbgl/util/client_options.hpp>
 #include <mbgl/util/color.hpp>
@@ -44,6 +46,8 @@
 #include <mbgl/util/run_loop.hpp>
 
 #include <atomic>
+#include <stdexcept>
+#include <thread>
 
 using namespace mbgl;
 using namespace mbgl::style;
@@ -739,6 +743,125 @@ TEST(Map, AddLayer) {
     test::checkImage("test/fixtures/map/add_layer", test.frontend.render(test.map).image);
 }
 
+TEST(Map, RenderAsync) {
+    MapTest<> test;
+
+    test.map.getStyle().loadJSON(util::read_file("test/fixtures/api/empty.json"));
+
+    auto layer = std::make_unique<BackgroundLayer>("background");
+    layer->setBackgroundColor({{1, 0, 0, 1}});
+    auto* background = layer.get();
+    test.map.getStyle().addLayer(std::move(layer));
+
+    std::vector<PremultipliedImage> images;
+    const auto collect = [&](HeadlessFrontend::RenderResult result) {
+        images.push_back(std::move(result.image));
+    };
+
+    // The second frame is rendered while the first one may still be read back
+    test.frontend.renderAsync(test.map, collect);
+    background->setBackgroundColor({{0, 1, 0, 1}});
+    test.frontend.renderAsync(test.map, collect);
+    test.frontend.processReadbacks(/*wait=*/true);
+
+    ASSERT_EQ(2u, images.size());
+    test::checkImage("test/fixtures/map/add_layer", images[0]);
+    ASSERT_TRUE(images[1].valid());
+    EXPECT_EQ(0, images[1].data[0]);
+    EXPECT_EQ(255, images[1].data[1]);
+}
+
+TEST(Map, RenderMetatile) {
+    MapTest<> test;
+
+    test.map.getStyle().loadJSON(util::read_file("test/fixtures/api/empty.json"));
+    auto layer = std::make_unique<BackgroundLayer>("background");
+    layer->setBackgroundColor({{1, 0, 0, 1}});
+    test.map.getStyle().addLayer(std::move(layer));
+
+    // The buffer of the top row extends beyond the north pole
+    auto result = test.frontend.renderMetatile(test.map, {2, 2, 0}, {.count = 2, .tileSize = 256, .buffer = 64});
+
+    EXPECT_EQ(Size(640, 640), result.image.size);
+    ASSERT_EQ(4u, result.tiles.size());
+    EXPECT_EQ(CanonicalTileID(2, 2, 0), result.tiles[0].id);
+    EXPECT_EQ(CanonicalTileID(2, 3, 0), result.tiles[1].id);
+    EXPECT_EQ(CanonicalTileID(2, 2, 1), result.tiles[2].id);
+    EXPECT_EQ(CanonicalTileID(2, 3, 1), result.tiles[3].id);
+    for (const auto& tile : result.tiles) {
+        EXPECT_EQ(Size(256, 256), tile.image.size);
+        EXPECT_EQ(result.image.stride(), tile.image.stride);
+        EXPECT_EQ(255, tile.image.row(0)[0]);
+        EXPECT_EQ(0, tile.image.row(0)[1]);
+    }
+    EXPECT_EQ(result.image.data.get() + 64 * result.image.stride() + 64 * 4, result.tiles[0].image.data);
+
+    // Below map zoom 0
+    EXPECT_THROW(test.frontend.renderMetatile(test.map, {0, 0, 0}, {.count = 1, .tileSize = 256, .buffer = 0}),
+                 std::invalid_argument);
+    EXPECT_THROW(test.frontend.renderMetatile(test.map, {1, 0, 0}, {.count = 2, .tileSize = 128, .buffer = 0}),
+                 std::invalid_argument);
+
+    result = test.frontend.renderMetatile(test.map, {0, 0, 0}, {.count = 1, .tileSize = 512, .buffer = 0});
+    EXPECT_EQ(Size(512, 512), result.image.size);
+    ASSERT_EQ(1u, result.tiles.size());
+    EXPECT_EQ(255, result.tiles[0].image.row(0)[0]);
+}
+
+#if MLN_RENDER_BACKEND_OPENGL
+TEST(Map, RenderPool) {
+    HeadlessRenderPool pool;
+    // Only the renderers of a pool share their shaders and static buffers
+    EXPECT_TRUE(pool.getBackend().hasSharedStaticData());
+    EXPECT_FALSE(HeadlessFrontend(1).getBackend()->hasSharedStaticData());
+
+    // Maps on separate threads take turns on the pool's backend
+    const auto renderBackground = [&](const Color& color, uint32_t size) {
+        util::RunLoop runLoop;
+        StubMapObserver observer;
+        HeadlessFrontend frontend{pool, {size, size}, 1};
+        MapAdapter map(frontend,
+                       observer,
+                       std::make_shared<StubFileSource>(),
+                       MapOptions().withMapMode(MapMode::Static).withSize(frontend.getSize()));
+        map.getStyle().loadJSON(util::read_file("test/fixtures/api/empty.json"));
+        auto layer = std::make_unique<BackgroundLayer>("background");
+        layer->setBackgroundColor({color});
+        map.getStyle().addLayer(std::move(layer));
+
+        std::vector<PremultipliedImage> images;
+        for (int i = 0; i < 3; i++) {
+            images.push_back(frontend.render(map).image);
+        }
+        return images;
+    };
+
+    std::vector<PremultipliedImage> red;
+    std::thread thread([&] { red = renderBackground({1, 0, 0, 1}, 256); });
+    const auto green = renderBackground({0, 1, 0, 1}, 128);
+    thread.join();
+
+    ASSERT_EQ(3u, red.size());
+    ASSERT_EQ(3u, green.size());
+    for (const auto& image : red) {
+        EXPECT_EQ(Size(256, 256), image.size);
+        EXPECT_EQ(255, image.data[0]);
+        EXPECT_EQ(0, image.data[1]);
+    }
+    for (const auto& image : green) {
+        EXPECT_EQ(Size(128, 128), image.size);
+        EXPECT_EQ(0, image.data[0]);
+        EXPECT_EQ(255, image.data[1]);
+    }
+
+    const auto stats = pool.getStats();
+    EXPECT_GE(stats.frames, 6u);
+    EXPECT_GT(stats.framesPerSecond, 0);
+    EXPECT_LE(stats.averageWaitTime, stats.maxWaitTime);
+    EXPECT_GT(stats.utilization, 0);
+}
+#endif // MLN_RENDER_BACKEND_OPENGL
+
 TEST(Map, RemoveLayer) {
     MapTest<> test;
 
@@ -1477,6 +1600,53 @@ TEST(Map, KeepRenderData) {
     }
 }
 
+TEST(Map, ShapingCacheStats) {
+    MapTest<> test;
+    test.fileSource->glyphsResponse = makeResponse("glyphs.pbf");
+    ShapingCache::get().clear();
+
+    test.map.getStyle().loadJSON(R"STYLE({
+      "version": 8,
+      "glyphs": "local://glyphs/{fontstack}/{range}.pbf",
+      "sources": {
+        "points": {
+          "type": "geojson",
+          "data": {
+            "type": "FeatureCollection",
+            "features": [
+              { "type": "Feature", "properties": {}, "geometry": { "type": "Point", "coordinates": [-10, 0] } },
+              { "type": "Feature", "properties": {}, "geometry": { "type": "Point", "coordinates": [10, 0] } }
+            ]
+          }
+        }
+      },
+      "layers": [{
+        "id": "labels",
+        "type": "symbol",
+        "source": "points",
+        "layout": {
+          "text-field": "Label",
+          "text-font": [ "Open Sans Regular" ],
+          "text-allow-overlap": true
+        }
+      }]
+    })STYLE");
+
+    gfx::RenderingStats stats;
+    test.observer.didFinishRenderingFrameCallback = [&](MapObserver::RenderFrameStatus status) {
+        stats = status.renderingStats;
+    };
+    test.frontend.render(test.map);
+
+    // Both points carry the same label, the second one reuses the shaping of the first
+    const auto cacheStats = ShapingCache::get().getStats();
+    EXPECT_GT(cacheStats.misses, 0u);
+    EXPECT_GT(cacheStats.hits, 0u);
+    EXPECT_EQ(cacheStats.hits, stats.numShapingCacheHits);
+    EXPECT_EQ(cacheStats.misses, stats.numShapingCacheMisses);
+    EXPECT_EQ(cacheStats.size, stats.shapingCacheSize);
+}
+
 namespace {
 
 bool isInsideTile(const mapbox::geometry::box<float>& box, float padding, Size viewportSize) {
@@ -540,6 +540,64 @@ TEST(Transform, IsPanning) {
     transform.updateTransitions(transform.getTransitionStart() + transform.getTransitionDuration());
 }
 
+TEST(Transform, PredictedStatesFollowTransition) {
+    Transform transform;
+    transform.resize({1000, 1000});
+    transform.jumpTo(CameraOptions().withCenter(LatLng()).withZoom(2.0));
+
+    transform.flyTo(CameraOptions().withCenter(LatLng(10, 20)).withZoom(8.0), AnimationOptions(Seconds(1)));
+    const TimePoint start = transform.getTransitionStart();
+
+    // Sampling the path leaves the current camera alone.
+    EXPECT_DOUBLE_EQ(2.0, transform.getZoom());
+    EXPECT_DOUBLE_EQ(0.0, transform.getLatLng().longitude());
+
+    auto predicted = transform.getPredictedStates(start);
+    ASSERT_EQ(8u, predicted.size());
+    EXPECT_NEAR(8.0, predicted.back().getZoom(), 1e-3);
+    EXPECT_NEAR(10.0, predicted.back().getLatLng().latitude(), 1e-6);
+    EXPECT_NEAR(20.0, predicted.back().getLatLng().longitude(), 1e-6);
+
+    // Only the part of the path that is still ahead is predicted.
+    transform.updateTransitions(start + Milliseconds(500));
+    EXPECT_EQ(4u, transform.getPredictedStates(start + Milliseconds(500)).size());
+
+    // Interrupting the transition invalidates the prediction.
+    transform.cancelTransitions();
+    EXPECT_TRUE(transform.getPredictedStates(start + Milliseconds(500)).empty());
+}
+
+TEST(Transform, PredictedStatesExtrapolateGesture) {
+    Transform transform;
+    transform.resize({1000, 1000});
+    transform.jumpTo(CameraOptions().withCenter(LatLng()).withZoom(4.0));
+    EXPECT_TRUE(transform.getPredictedStates(Clock::now()).empty());
+
+    transform.setGestureInProgress(true);
+    const TimePoint start = Clock::now();
+    transform.updateTransitions(start);
+    transform.moveBy({100, 0});
+    transform.updateTransitions(start + Milliseconds(50));
+    transform.moveBy({100, 0});
+    transform.updateTransitions(start + Milliseconds(100));
+
+    const double longitude = transform.getLatLng().longitude();
+    ASSERT_GT(0.0, longitude);
+
+    auto predicted = transform.getPredictedStates(start + Milliseconds(100));
+    ASSERT_EQ(3u, predicted.size());
+    EXPECT_GT(longitude, predicted[0].getLatLng().longitude());
+    EXPECT_GT(predicted[0].getLatLng().longitude(), predicted[2].getLatLng().longitude());
+    EXPECT_DOUBLE_EQ(4.0, predicted[2].getZoom());
+
+    // A gesture that stopped moving isn't extrapolated.
+    EXPECT_TRUE(transform.getPredictedStates(start + Seconds(1)).empty());
+
+    transform.setGestureInProgress(false);
+    transform.updateTransitions(start + Milliseconds(150));
+    EXPECT_TRUE(transform.getPredictedStates(start + Milliseconds(150)).empty());
+}
+
 TEST(Transform, DefaultTransform) {
     struct TransformObserver : public mbgl::TransformObserver {
         void onCameraWillChange(MapObserver::CameraChangeMode) final { cameraWillChangeCallback(); };
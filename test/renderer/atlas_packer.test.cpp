@@ -0,0 +1,150 @@
+#include <mbgl/gfx/atlas_packer.hpp>
+
+#include <gtest/gtest.h>
+
+using namespace mbgl;
+using namespace mbgl::gfx;
+
+namespace {
+
+bool overlap(const Rect<uint16_t>& a, const Rect<uint16_t>& b) {
+    return a.x < b.x + b.w && b.x < a.x + a.w && a.y < b.y + b.h && b.y < a.y + a.h;
+}
+
+} // namespace
+
+TEST(AtlasPacker, Shelves) {
+    AtlasPacker packer({64, 64});
+    const auto* a = packer.pack(1, {20, 10});
+    const auto* b = packer.pack(2, {20, 8});
+    const auto* c = packer.pack(3, {20, 20});
+    ASSERT_TRUE(a && b && c);
+
+    // Similar heights share a shelf, much higher rectangles open another one
+    EXPECT_EQ(Rect<uint16_t>(0, 0, 20, 10), a->rect);
+    EXPECT_EQ(Rect<uint16_t>(20, 0, 20, 8), b->rect);
+    EXPECT_EQ(Rect<uint16_t>(0, 10, 20, 20), c->rect);
+    EXPECT_EQ(2u, packer.getShelfCount());
+    EXPECT_EQ(760u, packer.getUsedArea());
+    EXPECT_DOUBLE_EQ(760.0 / 4096.0, packer.getOccupancy());
+}
+
+TEST(AtlasPacker, References) {
+    AtlasPacker packer({64, 64});
+    const auto* bin = packer.pack(1, {10, 10});
+    ASSERT_TRUE(bin);
+    EXPECT_EQ(1u, bin->refcount);
+    EXPECT_EQ(bin, packer.pack(1, {10, 10}));
+    EXPECT_EQ(2u, bin->refcount);
+
+    EXPECT_EQ(1u, packer.unref(1));
+    EXPECT_EQ(bin, packer.getBin(1));
+    EXPECT_EQ(0u, packer.unref(1));
+    EXPECT_EQ(nullptr, packer.getBin(1));
+    EXPECT_EQ(0u, packer.getUsedArea());
+}
+
+TEST(AtlasPacker, Full) {
+    AtlasPacker packer({32, 32});
+    EXPECT_EQ(nullptr, packer.pack(1, {33, 1}));
+    EXPECT_EQ(nullptr, packer.pack(1, {0, 1}));
+    ASSERT_TRUE(packer.pack(1, {32, 20}));
+    EXPECT_EQ(nullptr, packer.pack(2, {8, 16}));
+
+    // Once out of space for new shelves, lower rectangles go into higher shelves
+    ASSERT_TRUE(packer.pack(3, {32, 12}));
+    EXPECT_EQ(nullptr, packer.pack(4, {4, 4}));
+    EXPECT_EQ(1.0, packer.getOccupancy());
+}
+
+TEST(AtlasPacker, FreeSpansMerge) {
+    AtlasPacker packer({30, 30});
+    for (int32_t id = 0; id < 3; id++) {
+        ASSERT_TRUE(packer.pack(id, {10, 10}));
+    }
+    ASSERT_TRUE(packer.pack(3, {10, 10}));
+    EXPECT_EQ(10, packer.getBin(3)->rect.y);
+
+    // Two released neighbours make room for a wider rectangle in the first shelf
+    packer.unref(0);
+    packer.unref(1);
+    const auto* wide = packer.pack(4, {20, 10});
+    ASSERT_TRUE(wide);
+    EXPECT_EQ(Rect<uint16_t>(0, 0, 20, 10), wide->rect);
+}
+
+TEST(AtlasPacker, EmptyShelvesAreReused) {
+    AtlasPacker packer({32, 32});
+    ASSERT_TRUE(packer.pack(1, {32, 8}));
+    ASSERT_TRUE(packer.pack(2, {32, 8}));
+    ASSERT_TRUE(packer.pack(3, {32, 16}));
+    EXPECT_EQ(nullptr, packer.pack(4, {16, 16}));
+
+    // The two empty shelves merge into one, which is then high enough
+    packer.unref(1);
+    packer.unref(2);
+    EXPECT_EQ(2u, packer.getShelfCount());
+    const auto* bin = packer.pack(4, {16, 16});
+    ASSERT_TRUE(bin);
+    EXPECT_EQ(0, bin->rect.y);
+
+    // Space of the last shelf returns to the unused space, for any height
+    packer.unref(3);
+    EXPECT_EQ(1u, packer.getShelfCount());
+    const auto* low = packer.pack(5, {32, 4});
+    ASSERT_TRUE(low);
+    EXPECT_EQ(16, low->rect.y);
+}
+
+TEST(AtlasPacker, Churn) {
+    AtlasPacker packer({256, 256});
+    std::vector<int32_t> live;
+    int32_t next = 0;
+    for (int round = 0; round < 200; round++) {
+        for (int i = 0; i < 20; i++, next++) {
+            const auto w = static_cast<uint32_t>(8 + (next * 7) % 24);
+            const auto h = static_cast<uint32_t>(8 + (next * 13) % 24);
+            if (packer.pack(next, {w, h})) {
+                live.push_back(next);
+            }
+        }
+        // Release the oldest half
+        const auto released = live.size() / 2;
+        for (std::size_t i = 0; i < released; i++) {
+            packer.unref(live[i]);
+        }
+        live.erase(live.begin(), live.begin() + static_cast<std::ptrdiff_t>(released));
+    }
+
+    std::size_t area = 0;
+    for (std::size_t i = 0; i < live.size(); i++) {
+        const auto& rect = packer.getBin(live[i])->rect;
+        area += static_cast<std::size_t>(rect.w) * rect.h;
+        EXPECT_LE(rect.x + rect.w, 256);
+        EXPECT_LE(rect.y + rect.h, 256);
+        for (std::size_t j = 0; j < i; j++) {
+            EXPECT_FALSE(overlap(rect, packer.getBin(live[j])->rect));
+        }
+    }
+    EXPECT_EQ(live.size(), packer.getBinCount());
+    EXPECT_EQ(area, packer.getUsedArea());
+}
+
+TEST(AtlasPacker, MergeDirtyRects) {
+    EXPECT_TRUE(mergeDirtyRects({}).empty());
+
+    // By default, only rectangles that cover the merged region are merged
+    const auto exact = mergeDirtyRects({{10, 0, 10, 10}, {0, 0, 10, 10}, {0, 10, 10, 8}});
+    ASSERT_EQ(2u, exact.size());
+    EXPECT_EQ(Rect<uint16_t>(0, 0, 20, 10), exact[0]);
+    EXPECT_EQ(Rect<uint16_t>(0, 10, 10, 8), exact[1]);
+
+    // With an upload cost, neighbours in a shelf and the shelf below become one upload
+    const auto merged = mergeDirtyRects({{10, 0, 10, 10}, {0, 0, 10, 10}, {0, 10, 20, 8}}, 64 * 64);
+    ASSERT_EQ(1u, merged.size());
+    EXPECT_EQ(Rect<uint16_t>(0, 0, 20, 18), merged[0]);
+
+    // Far apart rectangles would upload too much in between
+    const auto apart = mergeDirtyRects({{0, 0, 10, 10}, {200, 200, 10, 10}}, 64 * 64);
+    EXPECT_EQ(2u, apart.size());
+}
@@ -0,0 +1,89 @@
+#include <mbgl/test/util.hpp>
+
+#include <mbgl/renderer/frame_profiler.hpp>
+
+using namespace mbgl;
+
+using Phase = FrameProfile::Phase;
+
+TEST(FrameProfiler, DisabledRecordsNothing) {
+    FrameProfiler profiler;
+    profiler.beginFrame(0);
+    profiler.addTime(Phase::Placement, 1.0);
+    profiler.addLayer("layer", 1.0);
+
+    EXPECT_EQ(0.0, profiler.timestamp());
+    EXPECT_EQ(nullptr, profiler.endFrame());
+    EXPECT_TRUE(profiler.getFrames().empty());
+}
+
+TEST(FrameProfiler, RecordsPhasesSourcesAndLayers) {
+    FrameProfiler profiler;
+    profiler.setEnabled(true);
+
+    profiler.beginFrame(7);
+    profiler.addTime(Phase::Placement, 0.5);
+    profiler.addTime(Phase::Placement, 0.25);
+    profiler.addSource("streets", 1.0);
+    profiler.setSourcePrepared("streets", 2.0, 12);
+    profiler.setSourcePrepared("missing", 2.0, 12);
+    profiler.addLayer("background", 0.125);
+    profiler.addLayer("roads", 0.5);
+    profiler.setLayerPrepared(1, 3.0);
+    profiler.setLayerPrepared(2, 3.0);
+
+    const FrameProfile* profile = profiler.endFrame();
+    ASSERT_NE(nullptr, profile);
+    EXPECT_EQ(7u, profile->frame);
+    EXPECT_EQ(0.75, profile->duration(Phase::Placement));
+    EXPECT_EQ(0.0, profile->duration(Phase::Upload));
+
+    ASSERT_EQ(1u, profile->sources.size());
+    EXPECT_EQ("streets", profile->sources[0].id);
+    EXPECT_EQ(1.0, profile->sources[0].updateTime);
+    EXPECT_EQ(2.0, profile->sources[0].prepareTime);
+    EXPECT_EQ(12u, profile->sources[0].renderTiles);
+
+    ASSERT_EQ(2u, profile->layers.size());
+    EXPECT_EQ(0.0, profile->layers[0].prepareTime);
+    EXPECT_EQ("roads", profile->layers[1].id);
+    EXPECT_EQ(0.5, profile->layers[1].evaluateTime);
+    EXPECT_EQ(3.0, profile->layers[1].prepareTime);
+}
+
+TEST(FrameProfiler, KeepsMostRecentFrames) {
+    FrameProfiler profiler(3);
+    profiler.setEnabled(true);
+
+    for (uint64_t frame = 0; frame < 5; ++frame) {
+        profiler.beginFrame(frame);
+        profiler.addTime(Phase::Frame, static_cast<double>(frame));
+        profiler.endFrame();
+    }
+
+    // A frame that was begun but never ended isn't kept.
+    profiler.beginFrame(5);
+
+    const auto frames = profiler.getFrames();
+    ASSERT_EQ(3u, frames.size());
+    EXPECT_EQ(2u, frames[0].frame);
+    EXPECT_EQ(3u, frames[1].frame);
+    EXPECT_EQ(4u, frames[2].frame);
+    EXPECT_EQ(4.0, frames[2].duration(Phase::Frame));
+
+    profiler.setEnabled(false);
+    EXPECT_TRUE(profiler.getFrames().empty());
+}
+
+TEST(FrameProfiler, PhasesNestInFrame) {
+    for (std::size_t i = 0; i < FrameProfile::PhaseCount; ++i) {
+        auto phase = static_cast<Phase>(i);
+        std::size_t depth = 0;
+        while (auto parent = FrameProfile::parent(phase)) {
+            phase = *parent;
+            ASSERT_LT(++depth, FrameProfile::PhaseCount);
+        }
+        EXPECT_EQ(Phase::Frame, phase);
+        EXPECT_STRNE("", FrameProfile::name(static_cast<Phase>(i)));
+    }
+}
@@ -0,0 +1,107 @@
+#include <mbgl/test/util.hpp>
+
+#include <mbgl/gfx/gpu_expression.hpp>
+#include <mbgl/style/expression/dsl.hpp>
+#include <mbgl/style/property_expression.hpp>
+#include <mbgl/util/bitmask_operations.hpp>
+
+#include <cmath>
+
+using namespace mbgl;
+using namespace mbgl::style;
+using namespace mbgl::style::expression::dsl;
+
+namespace {
+
+// Colors are packed into 8 bits per channel
+constexpr float colorTolerance = 1.5f / 255;
+
+constexpr float zooms[] = {0.0f, 1.0f, 2.5f, 3.0f, 4.25f, 5.0f, 7.75f, 10.0f, 12.5f, 15.0f, 18.0f, 22.0f};
+
+template <typename T>
+PropertyExpression<T> parse(const char* json) {
+    auto expression = createExpression(json);
+    EXPECT_TRUE(expression) << json;
+    return PropertyExpression<T>(std::move(expression));
+}
+
+// Evaluate the way the shaders do, at the floored zoom when the expression asks for integer zooms
+template <typename T>
+T evaluateGPU(const gfx::GPUExpression& expr, float zoom) {
+    return expr.evaluate<T>((expr.options & gfx::GPUOptions::IntegerZoom) ? std::floor(zoom) : zoom);
+}
+
+void expectMatch(const char* json, bool intZoom = false) {
+    const auto expression = parse<float>(json);
+    ASSERT_TRUE(expression.isGPUCapable()) << json;
+    const auto gpu = expression.getGPUExpression(intZoom);
+    ASSERT_TRUE(gpu) << json;
+    for (const auto zoom : zooms) {
+        const float cpuZoom = intZoom ? std::floor(zoom) : zoom;
+        EXPECT_NEAR(expression.evaluate(cpuZoom), evaluateGPU<float>(*gpu, zoom), 1e-4f) << json << " @ z" << zoom;
+    }
+}
+
+void expectColorMatch(const char* json) {
+    const auto expression = parse<Color>(json);
+    ASSERT_TRUE(expression.isGPUCapable()) << json;
+    const auto gpu = expression.getGPUExpression(false);
+    ASSERT_TRUE(gpu) << json;
+    for (const auto zoom : zooms) {
+        const auto cpu = expression.evaluate(zoom);
+        const auto result = evaluateGPU<Color>(*gpu, zoom);
+        EXPECT_NEAR(cpu.r, result.r, colorTolerance) << json << " @ z" << zoom;
+        EXPECT_NEAR(cpu.g, result.g, colorTolerance) << json << " @ z" << zoom;
+        EXPECT_NEAR(cpu.b, result.b, colorTolerance) << json << " @ z" << zoom;
+        EXPECT_NEAR(cpu.a, result.a, colorTolerance) << json << " @ z" << zoom;
+    }
+}
+
+} // namespace
+
+TEST(GPUExpression, Float) {
+    expectMatch(R"(["interpolate", ["linear"], ["zoom"], 0, 1, 10, 11])");
+    expectMatch(R"(["interpolate", ["linear"], ["zoom"], 3, 2, 5, 8, 12.5, 1, 18, 30])");
+    expectMatch(R"(["interpolate", ["exponential", 1.5], ["zoom"], 5, 0.5, 15, 20])");
+    expectMatch(R"(["interpolate", ["exponential", 0.8], ["zoom"], 2, 10, 10, 1, 16, 4])");
+    expectMatch(R"(["step", ["zoom"], 1, 3, 2, 10, 4])");
+    expectMatch(R"(["step", ["zoom"], 0, 4.25, 1])");
+}
+
+TEST(GPUExpression, Color) {
+    expectColorMatch(R"(["interpolate", ["linear"], ["zoom"],
+                         2, ["rgba", 255, 0, 0, 1],
+                         12, ["rgba", 0, 0, 255, 1]])");
+    expectColorMatch(R"(["interpolate", ["exponential", 2], ["zoom"],
+                         0, ["rgba", 10, 200, 30, 0.2],
+                         15, ["rgba", 250, 20, 90, 0.9]])");
+    expectColorMatch(R"(["step", ["zoom"],
+                         ["rgba", 0, 0, 0, 1],
+                         5, ["rgba", 0, 128, 0, 0.5],
+                         12, ["rgba", 1, 2, 3, 1]])");
+}
+
+TEST(GPUExpression, IntegerZoom) {
+    expectMatch(R"(["interpolate", ["linear"], ["zoom"], 0, 1, 10, 11])", /*intZoom=*/true);
+    expectMatch(R"(["step", ["zoom"], 1, 2.5, 2, 7.75, 4])", /*intZoom=*/true);
+}
+
+TEST(GPUExpression, Unsupported) {
+    // Not implemented by the shaders
+    const auto bezier = parse<float>(R"(["interpolate", ["cubic-bezier", 0.4, 0, 0.6, 1], ["zoom"], 0, 1, 10, 11])");
+    EXPECT_FALSE(bezier.getGPUExpression(false));
+
+    // Too many stops
+    std::string json = R"(["step", ["zoom"], 0)";
+    for (std::size_t i = 0; i < gfx::GPUExpression::maxStops; ++i) {
+        json += ", " + std::to_string(i + 1) + ", " + std::to_string(i);
+    }
+    json += "]";
+    EXPECT_FALSE(parse<float>(json.c_str()).getGPUExpression(false));
+
+    // A single stop
+    EXPECT_FALSE(parse<float>(R"(["interpolate", ["linear"], ["zoom"], 5, 1])").getGPUExpression(false));
+
+    // Not zoom-dependent
+    EXPECT_FALSE(parse<float>(R"(["get", "size"])").isGPUCapable());
+}
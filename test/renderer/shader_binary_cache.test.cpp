@@ -0,0 +1,97 @@
+#include <mbgl/gfx/shader_binary_cache.hpp>
+#include <mbgl/util/io.hpp>
+
+#include <gtest/gtest.h>
+
+using namespace mbgl;
+using namespace mbgl::gfx;
+
+namespace {
+
+const std::string directory = "test/fixtures";
+
+} // namespace
+
+TEST(ShaderBinaryCache, Hash) {
+    EXPECT_EQ(ShaderBinaryCache::hash({"vertex", "fragment"}), ShaderBinaryCache::hash({"vertex", "fragment"}));
+    EXPECT_NE(ShaderBinaryCache::hash({"vertex", "fragment"}), ShaderBinaryCache::hash({"vertexf", "ragment"}));
+    EXPECT_NE(ShaderBinaryCache::hash({"vertex"}), ShaderBinaryCache::hash({"vertex", ""}));
+}
+
+TEST(ShaderBinaryCache, Reload) {
+    const auto key = ShaderBinaryCache::hash({"vertex", "fragment"});
+    const std::string binary("\x01\x00\x02program", 10);
+    std::string path;
+    {
+        ShaderBinaryCache cache(directory, "driver");
+        path = cache.getPath();
+        util::deleteFile(path);
+    }
+
+    {
+        ShaderBinaryCache cache(directory, "driver");
+        EXPECT_FALSE(cache.get(key));
+        cache.put(key, binary);
+        cache.save();
+    }
+
+    {
+        ShaderBinaryCache cache(directory, "driver");
+        EXPECT_EQ(binary, cache.get(key));
+
+        // Binaries the driver rejects are dropped from the file
+        cache.remove(key);
+        cache.save();
+    }
+
+    {
+        ShaderBinaryCache cache(directory, "driver");
+        EXPECT_FALSE(cache.get(key));
+    }
+
+    util::deleteFile(path);
+}
+
+TEST(ShaderBinaryCache, OtherDriver) {
+    const auto key = ShaderBinaryCache::hash({"vertex", "fragment"});
+    ShaderBinaryCache cache(directory, "driver 1");
+    cache.put(key, "binary");
+    cache.save();
+
+    // A file copied from another driver is rejected by the driver ID stored in it
+    util::write_file(ShaderBinaryCache(directory, "driver 2").getPath(), util::read_file(cache.getPath()));
+    ShaderBinaryCache other(directory, "driver 2");
+    EXPECT_FALSE(other.get(key));
+
+    util::deleteFile(cache.getPath());
+    util::deleteFile(other.getPath());
+}
+
+TEST(ShaderBinaryCache, Damaged) {
+    const auto key = ShaderBinaryCache::hash({"vertex", "fragment"});
+    std::string path;
+    {
+        ShaderBinaryCache cache(directory, "driver");
+        path = cache.getPath();
+        cache.put(key, "binary");
+        cache.save();
+    }
+
+    // Flip the last byte of the binary
+    auto file = util::read_file(path);
+    file.back() ^= 0xFF;
+    util::write_file(path, file);
+    {
+        ShaderBinaryCache cache(directory, "driver");
+        EXPECT_FALSE(cache.get(key));
+    }
+
+    // Cut the file short
+    util::write_file(path, file.substr(0, file.size() / 2));
+    {
+        ShaderBinaryCache cache(directory, "driver");
+        EXPECT_FALSE(cache.get(key));
+    }
+
+    util::deleteFile(path);
+}
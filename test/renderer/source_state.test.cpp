@@ -0,0 +1,112 @@
+#include <mbgl/test/util.hpp>
+
+#include <mbgl/renderer/render_tile.hpp>
+#include <mbgl/renderer/source_state.hpp>
+#include <mbgl/renderer/tile_render_data.hpp>
+#include <mbgl/tile/tile.hpp>
+
+using namespace mbgl;
+
+namespace {
+
+// Records the feature states it is given
+class StubTile final : public Tile {
+public:
+    StubTile()
+        : Tile(Kind::Geometry, OverscaledTileID(0, 0, 0), "source") {}
+
+    std::unique_ptr<TileRenderData> createRenderData() override { return nullptr; }
+    void cancel() override {}
+    bool layerPropertiesUpdated(const Immutable<style::LayerProperties>&) override { return true; }
+
+    void setFeatureState(const LayerFeatureStates& states, uint64_t version_) override {
+        received = states;
+        version = version_;
+        updates++;
+    }
+    uint64_t getFeatureStateVersion() const override { return version; }
+
+    LayerFeatureStates received;
+    uint64_t version = 0;
+    std::size_t updates = 0;
+};
+
+} // namespace
+
+TEST(SourceFeatureState, IncrementalSetAndRemove) {
+    StubTile tile;
+    std::vector<RenderTile> tiles;
+    tiles.emplace_back(UnwrappedTileID(0, 0, 0), tile);
+
+    SourceFeatureState state;
+    state.updateState({"layer"}, "a", {{"hover", true}});
+    state.coalesceChanges(tiles);
+    ASSERT_EQ(1u, tile.updates);
+    EXPECT_EQ(1u, tile.received["layer"].size());
+
+    // Up to date, the tile only gets the changes, both the set and the removed state of the layer
+    state.updateState({"layer"}, "b", {{"hover", true}});
+    state.removeState({"layer"}, {"a"}, {"hover"});
+    state.coalesceChanges(tiles);
+    ASSERT_EQ(2u, tile.updates);
+    const auto& changes = tile.received["layer"];
+    ASSERT_EQ(2u, changes.size());
+    EXPECT_TRUE(changes.at("a").empty());
+    EXPECT_EQ(FeatureState({{"hover", true}}), changes.at("b"));
+
+    // Nothing changed
+    state.coalesceChanges(tiles);
+    EXPECT_EQ(2u, tile.updates);
+}
+
+TEST(SourceFeatureState, StaleTileGetsAllStates) {
+    StubTile tile;
+    std::vector<RenderTile> tiles;
+    tiles.emplace_back(UnwrappedTileID(0, 0, 0), tile);
+
+    SourceFeatureState state;
+    std::vector<RenderTile> noTiles;
+    state.updateState({"layer"}, "a", {{"hover", true}});
+    state.coalesceChanges(noTiles);
+    state.updateState({"layer"}, "b", {{"hover", true}});
+    state.coalesceChanges(noTiles);
+
+    state.removeState({"layer"}, {"a"}, std::nullopt);
+    state.coalesceChanges(tiles);
+    ASSERT_EQ(1u, tile.updates);
+    EXPECT_EQ(3u, tile.version);
+    const auto& states = tile.received["layer"];
+    EXPECT_TRUE(states.at("a").empty());
+    EXPECT_EQ(FeatureState({{"hover", true}}), states.at("b"));
+}
+
+TEST(SourceFeatureState, TileMissingTheChangingCallGetsAllStates) {
+    StubTile tile;
+    StubTile other;
+    std::vector<RenderTile> tiles;
+    tiles.emplace_back(UnwrappedTileID(0, 0, 0), tile);
+
+    SourceFeatureState state;
+    state.updateState({"layer"}, "a", {{"hover", true}});
+    state.coalesceChanges(tiles);
+    tiles.emplace_back(UnwrappedTileID(0, 0, 0), other);
+    state.coalesceChanges(tiles);
+    ASSERT_EQ(1u, other.updates);
+
+    // The change is applied while only the first tile is rendered
+    tiles.pop_back();
+    state.updateState({"layer"}, "b", {{"hover", true}});
+    state.coalesceChanges(tiles);
+    EXPECT_EQ(2u, tile.version);
+
+    // Nothing changes in the next call, the tile that missed the change still gets it
+    tiles.emplace_back(UnwrappedTileID(0, 0, 0), other);
+    state.coalesceChanges(tiles);
+    ASSERT_EQ(2u, other.updates);
+    EXPECT_EQ(2u, other.version);
+    const auto& states = other.received["layer"];
+    ASSERT_EQ(2u, states.size());
+    EXPECT_EQ(FeatureState({{"hover", true}}), states.at("a"));
+    EXPECT_EQ(FeatureState({{"hover", true}}), states.at("b"));
+    EXPECT_EQ(2u, tile.updates);
+}
@@ -0,0 +1,226 @@
+#include <mbgl/gfx/uniform_arena.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstring>
+#include <optional>
+
+using namespace mbgl;
+using namespace mbgl::gfx;
+
+namespace {
+
+// Keeps the buffer in memory, so that the tests can check what a draw call would read
+class TestArena final : public UniformArena {
+public:
+    TestArena()
+        : UniformArena(16, 64) {}
+
+    std::vector<uint8_t> memory;
+    std::size_t waits = 0;
+    std::size_t fences = 0;
+    std::size_t resizes = 0;
+    std::size_t uploads = 0;
+
+    template <typename T>
+    T read(const Block& block) {
+        const auto offset = block.getBindingOffset();
+        T value;
+        EXPECT_LE(offset + sizeof(T), memory.size());
+        std::memcpy(&value, memory.data() + offset, sizeof(T));
+        return value;
+    }
+
+protected:
+    void waitForRegion(std::size_t) override { waits++; }
+    void fenceRegion(std::size_t) override { fences++; }
+    void resize(std::size_t newCapacity, std::size_t stableSize) override {
+        resizes++;
+        // Nothing is preserved
+        memory.assign(newCapacity * frameCount + stableSize, 0xff);
+    }
+    void upload(std::size_t region, std::size_t offset, const void* data, std::size_t size) override {
+        uploads++;
+        ASSERT_LE(offset + size, region < frameCount ? getCapacity() : getStableCapacity());
+        std::memcpy(memory.data() + region * getCapacity() + offset, data, size);
+    }
+};
+
+using Uniforms = std::array<float, 4>;
+
+} // namespace
+
+TEST(UniformArena, Alignment) {
+    TestArena arena;
+    const Uniforms a{1, 2, 3, 4};
+    const float b = 5;
+    UniformArena::Block blockA(arena, &a, sizeof(a));
+    UniformArena::Block blockB(arena, &b, sizeof(b));
+    UniformArena::Block blockC(arena, &b, sizeof(b));
+
+    EXPECT_EQ(0u, blockA.getBindingOffset() % arena.getAlignment());
+    EXPECT_EQ(0u, blockB.getBindingOffset() % arena.getAlignment());
+    EXPECT_EQ(0u, blockC.getBindingOffset() % arena.getAlignment());
+    EXPECT_EQ(48u, arena.getUsedBytes());
+    EXPECT_EQ(a, arena.read<Uniforms>(blockA));
+    EXPECT_EQ(b, arena.read<float>(blockB));
+}
+
+TEST(UniformArena, WriteAppends) {
+    TestArena arena;
+    const Uniforms a{1, 2, 3, 4};
+    const Uniforms b{5, 6, 7, 8};
+    UniformArena::Block block(arena, &a, sizeof(a));
+    const auto offset = block.getBindingOffset();
+
+    // The data of the draw call made before stays intact
+    block.write(&b, sizeof(b));
+    EXPECT_NE(offset, block.getBindingOffset());
+    EXPECT_EQ(b, arena.read<Uniforms>(block));
+    Uniforms previous;
+    std::memcpy(&previous, arena.memory.data() + offset, sizeof(previous));
+    EXPECT_EQ(a, previous);
+
+    // Only part of the contents
+    const float c = 9;
+    block.write(&c, sizeof(c));
+    EXPECT_EQ((Uniforms{9, 6, 7, 8}), arena.read<Uniforms>(block));
+    EXPECT_EQ(3u, arena.uploads);
+}
+
+TEST(UniformArena, BecomesStable) {
+    TestArena arena;
+    const Uniforms a{1, 2, 3, 4};
+    UniformArena::Block block(arena, &a, sizeof(a));
+    EXPECT_EQ(a, arena.read<Uniforms>(block));
+
+    for (std::size_t frame = 1; frame <= 2 * UniformArena::frameCount; frame++) {
+        arena.beginFrame();
+        // Not written again, but still readable once its region is reused
+        EXPECT_EQ(a, arena.read<Uniforms>(block));
+        arena.endFrame();
+    }
+    EXPECT_EQ(2 * UniformArena::frameCount, arena.waits);
+    EXPECT_EQ(2 * UniformArena::frameCount, arena.fences);
+
+    // Moved after the regions once, and not uploaded again since
+    EXPECT_EQ(UniformArena::frameCount * arena.getCapacity(), block.getBindingOffset());
+    EXPECT_EQ(0u, arena.getUsedBytes());
+    EXPECT_EQ(16u, arena.getStableUsedBytes());
+    EXPECT_EQ(2u, arena.uploads);
+
+    // Written again, it's streamed from the current region
+    const Uniforms b{5, 6, 7, 8};
+    block.write(&b, sizeof(b));
+    EXPECT_EQ(arena.getCurrentRegion() * arena.getCapacity(), block.getBindingOffset());
+    EXPECT_EQ(b, arena.read<Uniforms>(block));
+}
+
+TEST(UniformArena, StableSpaceReusedAfterFramesInFlight) {
+    TestArena arena;
+    const Uniforms a{1, 2, 3, 4};
+    const auto nextFrame = [&] {
+        arena.endFrame();
+        arena.beginFrame();
+    };
+
+    std::optional<UniformArena::Block> first(std::in_place, arena, &a, sizeof(a));
+    for (std::size_t frame = 0; frame < UniformArena::frameCount; frame++) {
+        nextFrame();
+    }
+
+    // Made stable when its region was reused
+    EXPECT_EQ(UniformArena::frameCount * arena.getCapacity(), first->getBindingOffset());
+    EXPECT_EQ(16u, arena.getStableUsedBytes());
+    const auto stableOffset = first->getBindingOffset();
+    UniformArena::Block second(arena, &a, sizeof(a));
+    nextFrame();
+
+    // Frames in flight may still read the range of the destroyed block, it's not reused until they're done
+    first.reset();
+    nextFrame();
+    nextFrame();
+    EXPECT_EQ(32u, arena.getStableUsedBytes());
+    EXPECT_NE(stableOffset, second.getBindingOffset());
+
+    UniformArena::Block third(arena, &a, sizeof(a));
+    for (std::size_t frame = 0; frame < UniformArena::frameCount; frame++) {
+        nextFrame();
+    }
+    EXPECT_EQ(32u, arena.getStableUsedBytes());
+    EXPECT_EQ(stableOffset, third.getBindingOffset());
+    EXPECT_EQ(a, arena.read<Uniforms>(second));
+    EXPECT_EQ(a, arena.read<Uniforms>(third));
+    arena.endFrame();
+}
+
+TEST(UniformArena, DestroyedBlocksAreDropped) {
+    TestArena arena;
+    const Uniforms a{1, 2, 3, 4};
+    UniformArena::Block kept(arena, &a, sizeof(a));
+    { UniformArena::Block dropped(arena, &a, sizeof(a)); }
+    arena.flush();
+
+    for (std::size_t frame = 0; frame < UniformArena::frameCount; frame++) {
+        arena.beginFrame();
+        arena.endFrame();
+    }
+    // Back in the first region, only the block still alive was kept
+    EXPECT_EQ(0u, arena.getCurrentRegion());
+    EXPECT_EQ(0u, arena.getUsedBytes());
+    EXPECT_EQ(16u, arena.getStableUsedBytes());
+    EXPECT_EQ(a, arena.read<Uniforms>(kept));
+}
+
+TEST(UniformArena, Grow) {
+    TestArena arena;
+    const Uniforms a{1, 2, 3, 4};
+    UniformArena::Block first(arena, &a, sizeof(a));
+    arena.flush();
+    EXPECT_EQ(64u, arena.getCapacity());
+
+    // Written in the next frame, the first block stays in the region of the previous one
+    arena.beginFrame();
+    std::vector<UniformArena::Block> blocks;
+    blocks.reserve(8);
+    for (float i = 0; i < 8; i++) {
+        const Uniforms value{i, i, i, i};
+        blocks.emplace_back(arena, &value, sizeof(value));
+    }
+    const auto resizes = arena.resizes;
+    EXPECT_EQ(0u, blocks.back().getBindingOffset() % arena.getAlignment());
+    EXPECT_EQ(resizes + 1, arena.resizes);
+    EXPECT_EQ(256u, arena.getCapacity());
+
+    // All blocks moved into the current region of the new buffer
+    EXPECT_EQ(a, arena.read<Uniforms>(first));
+    for (float i = 0; i < 8; i++) {
+        EXPECT_EQ((Uniforms{i, i, i, i}), arena.read<Uniforms>(blocks[static_cast<std::size_t>(i)]));
+    }
+    arena.endFrame();
+}
+
+TEST(UniformArena, MoveAndCopy) {
+    TestArena arena;
+    const Uniforms a{1, 2, 3, 4};
+    UniformArena::Block original(arena, &a, sizeof(a));
+    UniformArena::Block copy(original);
+    UniformArena::Block moved(std::move(original));
+    EXPECT_NE(copy.getBindingOffset(), moved.getBindingOffset());
+    EXPECT_EQ(a, arena.read<Uniforms>(copy));
+    EXPECT_EQ(a, arena.read<Uniforms>(moved));
+
+    // Moving the moved-from block again leaves the arena alone
+    UniformArena::Block empty(std::move(original));
+    EXPECT_EQ(a, arena.read<Uniforms>(moved));
+
+    // The moved block is kept, the moved-from ones have nothing left to keep
+    for (std::size_t frame = 0; frame < UniformArena::frameCount; frame++) {
+        arena.beginFrame();
+        arena.endFrame();
+    }
+    EXPECT_EQ(32u, arena.getStableUsedBytes());
+    EXPECT_EQ(a, arena.read<Uniforms>(moved));
+    EXPECT_EQ(a, arena.read<Uniforms>(copy));
+}
@@ -0,0 +1,85 @@
+#include <mbgl/test/util.hpp>
+
+#include <mbgl/gfx/vertex_vector.hpp>
+
+#include <algorithm>
+
+using namespace mbgl;
+
+namespace {
+
+gfx::VertexVector<uint8_t> uploadedVector() {
+    gfx::VertexVector<uint8_t> vector;
+    vector.extend(1024, 0);
+    vector.updateModified();
+    vector.resetModifiedRanges();
+    return vector;
+}
+
+} // namespace
+
+TEST(VertexVector, FullyModifiedUntilUploaded) {
+    gfx::VertexVector<uint8_t> vector;
+    vector.extend(16, 0);
+    vector.updateModifiedRange(0, 4);
+    EXPECT_TRUE(vector.getModifiedRanges().empty());
+
+    vector.resetModifiedRanges();
+    vector.updateModifiedRange(0, 4);
+    ASSERT_EQ(1u, vector.getModifiedRanges().size());
+}
+
+TEST(VertexVector, MergesModifiedRanges) {
+    auto vector = uploadedVector();
+    const auto uploaded = vector.getLastModified();
+
+    vector.updateModifiedRange(16, 32);
+    vector.updateModifiedRange(32, 48);
+    vector.updateModifiedRange(100, 120);
+    vector.updateModifiedRange(8, 20);
+    EXPECT_TRUE(vector.isModifiedAfter(uploaded));
+
+    const auto& ranges = vector.getModifiedRanges();
+    ASSERT_EQ(2u, ranges.size());
+    EXPECT_EQ(8u, ranges[0].begin);
+    EXPECT_EQ(48u, ranges[0].end);
+    EXPECT_EQ(100u, ranges[1].begin);
+    EXPECT_EQ(120u, ranges[1].end);
+}
+
+TEST(VertexVector, CollapsesManyModifiedRanges) {
+    auto vector = uploadedVector();
+    for (std::size_t i = 0; i < 100; ++i) {
+        vector.updateModifiedRange(i * 10, i * 10 + 1);
+    }
+
+    const auto& ranges = vector.getModifiedRanges();
+    ASSERT_FALSE(ranges.empty());
+    EXPECT_LT(ranges.size(), 100u);
+    std::size_t begin = 1024;
+    std::size_t end = 0;
+    for (const auto& range : ranges) {
+        begin = std::min(begin, range.begin);
+        end = std::max(end, range.end);
+    }
+    EXPECT_EQ(0u, begin);
+    EXPECT_EQ(991u, end);
+}
+
+TEST(VertexVector, FullModificationOverridesRanges) {
+    auto vector = uploadedVector();
+    vector.updateModifiedRange(0, 4);
+    vector.updateModified(true);
+    EXPECT_TRUE(vector.getModifiedRanges().empty());
+
+    // Still pending in full until uploaded
+    vector.updateModifiedRange(8, 12);
+    EXPECT_TRUE(vector.getModifiedRanges().empty());
+}
+
+TEST(VertexVector, UnsyncedChangesOverrideRanges) {
+    auto vector = uploadedVector();
+    vector.emplace_back(1);
+    vector.updateModifiedRange(0, 4);
+    EXPECT_TRUE(vector.getModifiedRanges().empty());
+}
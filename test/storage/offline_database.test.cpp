@@ -1325,6 +1325,62 @@ TEST(OfflineDatabase, HasRegionResourceTile) {
     EXPECT_EQ(0u, log.uncheckedCount());
 }
 
+TEST(OfflineDatabase, HasRegionTiles) {
+    FixtureLog log;
+    OfflineDatabase db(":memory:", fixture::tileServerOptions);
+
+    OfflineTilePyramidRegionDefinition definition{"", LatLngBounds::world(), 0, INFINITY, 1.0, false};
+    auto region = db.createRegion(definition, OfflineRegionMetadata());
+    ASSERT_TRUE(region);
+
+    auto tile = [](std::string urlTemplate, int32_t x, int32_t y, int8_t z) {
+        return Resource::TileData{.urlTemplate = std::move(urlTemplate), .pixelRatio = 1, .x = x, .y = y, .z = z};
+    };
+
+    auto put = [&](const Resource::TileData& tileData, const std::string& data) {
+        Resource resource{Resource::Tile, tileData.urlTemplate};
+        resource.tileData = tileData;
+        Response response;
+        response.data = std::make_shared<std::string>(data);
+        db.putRegionResource(region->getID(), resource, response);
+    };
+
+    put(tile("http://example.com/a", 1, 1, 2), "one");
+    put(tile("http://example.com/a", 3, 2, 2), "three");
+    put(tile("http://example.com/b", 2, 2, 2), "other source");
+    put(tile("http://example.com/a", 2, 2, 3), "other zoom");
+
+    auto sizes = db.hasRegionTiles({tile("http://example.com/a", 1, 1, 2),
+                                    tile("http://example.com/a", 2, 2, 2),
+                                    tile("http://example.com/a", 3, 2, 2),
+                                    tile("http://example.com/b", 2, 2, 2),
+                                    tile("http://example.com/b", 3, 2, 2),
+                                    tile("http://example.com/a", 2, 2, 3)});
+    ASSERT_EQ(6u, sizes.size());
+    EXPECT_EQ(3, sizes[0]);
+    EXPECT_EQ(std::nullopt, sizes[1]);
+    EXPECT_EQ(5, sizes[2]);
+    EXPECT_EQ(12, sizes[3]);
+    EXPECT_EQ(std::nullopt, sizes[4]);
+    EXPECT_EQ(10, sizes[5]);
+
+    // Tiles given row by row map back to their own positions.
+    put(tile("http://example.com/a", 1, 3, 2), "column");
+    sizes = db.hasRegionTiles({tile("http://example.com/a", 3, 2, 2),
+                               tile("http://example.com/a", 1, 3, 2),
+                               tile("http://example.com/a", 1, 1, 2),
+                               tile("http://example.com/a", 1, 2, 2)});
+    ASSERT_EQ(4u, sizes.size());
+    EXPECT_EQ(5, sizes[0]);
+    EXPECT_EQ(6, sizes[1]);
+    EXPECT_EQ(3, sizes[2]);
+    EXPECT_EQ(std::nullopt, sizes[3]);
+
+    EXPECT_TRUE(db.hasRegionTiles({}).empty());
+
+    EXPECT_EQ(0u, log.uncheckedCount());
+}
+
 TEST(OfflineDatabase, OfflineMapboxTileCount) {
     FixtureLog log;
     OfflineDatabase db(":memory:", fixture::tileServerOptions);
@@ -1413,6 +1469,46 @@ TEST(OfflineDatabase, BatchInsertion) {
     EXPECT_EQ(0u, log.uncheckedCount());
 }
 
+TEST(OfflineDatabase, BatchInsertionCompressed) {
+    FixtureLog log;
+    OfflineDatabase db(":memory:", fixture::tileServerOptions);
+
+    OfflineTilePyramidRegionDefinition definition{"", LatLngBounds::world(), 0, INFINITY, 1.0, true};
+    auto region = db.createRegion(definition, OfflineRegionMetadata());
+    ASSERT_TRUE(region);
+
+    Response compressible;
+    compressible.data = std::make_shared<std::string>(4096, 'a');
+    Response random;
+    random.data = randomString(1024);
+
+    // Compressed up front, only when that makes the data smaller
+    auto compressedData = OfflineDatabase::compressData(compressible);
+    ASSERT_TRUE(compressedData);
+    EXPECT_LT(compressedData->size(), compressible.data->size());
+    EXPECT_FALSE(OfflineDatabase::compressData(random));
+    EXPECT_FALSE(OfflineDatabase::compressData(Response()));
+
+    const auto compressedSize = compressedData->size();
+    std::list<std::tuple<Resource, Response, std::optional<std::string>>> resources;
+    resources.emplace_back(Resource::style("http://example.com/compressible"), compressible, std::move(compressedData));
+    resources.emplace_back(Resource::style("http://example.com/random"), random, std::nullopt);
+
+    OfflineRegionStatus status;
+    db.putRegionResources(region->getID(), resources, status);
+    EXPECT_EQ(2u, status.completedResourceCount);
+    EXPECT_EQ(compressedSize + random.data->size(), status.completedResourceSize);
+
+    auto stored = db.get(Resource::style("http://example.com/compressible"));
+    ASSERT_TRUE(stored && stored->data);
+    EXPECT_EQ(*compressible.data, *stored->data);
+    stored = db.get(Resource::style("http://example.com/random"));
+    ASSERT_TRUE(stored && stored->data);
+    EXPECT_EQ(*random.data, *stored->data);
+
+    EXPECT_EQ(0u, log.uncheckedCount());
+}
+
 TEST(OfflineDatabase, BatchInsertionMapboxTileCountExceeded) {
     FixtureLog log;
     OfflineDatabase db(":memory:", fixture::tileServerOptions);
@@ -18,6 +18,8 @@
 #include <mbgl/storage/sqlite3.hpp>
 #include <gtest/gtest.h>
 
+#include <set>
+
 using namespace mbgl;
 using namespace std::literals::string_literals;
 using mapbox::sqlite::ResultCode;
@@ -1160,3 +1162,104 @@ TEST(OfflineDownload, NoFreezingOnNotFoundError) {
     test.loop.run();
     // Passes if does not freeze.
 }
+
+TEST(OfflineDownload, HostConcurrencyBacksOffOnErrors) {
+    using namespace std::chrono_literals;
+    HostConcurrency host(8);
+    EXPECT_EQ(8u, host.getLimit());
+
+    for (int i = 0; i < 8; i++) {
+        host.requestStarted();
+    }
+    EXPECT_FALSE(host.hasCapacity());
+
+    // A burst of failures from the same requests halves the limit only once.
+    host.requestFailed();
+    host.requestFailed();
+    EXPECT_EQ(4u, host.getLimit());
+    EXPECT_EQ(8u, host.getInFlight());
+
+    for (int i = 0; i < 8; i++) {
+        host.requestSucceeded(10ms);
+    }
+    EXPECT_EQ(0u, host.getInFlight());
+    EXPECT_TRUE(host.hasCapacity());
+
+    // Successful responses grow the limit back, but not past the maximum.
+    for (int i = 0; i < 100; i++) {
+        host.requestStarted();
+        host.requestSucceeded(10ms);
+    }
+    EXPECT_EQ(8u, host.getLimit());
+}
+
+TEST(OfflineDownload, HostConcurrencyBacksOffOnLatency) {
+    using namespace std::chrono_literals;
+    HostConcurrency host(16);
+
+    for (int i = 0; i < 4; i++) {
+        host.requestStarted();
+        host.requestSucceeded(10ms);
+    }
+    EXPECT_EQ(16u, host.getLimit());
+
+    // Responses slowing down well beyond the fastest one are a sign of congestion.
+    for (int i = 0; i < 16; i++) {
+        host.requestStarted();
+        host.requestSucceeded(200ms);
+    }
+    EXPECT_GT(16u, host.getLimit());
+    EXPECT_LE(1u, host.getLimit());
+}
+
+TEST(OfflineDownload, SpreadsTileRequestsOverHosts) {
+    OfflineTest test;
+    auto region = test.createRegion();
+    ASSERT_TRUE(region);
+    OfflineDownload download(region->getID(),
+                             OfflineTilePyramidRegionDefinition(
+                                 "http://127.0.0.1:3000/style.json", LatLngBounds::world(), 1.0, 1.0, 1.0, true),
+                             test.db,
+                             test.fileSource);
+
+    test.fileSource.styleResponse = [&](const Resource&) {
+        Response response;
+        response.data = std::make_shared<std::string>(R"STYLE({
+          "version": 8,
+          "sources": {
+            "mirrored": {
+              "type": "vector",
+              "tiles": ["http://a.example.com/{z}-{x}-{y}.pbf", "http://b.example.com/{z}-{x}-{y}.pbf"]
+            }
+          },
+          "layers": []
+        })STYLE");
+        return response;
+    };
+
+    std::set<std::string> urls;
+    test.fileSource.tileResponse = [&](const Resource& resource) {
+        // Every tile is stored under the first template, whichever host served it.
+        EXPECT_EQ("http://a.example.com/{z}-{x}-{y}.pbf", resource.tileData->urlTemplate);
+        urls.insert(resource.url);
+        return test.response("0-0-0.vector.pbf");
+    };
+
+    auto observer = std::make_unique<MockObserver>();
+    observer->statusChangedFn = [&](OfflineRegionStatus status) {
+        if (status.complete()) {
+            test.loop.stop();
+        }
+    };
+
+    download.setObserver(std::move(observer));
+    download.setState(OfflineRegionDownloadState::Active);
+
+    test.loop.run();
+
+    EXPECT_EQ((std::set<std::string>{"http://a.example.com/1-0-0.pbf",
+                                     "http://b.example.com/1-0-1.pbf",
+                                     "http://b.example.com/1-1-0.pbf",
+                                     "http://a.example.com/1-1-1.pbf"}),
+              urls);
+}
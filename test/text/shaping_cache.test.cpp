@@ -0,0 +1,154 @@
+#include <mbgl/test/util.hpp>
+
+#include <mbgl/text/bidi.hpp>
+#include <mbgl/text/shaping_cache.hpp>
+#include <mbgl/text/tagged_string.hpp>
+#include <mbgl/util/constants.hpp>
+
+using namespace mbgl;
+using namespace util;
+
+namespace {
+
+const std::vector<std::string> fontStack{{"font-stack"}};
+
+GlyphMetrics metrics(uint32_t advance) {
+    GlyphMetrics result;
+    result.width = 18;
+    result.height = 18;
+    result.left = 2;
+    result.top = -8;
+    result.advance = advance;
+    return result;
+}
+
+class Glyphs {
+public:
+    Glyphs(uint32_t advance, Rect<uint16_t> rect, const std::u16string& codePoints = u"ab ") {
+        for (char16_t codePoint : codePoints) {
+            Glyph glyph;
+            glyph.id = codePoint;
+            glyph.metrics = metrics(advance);
+            glyphMap[FontStackHasher()(fontStack)].emplace(codePoint,
+                                                           Immutable<Glyph>(makeMutable<Glyph>(std::move(glyph))));
+            glyphPositions[FontStackHasher()(fontStack)].emplace(codePoint, GlyphPosition{rect, metrics(advance)});
+        }
+    }
+
+    GlyphMap glyphMap;
+    GlyphPositions glyphPositions;
+};
+
+Shaping shape(ShapingCache& cache, const std::u16string& text, const Glyphs& glyphs, float maxWidthInEms = 10) {
+    BiDi bidi;
+    ImagePositions imagePositions;
+    return cache.getShaping(TaggedString(text, SectionOptions(1.0, fontStack, GlyphIDType::FontPBF, 0)),
+                            maxWidthInEms * ONE_EM,
+                            ONE_EM, // lineHeight
+                            style::SymbolAnchorType::Center,
+                            style::TextJustifyType::Center,
+                            0,              // spacing
+                            {{0.0f, 0.0f}}, // translate
+                            WritingModeType::Horizontal,
+                            bidi,
+                            glyphs.glyphMap,
+                            glyphs.glyphPositions,
+                            imagePositions,
+                            16.0f,
+                            16.0f,
+                            /*allowVerticalPlacement*/ false);
+}
+
+} // namespace
+
+TEST(ShapingCache, HitUsesTileGlyphPositions) {
+    ShapingCache cache;
+    const Glyphs tileA(21, {1, 2, 24, 24});
+    const Glyphs tileB(21, {30, 40, 24, 24});
+
+    const Shaping first = shape(cache, u"ab ab", tileA);
+    const Shaping second = shape(cache, u"ab ab", tileB);
+
+    EXPECT_EQ(1u, cache.getStats().hits);
+    EXPECT_EQ(1u, cache.getStats().misses);
+    EXPECT_EQ(1u, cache.getStats().size);
+
+    EXPECT_EQ(first.left, second.left);
+    EXPECT_EQ(first.right, second.right);
+    EXPECT_EQ(first.top, second.top);
+    EXPECT_EQ(first.bottom, second.bottom);
+    ASSERT_EQ(first.positionedLines.size(), second.positionedLines.size());
+    const auto& firstGlyphs = first.positionedLines[0].positionedGlyphs;
+    const auto& secondGlyphs = second.positionedLines[0].positionedGlyphs;
+    ASSERT_EQ(firstGlyphs.size(), secondGlyphs.size());
+    for (std::size_t i = 0; i < firstGlyphs.size(); ++i) {
+        EXPECT_EQ(firstGlyphs[i].x, secondGlyphs[i].x);
+        EXPECT_EQ(firstGlyphs[i].y, secondGlyphs[i].y);
+        EXPECT_EQ(Rect<uint16_t>(1, 2, 24, 24), firstGlyphs[i].rect);
+        EXPECT_EQ(Rect<uint16_t>(30, 40, 24, 24), secondGlyphs[i].rect);
+    }
+}
+
+TEST(ShapingCache, KeyIncludesLayout) {
+    ShapingCache cache;
+    const Glyphs glyphs(21, {});
+
+    const Shaping wide = shape(cache, u"ab ab", glyphs, 10);
+    const Shaping narrow = shape(cache, u"ab ab", glyphs, 1);
+
+    EXPECT_EQ(0u, cache.getStats().hits);
+    EXPECT_EQ(2u, cache.getStats().misses);
+    EXPECT_EQ(1u, wide.positionedLines.size());
+    EXPECT_EQ(2u, narrow.positionedLines.size());
+}
+
+TEST(ShapingCache, MissOnDifferentMetrics) {
+    ShapingCache cache;
+
+    const Shaping narrow = shape(cache, u"ab", Glyphs(10, {}));
+    const Shaping wide = shape(cache, u"ab", Glyphs(20, {}));
+
+    EXPECT_EQ(0u, cache.getStats().hits);
+    EXPECT_EQ(2u, cache.getStats().misses);
+    EXPECT_LT(narrow.right - narrow.left, wide.right - wide.left);
+
+    // The entry was replaced with the new metrics.
+    shape(cache, u"ab", Glyphs(20, {}));
+    EXPECT_EQ(1u, cache.getStats().hits);
+    EXPECT_EQ(1u, cache.getStats().size);
+}
+
+TEST(ShapingCache, MissOnDifferentMissingGlyphs) {
+    ShapingCache cache;
+
+    // Made for a tile without the glyph of "b", which is left out
+    const Shaping partial = shape(cache, u"ab", Glyphs(21, {}, u"a"));
+    ASSERT_EQ(1u, partial.positionedLines.size());
+    EXPECT_EQ(1u, partial.positionedLines[0].positionedGlyphs.size());
+
+    const Shaping complete = shape(cache, u"ab", Glyphs(21, {}));
+    EXPECT_EQ(0u, cache.getStats().hits);
+    EXPECT_EQ(2u, cache.getStats().misses);
+    ASSERT_EQ(1u, complete.positionedLines.size());
+    EXPECT_EQ(2u, complete.positionedLines[0].positionedGlyphs.size());
+
+    shape(cache, u"ab", Glyphs(21, {}));
+    EXPECT_EQ(1u, cache.getStats().hits);
+}
+
+TEST(ShapingCache, EvictsLeastRecentlyUsed) {
+    ShapingCache cache(2);
+    const Glyphs glyphs(21, {});
+
+    shape(cache, u"a", glyphs);
+    shape(cache, u"b", glyphs);
+    shape(cache, u"a", glyphs);
+    shape(cache, u"ab", glyphs); // Evicts "b".
+    EXPECT_EQ(2u, cache.getStats().size);
+
+    shape(cache, u"a", glyphs);
+    EXPECT_EQ(2u, cache.getStats().hits);
+    shape(cache, u"b", glyphs);
+    EXPECT_EQ(2u, cache.getStats().hits);
+    EXPECT_EQ(4u, cache.getStats().misses);
+}
@@ -0,0 +1,204 @@
+#include <mbgl/test/util.hpp>
+#include <mbgl/test/fake_file_source.hpp>
+
+#include <mbgl/annotation/annotation_manager.hpp>
+#include <mbgl/gfx/dynamic_texture_atlas.hpp>
+#include <mbgl/map/transform.hpp>
+#include <mbgl/renderer/buckets/circle_bucket.hpp>
+#include <mbgl/renderer/image_manager.hpp>
+#include <mbgl/renderer/tile_parameters.hpp>
+#include <mbgl/renderer/tile_render_data.hpp>
+#include <mbgl/style/layers/circle_layer.hpp>
+#include <mbgl/style/layers/circle_layer_impl.hpp>
+#include <mbgl/style/style.hpp>
+#include <mbgl/text/glyph_manager.hpp>
+#include <mbgl/tile/geojson_tile_data.hpp>
+#include <mbgl/tile/geometry_tile.hpp>
+#include <mbgl/tile/tile_worker_stats.hpp>
+#include <mbgl/util/run_loop.hpp>
+
+#include <atomic>
+#include <functional>
+#include <memory>
+
+using namespace mbgl;
+using namespace mbgl::style;
+
+namespace {
+
+constexpr std::size_t featureCount = 64;
+
+class GeometryTileWorkerTest {
+public:
+    util::SimpleIdentity uniqueID;
+    std::shared_ptr<FileSource> fileSource = std::make_shared<FakeFileSource>();
+    TransformState transformState;
+    util::RunLoop loop;
+    AnnotationManager annotationManager{style};
+    std::shared_ptr<ImageManager> imageManager = std::make_shared<ImageManager>();
+    std::shared_ptr<GlyphManager> glyphManager = std::make_shared<GlyphManager>();
+    gfx::DynamicTextureAtlasPtr dynamicTextureAtlas;
+    std::shared_ptr<TileWorkerStats> stats = std::make_shared<TileWorkerStats>();
+
+    TileParameters tileParameters;
+    style::Style style;
+
+    CircleLayer layer{"circle", "source"};
+    Immutable<LayerProperties> layerProperties = makeMutable<CircleLayerProperties>(
+        staticImmutableCast<CircleLayer::Impl>(layer.baseImpl));
+
+    GeometryTileWorkerTest()
+        : tileParameters{.pixelRatio = 1.0,
+                         .debugOptions = MapDebugOptions(),
+                         .transformState = transformState,
+                         .fileSource = fileSource,
+                         .mode = MapMode::Continuous,
+                         .annotationManager = annotationManager.makeWeakPtr(),
+                         .imageManager = imageManager,
+                         .glyphManager = glyphManager,
+                         .prefetchZoomDelta = 0,
+                         .threadPool = {Scheduler::GetBackground(), uniqueID},
+                         .dynamicTextureAtlas = dynamicTextureAtlas,
+                         .tileWorkerStats = stats},
+          style{fileSource, 1, tileParameters.threadPool} {}
+
+    void waitFor(const std::function<bool()>& condition) {
+        while (!condition()) {
+            loop.runOnce();
+        }
+    }
+
+    std::size_t circleVertices(GeometryTile& tile) {
+        const auto renderData = tile.createRenderData();
+        const auto* bucket = static_cast<const CircleBucket*>(renderData->getBucket(*layer.baseImpl));
+        return bucket ? bucket->vertices.elements() : 0;
+    }
+};
+
+// Calls `onFeature` with the index of every feature the worker reads
+class HookedLayer : public GeoJSONTileLayer {
+public:
+    HookedLayer(std::shared_ptr<const mapbox::feature::feature_collection<int16_t>> features_,
+                std::shared_ptr<std::function<void(std::size_t)>> onFeature_)
+        : GeoJSONTileLayer(std::move(features_)),
+          onFeature(std::move(onFeature_)) {}
+
+    std::unique_ptr<GeometryTileFeature> getFeature(std::size_t i) const override {
+        if (*onFeature) {
+            (*onFeature)(i);
+        }
+        return GeoJSONTileLayer::getFeature(i);
+    }
+
+private:
+    std::shared_ptr<std::function<void(std::size_t)>> onFeature;
+};
+
+class HookedData : public GeometryTileData {
+public:
+    HookedData(std::shared_ptr<std::function<void(std::size_t)>> onFeature_)
+        : features(std::make_shared<mapbox::feature::feature_collection<int16_t>>()),
+          onFeature(std::move(onFeature_)) {
+        for (std::size_t i = 0; i < featureCount; i++) {
+            const auto coordinate = static_cast<int16_t>(i * 64);
+            features->push_back(mapbox::feature::feature<int16_t>{
+                mapbox::geometry::point<int16_t>(coordinate, coordinate)});
+        }
+    }
+
+    std::unique_ptr<GeometryTileData> clone() const override { return std::make_unique<HookedData>(*this); }
+
+    std::unique_ptr<GeometryTileLayer> getLayer(const std::string&) const override {
+        return std::make_unique<HookedLayer>(features, onFeature);
+    }
+
+private:
+    std::shared_ptr<mapbox::feature::feature_collection<int16_t>> features;
+    std::shared_ptr<std::function<void(std::size_t)>> onFeature;
+};
+
+// Parses the tile, calling `onMidParse` once from the worker when it's halfway through the features
+void parse(GeometryTileWorkerTest& test, GeometryTile& tile, std::function<void()> onMidParse = {}) {
+    auto hook = std::make_shared<std::function<void(std::size_t)>>();
+    if (onMidParse) {
+        auto fired = std::make_shared<std::atomic<bool>>(false);
+        *hook = [onMidParse, fired](std::size_t i) {
+            if (i == featureCount / 2 && !fired->exchange(true)) {
+                onMidParse();
+            }
+        };
+    }
+    tile.setLayers({test.layerProperties});
+    tile.setData(std::make_unique<HookedData>(hook));
+}
+
+} // namespace
+
+TEST(GeometryTileWorker, Complete) {
+    GeometryTileWorkerTest test;
+    GeometryTile tile(OverscaledTileID(0, 0, 0), "source", test.tileParameters);
+    parse(test, tile);
+    test.waitFor([&] { return tile.isComplete(); });
+
+    EXPECT_GT(test.circleVertices(tile), 0u);
+    EXPECT_EQ(0u, test.stats->abandonedParses);
+    EXPECT_EQ(0u, test.stats->skippedParses);
+}
+
+// A tile suspended before parsing skips the parse, and parses once it's visible again
+TEST(GeometryTileWorker, SuspendBeforeParse) {
+    GeometryTileWorkerTest test;
+    GeometryTile reference(OverscaledTileID(0, 0, 0), "source", test.tileParameters);
+    parse(test, reference);
+    test.waitFor([&] { return reference.isComplete(); });
+
+    GeometryTile tile(OverscaledTileID(0, 0, 0), "source", test.tileParameters);
+    tile.setVisible(false);
+    parse(test, tile);
+    test.waitFor([&] { return test.stats->skippedParses == 1; });
+    EXPECT_FALSE(tile.isComplete());
+
+    tile.setVisible(true);
+    test.waitFor([&] { return tile.isComplete(); });
+    EXPECT_EQ(test.circleVertices(reference), test.circleVertices(tile));
+    EXPECT_EQ(0u, test.stats->abandonedParses);
+}
+
+// A tile suspended while parsing abandons the partial result, and parses again once it's resumed
+TEST(GeometryTileWorker, SuspendDuringParse) {
+    GeometryTileWorkerTest test;
+    GeometryTile reference(OverscaledTileID(0, 0, 0), "source", test.tileParameters);
+    parse(test, reference);
+    test.waitFor([&] { return reference.isComplete(); });
+
+    GeometryTile tile(OverscaledTileID(0, 0, 0), "source", test.tileParameters);
+    parse(test, tile, [&] { tile.setVisible(false); });
+    test.waitFor([&] { return test.stats->abandonedParses == 1; });
+    EXPECT_FALSE(tile.isComplete());
+
+    tile.setVisible(true);
+    test.waitFor([&] { return tile.isComplete(); });
+    EXPECT_EQ(test.circleVertices(reference), test.circleVertices(tile));
+    EXPECT_EQ(1u, test.stats->abandonedParses);
+    EXPECT_EQ(0u, test.stats->skippedParses);
+}
+
+// The suspension is lifted before the parse reaches its next checkpoint. The parse may have
+// stopped early already, so it's abandoned anyway and the tile gets parsed again.
+TEST(GeometryTileWorker, ResumeBeforeCheckpoint) {
+    GeometryTileWorkerTest test;
+    GeometryTile reference(OverscaledTileID(0, 0, 0), "source", test.tileParameters);
+    parse(test, reference);
+    test.waitFor([&] { return reference.isComplete(); });
+
+    GeometryTile tile(OverscaledTileID(0, 0, 0), "source", test.tileParameters);
+    parse(test, tile, [&] {
+        tile.setVisible(false);
+        tile.setVisible(true);
+    });
+    test.waitFor([&] { return tile.isComplete(); });
+
+    EXPECT_EQ(test.circleVertices(reference), test.circleVertices(tile));
+    EXPECT_EQ(1u, test.stats->abandonedParses);
+    EXPECT_EQ(0u, test.stats->skippedParses);
+}
@@ -19,6 +19,7 @@
 #include <mbgl/test/vector_tile_test.hpp>
 #include <mbgl/text/glyph_manager.hpp>
 
+#include <algorithm>
 #include <memory>
 
 using namespace mbgl;
@@ -85,3 +86,48 @@ TEST(VectorTileData, ParseResults) {
 
     ASSERT_EQ(feature->getValue("invalid"), std::nullopt);
 }
+
+TEST(VectorTile, VisitGeometriesMatchesGetGeometries) {
+    VectorMVTTileData data(
+        std::make_shared<std::string>(util::read_file("test/fixtures/api/assets/streets/10-163-395.vector.pbf")));
+
+    std::size_t visited = 0;
+    for (const auto& name : data.layerNames()) {
+        auto layer = data.getLayer(name);
+        ASSERT_TRUE(layer);
+        for (std::size_t i = 0; i < layer->featureCount(); ++i) {
+            // Separate feature objects, as visiting uses an already decoded collection.
+            auto streamed = layer->getFeature(i);
+            const GeometryCollection expected = layer->getFeature(i)->getGeometries().clone();
+
+            streamed->visitGeometries([&](GeometryRingsView rings) {
+                ASSERT_EQ(expected.size(), rings.size());
+                for (std::size_t r = 0; r < rings.size(); ++r) {
+                    EXPECT_TRUE(std::equal(expected[r].begin(), expected[r].end(), rings[r].begin(), rings[r].end()));
+                }
+                visited++;
+            });
+        }
+    }
+    EXPECT_LT(0u, visited);
+}
+
+TEST(VectorTile, GetValueByKey) {
+    VectorMVTTileData data(
+        std::make_shared<std::string>(util::read_file("test/fixtures/api/assets/streets/10-163-395.vector.pbf")));
+
+    const PropertyKey nameKey("name");
+    const PropertyKey missingKey("no such key");
+    std::size_t found = 0;
+    for (const auto& name : data.layerNames()) {
+        auto layer = data.getLayer(name);
+        for (std::size_t i = 0; i < layer->featureCount(); ++i) {
+            auto feature = layer->getFeature(i);
+            const auto value = feature->getValueByKey(nameKey);
+            EXPECT_EQ(feature->getValue("name"), value);
+            EXPECT_FALSE(feature->getValueByKey(missingKey));
+            found += value ? 1 : 0;
+        }
+    }
+    EXPECT_LT(0u, found);
+}
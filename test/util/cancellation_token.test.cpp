@@ -0,0 +1,53 @@
+#include <mbgl/test/util.hpp>
+
+#include <mbgl/util/cancellation_token.hpp>
+
+using namespace mbgl;
+
+TEST(CancellationToken, Suspend) {
+    util::CancellationToken token;
+    EXPECT_FALSE(token.isCancelled());
+
+    EXPECT_TRUE(token.setSuspended(true));
+    EXPECT_FALSE(token.setSuspended(true));
+    EXPECT_TRUE(token.isSuspended());
+    EXPECT_TRUE(token.isCancelled());
+
+    EXPECT_TRUE(token.setSuspended(false));
+    EXPECT_FALSE(token.setSuspended(false));
+    EXPECT_FALSE(token.isCancelled());
+}
+
+TEST(CancellationToken, Abandon) {
+    util::CancellationToken token;
+    token.abandon();
+    EXPECT_TRUE(token.isAbandoned());
+    EXPECT_TRUE(token.isCancelled());
+
+    // Lifting a suspension doesn't revive abandoned work
+    token.setSuspended(true);
+    token.setSuspended(false);
+    EXPECT_TRUE(token.isCancelled());
+}
+
+TEST(CancellationToken, CancelledSince) {
+    util::CancellationToken token;
+    const auto start = token.getEpoch();
+    EXPECT_FALSE(token.isCancelledSince(start));
+
+    // Work started before a suspension stays cancelled after it's lifted
+    token.setSuspended(true);
+    token.setSuspended(false);
+    EXPECT_FALSE(token.isCancelled());
+    EXPECT_TRUE(token.isCancelledSince(start));
+
+    // Resuming doesn't cancel work started while suspended
+    token.setSuspended(true);
+    const auto suspended = token.getEpoch();
+    token.setSuspended(false);
+    EXPECT_FALSE(token.isCancelledSince(suspended));
+
+    const auto resumed = token.getEpoch();
+    token.abandon();
+    EXPECT_TRUE(token.isCancelledSince(resumed));
+}
@@ -2,6 +2,7 @@
 
 #include <mbgl/util/premultiply.hpp>
 #include <mbgl/util/image.hpp>
+#include <mbgl/util/image_encoder.hpp>
 #include <mbgl/util/io.hpp>
 
 using namespace mbgl;
@@ -34,6 +35,53 @@ TEST(Image, PNGRoundTripAlpha) {
     EXPECT_EQ(128, image.data[3]);
 }
 
+TEST(Image, PNGEncoderThreads) {
+    PremultipliedImage tile = decodeImage(util::read_file("test/fixtures/image/tile.png"));
+    // Large enough to be split between threads
+    PremultipliedImage rgba({1024, 1024});
+    for (uint32_t y = 0; y < rgba.size.height; y += tile.size.height) {
+        for (uint32_t x = 0; x < rgba.size.width; x += tile.size.width) {
+            PremultipliedImage::copy(tile, rgba, {0, 0}, {x, y}, tile.size);
+        }
+    }
+
+    for (std::size_t threads : {1, 4}) {
+        auto encoder = ImageEncoder::create({.compressionLevel = 1, .threads = threads});
+        ASSERT_TRUE(encoder);
+        // Encoding again reuses the buffers of the first image
+        EXPECT_EQ(encoder->encode(tile), encoder->encode(tile));
+        const PremultipliedImage image = decodeImage(encoder->encode(rgba));
+        EXPECT_EQ(rgba, image);
+    }
+}
+
+TEST(Image, JPEGEncoder) {
+    PremultipliedImage tile = decodeImage(util::read_file("test/fixtures/image/tile.png"));
+    auto encoder = ImageEncoder::create({.encoding = ImageEncoding::JPEG, .quality = 80});
+    if (!encoder) {
+        // Not every platform can encode JPEG, e.g. Darwin and Android only encode PNG
+        GTEST_SKIP() << "No JPEG encoder on this platform";
+    }
+    const PremultipliedImage image = decodeImage(encoder->encode(tile));
+    EXPECT_EQ(tile.size, image.size);
+}
+
+#if !defined(__QT__) // WebP support is not enabled in Qt by default
+TEST(Image, WebPEncoder) {
+    PremultipliedImage tile = decodeImage(util::read_file("test/fixtures/image/tile.png"));
+    auto lossy = ImageEncoder::create({.encoding = ImageEncoding::WebP, .quality = 80});
+    if (!lossy) {
+        GTEST_SKIP() << "No WebP encoder on this platform";
+    }
+    EXPECT_EQ(tile.size, decodeImage(lossy->encode(tile)).size);
+
+    // Lossless images lose only what unpremultiplying the colors loses, as PNGs do
+    auto lossless = ImageEncoder::create({.encoding = ImageEncoding::WebP, .quality = 100});
+    ASSERT_TRUE(lossless);
+    EXPECT_EQ(decodeImage(encodePNG(tile)), decodeImage(lossless->encode(tile)));
+}
+#endif
+
 TEST(Image, PNGReadNoProfile) {
     PremultipliedImage image = decodeImage(util::read_file("test/fixtures/image/no_profile.png"));
     EXPECT_EQ(128, image.data[0]);
@@ -146,6 +194,25 @@ TEST(Image, Move) {
     EXPECT_EQ(1u, moved.size.width);
 }
 
+TEST(Image, View) {
+    PremultipliedImage image({4, 3});
+    for (size_t i = 0; i < image.bytes(); i++) {
+        image.data[i] = static_cast<uint8_t>(i);
+    }
+
+    PremultipliedImageView view(image, {1, 1}, {2, 2});
+    EXPECT_EQ(image.data.get() + image.stride() + 4, view.data);
+    EXPECT_EQ(image.data.get() + 2 * image.stride() + 4, view.row(1));
+
+    PremultipliedImage copy = view.clone();
+    PremultipliedImage expected({2, 2});
+    PremultipliedImage::copy(image, expected, {1, 1}, {0, 0}, {2, 2});
+    EXPECT_EQ(expected, copy);
+
+    EXPECT_THROW(PremultipliedImageView(image, {3, 0}, {2, 2}), std::out_of_range);
+    EXPECT_THROW(PremultipliedImageView(image, {0, 0}, {5, 1}), std::out_of_range);
+}
+
 TEST(Image, Premultiply) {
     UnassociatedImage rgba({1, 1});
     rgba.data[0] = 255;
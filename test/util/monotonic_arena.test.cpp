@@ -0,0 +1,144 @@
+#include <mbgl/test/util.hpp>
+
+#include <mbgl/util/monotonic_arena.hpp>
+
+#include <cstdint>
+#include <cstring>
+
+using namespace mbgl;
+
+TEST(MonotonicArena, Alignment) {
+    util::MonotonicArena arena(64);
+
+    for (std::size_t alignment : {1u, 2u, 4u, 8u, 16u}) {
+        arena.allocate(1, 1);
+        void* p = arena.allocate(24, alignment);
+        EXPECT_EQ(0u, reinterpret_cast<std::uintptr_t>(p) % alignment);
+    }
+}
+
+TEST(MonotonicArena, ResetKeepsOneBlock) {
+    util::MonotonicArena arena(64);
+
+    for (int i = 0; i < 100; ++i) {
+        arena.allocate(48);
+    }
+    EXPECT_EQ(4800u, arena.bytesAllocated());
+    EXPECT_LT(1u, arena.blockCount());
+
+    arena.reset();
+    EXPECT_EQ(0u, arena.bytesAllocated());
+    EXPECT_EQ(1u, arena.blockCount());
+
+    // The retained block is the largest one, so a smaller round fits into it.
+    for (int i = 0; i < 10; ++i) {
+        arena.allocate(48);
+    }
+    EXPECT_EQ(1u, arena.blockCount());
+}
+
+TEST(MonotonicArena, ResetReleasesHugeBlocks) {
+    util::MonotonicArena arena;
+
+    arena.allocate(util::MonotonicArena::maxRetainedBlockSize + 1);
+    arena.reset();
+    EXPECT_EQ(0u, arena.blockCount());
+}
+
+TEST(MonotonicArena, AllocatorUsesCurrentArena) {
+    util::MonotonicArena arena;
+
+    util::ArenaVector<int> heap;
+    heap.resize(100);
+    EXPECT_EQ(0u, arena.bytesAllocated());
+
+    {
+        util::MonotonicArena::Scope scope(arena);
+        EXPECT_EQ(&arena, util::MonotonicArena::current());
+
+        util::ArenaVector<int> scratch;
+        scratch.resize(100);
+        EXPECT_LE(100 * sizeof(int), arena.bytesAllocated());
+
+        // Moving keeps the allocator, so the heap vector isn't freed into the arena.
+        util::ArenaVector<int> moved = std::move(heap);
+        EXPECT_EQ(100u, moved.size());
+    }
+
+    EXPECT_EQ(nullptr, util::MonotonicArena::current());
+}
+
+TEST(MonotonicArena, NestedScopes) {
+    util::MonotonicArena outer;
+    util::MonotonicArena inner;
+
+    util::MonotonicArena::Scope outerScope(outer);
+    {
+        util::MonotonicArena::Scope innerScope(inner);
+        EXPECT_EQ(&inner, util::MonotonicArena::current());
+    }
+    EXPECT_EQ(&outer, util::MonotonicArena::current());
+}
+
+TEST(MonotonicArena, NestedScopesOnOneArena) {
+    util::MonotonicArena arena(64);
+
+    util::MonotonicArena::Scope outerScope(arena);
+    auto* outer = static_cast<int*>(arena.allocate(sizeof(int)));
+    *outer = 42;
+    const auto outerBytes = arena.bytesAllocated();
+    {
+        util::MonotonicArena::Scope innerScope(arena);
+        for (int i = 0; i < 10; ++i) {
+            std::memset(arena.allocate(48), 0, 48);
+        }
+        EXPECT_LT(outerBytes, arena.bytesAllocated());
+    }
+
+    // The inner scope only gave back its own allocations
+    EXPECT_EQ(outerBytes, arena.bytesAllocated());
+    EXPECT_EQ(42, *outer);
+    EXPECT_NE(static_cast<void*>(outer), arena.allocate(sizeof(int)));
+}
+
+TEST(MonotonicArena, CheckpointReusesBlocks) {
+    util::MonotonicArena arena(64);
+    util::MonotonicArena::Scope scope(arena);
+    arena.allocate(16);
+
+    // Every round needs the same memory, which the first one allocated
+    for (int round = 0; round < 10; ++round) {
+        const util::MonotonicArena::Checkpoint checkpoint;
+        for (int i = 0; i < 20; ++i) {
+            arena.allocate(48);
+        }
+        EXPECT_EQ(16u + 20 * 48, arena.bytesAllocated());
+    }
+    const auto blocks = arena.blockCount();
+    {
+        const util::MonotonicArena::Checkpoint checkpoint;
+        for (int i = 0; i < 20; ++i) {
+            arena.allocate(48);
+        }
+    }
+    EXPECT_EQ(blocks, arena.blockCount());
+    EXPECT_EQ(16u, arena.bytesAllocated());
+}
+
+TEST(MonotonicArena, ScopeTrimsWhenEmpty) {
+    util::MonotonicArena arena(64);
+    {
+        util::MonotonicArena::Scope scope(arena);
+        for (int i = 0; i < 100; ++i) {
+            arena.allocate(48);
+        }
+        EXPECT_LT(1u, arena.blockCount());
+    }
+    EXPECT_EQ(0u, arena.bytesAllocated());
+    EXPECT_EQ(1u, arena.blockCount());
+}
+
+TEST(MonotonicArena, CheckpointWithoutArena) {
+    EXPECT_EQ(nullptr, util::MonotonicArena::current());
+    const util::MonotonicArena::Checkpoint checkpoint;
+}
@@ -0,0 +1,62 @@
+#include <mbgl/test/util.hpp>
+
+#include <mbgl/util/parallel_for.hpp>
+#include <mbgl/util/thread_pool.hpp>
+
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+using namespace mbgl;
+
+TEST(ParallelFor, VisitsEveryIndexOnce) {
+    TaggedScheduler scheduler{std::make_shared<ThreadPool>(), util::SimpleIdentity()};
+
+    std::vector<std::atomic<int>> visits(1000);
+    util::parallelFor(scheduler, visits.size(), 3, [&](std::size_t i) { visits[i]++; });
+
+    for (const auto& count : visits) {
+        EXPECT_EQ(1, count);
+    }
+}
+
+TEST(ParallelFor, NoHelpers) {
+    TaggedScheduler scheduler{std::make_shared<ThreadPool>(), util::SimpleIdentity()};
+
+    std::size_t sum = 0;
+    util::parallelFor(scheduler, 10, 0, [&](std::size_t i) { sum += i; });
+    EXPECT_EQ(45u, sum);
+}
+
+TEST(ParallelFor, NestedOnSaturatedPool) {
+    // Every pool thread runs an outer task which fans out again; the calling
+    // thread has to make progress on its own without waiting for helpers.
+    auto pool = std::make_shared<ThreadPool>();
+    TaggedScheduler scheduler{pool, util::SimpleIdentity()};
+
+    std::atomic<std::size_t> total{0};
+    util::parallelFor(scheduler, 8, 8, [&](std::size_t) {
+        util::parallelFor(scheduler, 16, 4, [&](std::size_t) { total++; });
+    });
+    EXPECT_EQ(8u * 16u, total);
+
+    scheduler.waitForEmpty();
+}
+
+TEST(ParallelFor, RethrowsOnCaller) {
+    TaggedScheduler scheduler{std::make_shared<ThreadPool>(), util::SimpleIdentity()};
+
+    std::atomic<std::size_t> visited{0};
+    EXPECT_THROW(util::parallelFor(scheduler,
+                                   64,
+                                   3,
+                                   [&](std::size_t i) {
+                                       visited++;
+                                       if (i == 7) {
+                                           throw std::runtime_error("failure");
+                                       }
+                                   }),
+                 std::runtime_error);
+    EXPECT_EQ(64u, visited);
+}
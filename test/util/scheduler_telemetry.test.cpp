@@ -0,0 +1,85 @@
+#include <mbgl/test/util.hpp>
+
+#include <mbgl/util/scheduler_telemetry.hpp>
+#include <mbgl/util/thread_pool.hpp>
+
+#include <chrono>
+#include <cmath>
+#include <optional>
+#include <thread>
+
+using namespace mbgl;
+using namespace mbgl::util;
+using namespace std::chrono_literals;
+
+TEST(SchedulerTelemetry, HistogramBuckets) {
+    DurationHistogram histogram;
+    histogram.record(10us);
+    histogram.record(50us); // Bounds are inclusive.
+    histogram.record(700us);
+    histogram.record(10s);
+
+    const auto snapshot = histogram.snapshot();
+    EXPECT_EQ(4u, snapshot.count);
+    EXPECT_EQ(2u, snapshot.counts[0]);
+    EXPECT_EQ(1u, snapshot.counts[4]);
+    EXPECT_EQ(1u, snapshot.counts.back());
+    EXPECT_NEAR(10.00076, snapshot.sum, 1e-9);
+
+    EXPECT_EQ(0.00005, snapshot.quantile(0.5));
+    EXPECT_EQ(0.001, snapshot.quantile(0.75));
+    EXPECT_TRUE(std::isinf(snapshot.quantile(1.0)));
+    EXPECT_EQ(0.0, DurationHistogram().snapshot().quantile(0.5));
+}
+
+TEST(SchedulerTelemetry, RecordsTasksPerTag) {
+    auto& telemetry = SchedulerTelemetry::get();
+    TaggedScheduler scheduler{std::make_shared<ThreadPool>(), SimpleIdentity()};
+    const auto tag = scheduler.tag;
+    const auto findTag = [&] {
+        const auto snapshot = telemetry.snapshot();
+        for (const auto& entry : snapshot.tags) {
+            if (entry.tag == tag.id()) {
+                return std::optional<SchedulerTelemetry::Snapshot::Tag>(entry);
+            }
+        }
+        return std::optional<SchedulerTelemetry::Snapshot::Tag>();
+    };
+
+    for (int i = 0; i < 4; ++i) {
+        scheduler.schedule([] { std::this_thread::sleep_for(2ms); });
+    }
+
+    // Wait without `waitForEmpty`, which stops reporting the tag.
+    std::optional<SchedulerTelemetry::Snapshot::Tag> stats;
+    while (!(stats = findTag()) || stats->execution.count < 4) {
+        std::this_thread::sleep_for(1ms);
+    }
+    EXPECT_EQ(4u, stats->queueLatency.count);
+    EXPECT_LE(0.008, stats->execution.sum);
+
+    const auto snapshot = telemetry.snapshot();
+    EXPECT_LE(1u, snapshot.threads);
+    EXPECT_LE(0.008, snapshot.busyTime);
+    EXPECT_LT(0.0, snapshot.utilization());
+    EXPECT_GE(1.0, snapshot.utilization());
+
+    const std::string text = telemetry.toPrometheus();
+    const std::string label = "{tag=\"" + std::to_string(tag.id()) + "\"}";
+    EXPECT_NE(std::string::npos, text.find("# TYPE mbgl_scheduler_queue_latency_seconds histogram"));
+    EXPECT_NE(std::string::npos, text.find("mbgl_scheduler_task_duration_seconds_count" + label + " 4\n"));
+    EXPECT_NE(std::string::npos, text.find("mbgl_scheduler_busy_seconds_total "));
+
+    scheduler.waitForEmpty();
+    EXPECT_FALSE(findTag());
+}
+
+TEST(SchedulerTelemetry, TaskTimer) {
+    auto& telemetry = SchedulerTelemetry::get();
+    const auto before = telemetry.snapshot().categories[static_cast<std::size_t>(TaskCategory::Glyph)].count;
+    {
+        const TaskTimer timer(TaskCategory::Glyph);
+    }
+    EXPECT_EQ(before + 1, telemetry.snapshot().categories[static_cast<std::size_t>(TaskCategory::Glyph)].count);
+    EXPECT_NE(std::string::npos, telemetry.toPrometheus().find("mbgl_task_duration_seconds_count{category=\"glyph\"}"));
+}